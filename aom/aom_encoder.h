@@ -1094,6 +1094,13 @@ aom_codec_err_t aom_codec_encode(aom_codec_ctx_t *ctx, const aom_image_t *img,
  * that may output multiple packets for a single encoded frame (e.g., lagged
  * encoding) or if the application does not reset the buffer periodically.
  *
+ * The AV1 encoder writes the compressed data straight into the buffer,
+ * without a copy, when pad_after is 0 and the space after pad_before is at
+ * least as large as its internal buffer: 8 times (2 times in all intra mode
+ * without forward key frames) the size of an uncompressed frame with the
+ * width and height rounded up to multiples of 32. The encoder may then
+ * overwrite any of that space. Otherwise it falls back as described above.
+ *
  * Applications may restore the default behavior of the codec providing
  * the compressed data buffer by calling this function with a NULL
  * buffer.
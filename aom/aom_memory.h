@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#ifndef AOM_AOM_AOM_MEMORY_H_
+#define AOM_AOM_AOM_MEMORY_H_
+
+/*!\file
+ * \brief Describes the memory allocation hooks and memory usage accounting
+ * of libaom.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "aom/aom_integer.h"
+
+/*!\brief Subsystems that memory usage is accounted for
+ *
+ * Every allocation made by libaom is accounted to one of these subsystems.
+ * Allocations that are not tagged otherwise are accounted to
+ * AOM_MEM_TAG_OTHER.
+ */
+typedef enum aom_mem_tag {
+  AOM_MEM_TAG_OTHER,         /**< Everything not listed below */
+  AOM_MEM_TAG_FRAME_BUFFERS, /**< Reference and scratch frame buffers */
+  AOM_MEM_TAG_LOOKAHEAD,     /**< Encoder lookahead source frames */
+  AOM_MEM_TAG_PYRAMID,       /**< Image pyramids for motion search */
+  AOM_MEM_TAG_TPL,           /**< Encoder TPL model statistics */
+  AOM_MEM_TAG_THREAD_DATA,   /**< Encoder per thread scratch buffers */
+  AOM_MEM_TAG_CDEF_LR,       /**< CDEF and loop restoration buffers */
+  AOM_MEM_TAG_BITSTREAM,     /**< Compressed data output buffers */
+  AOM_MEM_TAG_COUNT          /**< Number of tags, not a valid tag */
+} aom_mem_tag_t;
+
+/*!\brief Memory allocation hooks
+ *
+ * All memory allocated by libaom, including frame buffers, is obtained from
+ * alloc and returned to free. libaom aligns the memory itself, so alloc only
+ * has to return memory that is suitably aligned for any object type, like
+ * malloc() does. alloc returns NULL when it fails. free is never called with
+ * NULL. Both functions must be safe to call from multiple threads at the
+ * same time if the codecs use threads.
+ */
+typedef struct aom_mem_hooks {
+  /*!\brief Allocates size bytes. */
+  void *(*alloc)(void *priv, size_t size);
+  /*!\brief Frees memory returned by alloc. */
+  void (*free)(void *priv, void *ptr);
+  /*!\brief Private data passed to alloc and free. */
+  void *priv;
+} aom_mem_hooks_t;
+
+/*!\brief Memory usage of a subsystem, in bytes
+ *
+ * The byte counts include the padding libaom adds to align allocations.
+ */
+typedef struct aom_mem_usage {
+  size_t live_bytes; /**< Bytes currently allocated */
+  size_t peak_bytes; /**< Largest live_bytes seen since the last reset */
+} aom_mem_usage_t;
+
+/*!\brief Installs memory allocation hooks
+ *
+ * The hooks are used by all codec instances in the process. They can only be
+ * changed while libaom holds no memory, that is before any codec instance or
+ * image is created or after all of them are destroyed.
+ *
+ * \param[in] hooks   The hooks to use. NULL restores malloc() and free().
+ *
+ * \return 0 on success, -1 if hooks is incomplete or libaom still holds
+ *         memory.
+ */
+int aom_mem_set_hooks(const aom_mem_hooks_t *hooks);
+
+/*!\brief Gets the memory usage of one subsystem or of all of them
+ *
+ * The usage is accounted over all codec instances in the process.
+ *
+ * \param[in]  tag     The subsystem, or AOM_MEM_TAG_COUNT for the total.
+ * \param[out] usage   The memory usage.
+ *
+ * \return 0 on success, -1 if tag is invalid or usage is NULL.
+ */
+int aom_mem_get_usage(aom_mem_tag_t tag, aom_mem_usage_t *usage);
+
+/*!\brief Resets the peak usage of all subsystems to their live usage
+ */
+void aom_mem_reset_peak_usage(void);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // AOM_AOM_AOM_MEMORY_H_
@@ -1643,6 +1643,49 @@ enum aome_enc_control_id {
    */
   AOME_SET_VALIDATE_INPUT_HBD,
 
+  /*!\brief Codec control function to let the encoder use input images in
+   * place instead of copying them, aom_zero_copy_input_t* parameter.
+   *
+   * Once enabled, the encoder returns every image passed to
+   * aom_codec_encode() through the release callback, exactly once. Images it
+   * can use in place are kept in the lookahead queue and returned only after
+   * the encoder no longer needs them; all other images are copied as usual
+   * and returned before aom_codec_encode() returns. Until an image is
+   * returned, the application must neither modify nor free it.
+   *
+   * An image can only be used in place when it is a planar (not NV12) image
+   * in the format and size the encoder was configured with, its planes are
+   * aligned to 16 bytes, and it is laid out like an image allocated with
+   * aom_img_alloc_with_border() with an alignment of 32 and a border of 288:
+   * the encoder requires the strides of its own frame buffers, and extends
+   * the frame into that border, overwriting it.
+   *
+   * Must be set before the first call to aom_codec_encode(). A NULL
+   * release_cb disables the mode (default).
+   */
+  AV1E_SET_ZERO_COPY_INPUT,
+
+  /*!\brief Codec control function to set a memory budget for the encoder in
+   * MiB, unsigned int parameter.
+   *
+   * The encoder estimates up front the memory its lookahead, image pyramids,
+   * TPL statistics, reference frames and worker threads need, and degrades
+   * the configuration until the estimate fits in the budget. It tries, in
+   * order, keeping TPL statistics per 32x32 block, disabling global motion
+   * and shortening lag_in_frames. The chosen degradations are reported by
+   * AV1E_GET_MEMORY_BUDGET_INFO.
+   *
+   * Only takes effect before the first call to aom_codec_encode(). A value of
+   * 0 means no budget (default).
+   */
+  AV1E_SET_MAX_MEMORY_MB,
+
+  /*!\brief Codec control function to get the memory estimate of the encoder
+   * and the degradations chosen to fit AV1E_SET_MAX_MEMORY_MB,
+   * aom_memory_budget_info_t* parameter.
+   */
+  AV1E_GET_MEMORY_BUDGET_INFO,
+
   // Any new encoder control IDs should be added above.
   // Maximum allowed encoder control ID is 229.
   // No encoder control ID should be added below.
@@ -1897,6 +1940,38 @@ typedef enum {
   AOM_FULL_SUPERFRAME_DROP, /**< Only full superframe can drop. */
 } AOM_SVC_FRAME_DROP_MODE;
 
+/*!\brief Callback that returns an input image to the application.
+ *
+ * \param[in] priv  The priv member of the aom_zero_copy_input_t
+ * \param[in] img   The image passed to aom_codec_encode()
+ */
+typedef void (*aom_release_input_cb_fn_t)(void *priv, const aom_image_t *img);
+
+/*!\brief Zero-copy input configuration, see AV1E_SET_ZERO_COPY_INPUT. */
+typedef struct aom_zero_copy_input {
+  aom_release_input_cb_fn_t release_cb; /**< Returns input images */
+  void *priv; /**< Private data passed to release_cb */
+} aom_zero_copy_input_t;
+
+/*!\brief Degradations chosen to fit the encoder in AV1E_SET_MAX_MEMORY_MB */
+enum {
+  /*! TPL statistics are kept per 32x32 instead of 16x16 block. */
+  AOM_MEM_BUDGET_COARSE_TPL = 1 << 0,
+  /*! Global motion is disabled, which drops the image pyramids. */
+  AOM_MEM_BUDGET_NO_GLOBAL_MOTION = 1 << 1,
+  /*! lag_in_frames is reduced. */
+  AOM_MEM_BUDGET_SHORT_LAG = 1 << 2,
+  /*! The estimate still exceeds the budget after all degradations. */
+  AOM_MEM_BUDGET_EXCEEDED = 1 << 3,
+};
+
+/*!\brief Memory budget report, see AV1E_GET_MEMORY_BUDGET_INFO. */
+typedef struct aom_memory_budget_info {
+  uint64_t estimated_bytes;   /**< Estimated memory use of the encoder */
+  unsigned int degradations;  /**< Combination of AOM_MEM_BUDGET_* flags */
+  unsigned int lag_in_frames; /**< lag_in_frames after the degradations */
+} aom_memory_budget_info_t;
+
 /*!\brief The GOP structure information determined by the encoder.
  * 250 is MAX_STATIC_GF_GROUP_LENGTH defined in av1/firstpass.h.
  * This is a subset of GF_GROUP. More fields can be added if needed.
@@ -2354,6 +2429,15 @@ AOM_CTRL_USE_TYPE(AOME_GET_LOOPFILTER_LEVEL, int *)
 AOM_CTRL_USE_TYPE(AOME_SET_VALIDATE_INPUT_HBD, int)
 #define AOM_CTRL_AOME_SET_VALIDATE_INPUT_HBD
 
+AOM_CTRL_USE_TYPE(AV1E_SET_ZERO_COPY_INPUT, aom_zero_copy_input_t *)
+#define AOM_CTRL_AV1E_SET_ZERO_COPY_INPUT
+
+AOM_CTRL_USE_TYPE(AV1E_SET_MAX_MEMORY_MB, unsigned int)
+#define AOM_CTRL_AV1E_SET_MAX_MEMORY_MB
+
+AOM_CTRL_USE_TYPE(AV1E_GET_MEMORY_BUDGET_INFO, aom_memory_budget_info_t *)
+#define AOM_CTRL_AV1E_GET_MEMORY_BUDGET_INFO
+
 AOM_CTRL_USE_TYPE(AV1E_SET_AUTO_INTRA_TOOLS_OFF, unsigned int)
 #define AOM_CTRL_AV1E_SET_AUTO_INTRA_TOOLS_OFF
 
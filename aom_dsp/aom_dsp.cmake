@@ -94,7 +94,10 @@ list(APPEND AOM_DSP_COMMON_INTRIN_AVX2
             "${AOM_ROOT}/aom_dsp/x86/convolve_avx2.h"
             "${AOM_ROOT}/aom_dsp/x86/intrapred_avx2.c"
             "${AOM_ROOT}/aom_dsp/x86/loopfilter_avx2.c"
+            "${AOM_ROOT}/aom_dsp/x86/blend_avx2.h"
+            "${AOM_ROOT}/aom_dsp/x86/blend_a64_hmask_avx2.c"
             "${AOM_ROOT}/aom_dsp/x86/blend_a64_mask_avx2.c"
+            "${AOM_ROOT}/aom_dsp/x86/blend_a64_vmask_avx2.c"
             "${AOM_ROOT}/aom_dsp/x86/bitdepth_conversion_avx2.h")
 
 list(APPEND AOM_DSP_COMMON_INTRIN_NEON
@@ -174,7 +177,8 @@ if(CONFIG_AV1_ENCODER)
 
   if(CONFIG_HIGHWAY)
     list(APPEND AOM_DSP_ENCODER_SOURCES "${AOM_ROOT}/aom_dsp/reduce_sum_hwy.h"
-                "${AOM_ROOT}/aom_dsp/sad_hwy.h")
+                "${AOM_ROOT}/aom_dsp/sad_hwy.h"
+                "${AOM_ROOT}/aom_dsp/variance_hwy.h")
   endif()
 
   # Flow estimation library and grain/noise table/model.
@@ -200,8 +204,10 @@ if(CONFIG_AV1_ENCODER)
                 "${AOM_ROOT}/aom_dsp/flow_estimation/x86/disflow_sse4.c")
 
     list(APPEND AOM_DSP_ENCODER_INTRIN_AVX2
+                "${AOM_ROOT}/aom_dsp/flow_estimation/x86/corner_detect_avx2.c"
                 "${AOM_ROOT}/aom_dsp/flow_estimation/x86/corner_match_avx2.c"
-                "${AOM_ROOT}/aom_dsp/flow_estimation/x86/disflow_avx2.c")
+                "${AOM_ROOT}/aom_dsp/flow_estimation/x86/disflow_avx2.c"
+                "${AOM_ROOT}/aom_dsp/flow_estimation/x86/ransac_avx2.c")
 
     list(APPEND AOM_DSP_ENCODER_INTRIN_NEON
                 "${AOM_ROOT}/aom_dsp/flow_estimation/arm/disflow_neon.c")
@@ -255,11 +261,15 @@ if(CONFIG_AV1_ENCODER)
               "${AOM_ROOT}/aom_dsp/x86/blk_sse_sum_avx2.c"
               "${AOM_ROOT}/aom_dsp/x86/sum_squares_avx2.c")
 
+  list(APPEND AOM_DSP_ENCODER_INTRIN_AVXVNNI
+              "${AOM_ROOT}/aom_dsp/x86/sse_avxvnni.c")
+
   if(CONFIG_HIGHWAY)
     list(APPEND AOM_DSP_ENCODER_INTRIN_AVX2
                 "${AOM_ROOT}/aom_dsp/x86/sad_hwy_avx2.cc")
     list(APPEND AOM_DSP_ENCODER_INTRIN_AVX512
-                "${AOM_ROOT}/aom_dsp/x86/sad_hwy_avx512.cc")
+                "${AOM_ROOT}/aom_dsp/x86/sad_hwy_avx512.cc"
+                "${AOM_ROOT}/aom_dsp/x86/variance_hwy_avx512.cc")
     list(REMOVE_ITEM AOM_DSP_ENCODER_INTRIN_AVX2
                      "${AOM_ROOT}/aom_dsp/x86/sad_impl_avx2.c")
   endif()
@@ -487,6 +497,11 @@ function(setup_aom_dsp_targets)
     endif()
   endif()
 
+  if(HAVE_AVXVNNI AND CONFIG_AV1_ENCODER)
+    add_intrinsics_object_library("-mavxvnni" "avxvnni" "aom_dsp_encoder"
+                                  "AOM_DSP_ENCODER_INTRIN_AVXVNNI")
+  endif()
+
   if(HAVE_AVX512 AND CONFIG_AV1_ENCODER AND CONFIG_HIGHWAY)
     add_intrinsics_object_library("-march=skylake-avx512" "avx512"
                                   "aom_dsp_encoder"
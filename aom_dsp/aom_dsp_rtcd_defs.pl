@@ -19,6 +19,8 @@ print <<EOF
 #include "av1/common/blockd.h"
 #include "av1/common/enums.h"
 
+struct correspondence;
+
 EOF
 }
 forward_decls qw/aom_dsp_forward_decls/;
@@ -780,17 +782,17 @@ add_proto qw/void aom_blend_a64_mask/, "uint8_t *dst, uint32_t dst_stride, const
 add_proto qw/void aom_blend_a64_hmask/, "uint8_t *dst, uint32_t dst_stride, const uint8_t *src0, uint32_t src0_stride, const uint8_t *src1, uint32_t src1_stride, const uint8_t *mask, int w, int h";
 add_proto qw/void aom_blend_a64_vmask/, "uint8_t *dst, uint32_t dst_stride, const uint8_t *src0, uint32_t src0_stride, const uint8_t *src1, uint32_t src1_stride, const uint8_t *mask, int w, int h";
 specialize "aom_blend_a64_mask", qw/sse4_1 neon avx2/;
-specialize "aom_blend_a64_hmask", qw/sse4_1 neon/;
-specialize "aom_blend_a64_vmask", qw/sse4_1 neon/;
+specialize "aom_blend_a64_hmask", qw/sse4_1 neon avx2/;
+specialize "aom_blend_a64_vmask", qw/sse4_1 neon avx2/;
 
 if (aom_config("CONFIG_AV1_HIGHBITDEPTH") eq "yes") {
   add_proto qw/void aom_highbd_blend_a64_mask/, "uint8_t *dst, uint32_t dst_stride, const uint8_t *src0, uint32_t src0_stride, const uint8_t *src1, uint32_t src1_stride, const uint8_t *mask, uint32_t mask_stride, int w, int h, int subw, int subh, int bd";
   add_proto qw/void aom_highbd_blend_a64_hmask/, "uint8_t *dst, uint32_t dst_stride, const uint8_t *src0, uint32_t src0_stride, const uint8_t *src1, uint32_t src1_stride, const uint8_t *mask, int w, int h, int bd";
   add_proto qw/void aom_highbd_blend_a64_vmask/, "uint8_t *dst, uint32_t dst_stride, const uint8_t *src0, uint32_t src0_stride, const uint8_t *src1, uint32_t src1_stride, const uint8_t *mask, int w, int h, int bd";
   add_proto qw/void aom_highbd_blend_a64_d16_mask/, "uint8_t *dst, uint32_t dst_stride, const CONV_BUF_TYPE *src0, uint32_t src0_stride, const CONV_BUF_TYPE *src1, uint32_t src1_stride, const uint8_t *mask, uint32_t mask_stride, int w, int h, int subw, int subh, ConvolveParams *conv_params, const int bd";
-  specialize "aom_highbd_blend_a64_mask", qw/sse4_1 neon/;
-  specialize "aom_highbd_blend_a64_hmask", qw/sse4_1 neon/;
-  specialize "aom_highbd_blend_a64_vmask", qw/sse4_1 neon/;
+  specialize "aom_highbd_blend_a64_mask", qw/sse4_1 neon avx2/;
+  specialize "aom_highbd_blend_a64_hmask", qw/sse4_1 neon avx2/;
+  specialize "aom_highbd_blend_a64_vmask", qw/sse4_1 neon avx2/;
   specialize "aom_highbd_blend_a64_d16_mask", qw/sse4_1 neon avx2/;
 }
 
@@ -802,7 +804,7 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
   specialize qw/aom_subtract_block neon sse2 avx2/;
 
   add_proto qw/int64_t/, "aom_sse", "const uint8_t *a, int a_stride, const uint8_t *b,int b_stride, int width, int height";
-  specialize qw/aom_sse sse4_1 avx2 neon neon_dotprod/;
+  specialize qw/aom_sse sse4_1 avx2 avxvnni neon neon_dotprod/;
 
   add_proto qw/void/, "aom_get_blk_sse_sum", "const int16_t *data, int stride, int bw, int bh, int *x_sum, int64_t *x2_sum";
   specialize qw/aom_get_blk_sse_sum sse2 avx2 neon sve/;
@@ -1010,6 +1012,33 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
     specialize qw/aom_highbd_sad16x64_avg   avx2 sse2 neon/;
     specialize qw/aom_highbd_sad32x8_avg    avx2 sse2 neon/;
     specialize qw/aom_highbd_sad64x16_avg   avx2 sse2 neon/;
+
+    if(aom_config("CONFIG_HIGHWAY") eq "yes") {
+      specialize qw/aom_highbd_sad128x128       avx512/;
+      specialize qw/aom_highbd_sad128x64        avx512/;
+      specialize qw/aom_highbd_sad64x128        avx512/;
+      specialize qw/aom_highbd_sad64x64         avx512/;
+      specialize qw/aom_highbd_sad64x32         avx512/;
+      specialize qw/aom_highbd_sad32x64         avx512/;
+      specialize qw/aom_highbd_sad32x32         avx512/;
+      specialize qw/aom_highbd_sad32x16         avx512/;
+      specialize qw/aom_highbd_sad_skip_128x128 avx512/;
+      specialize qw/aom_highbd_sad_skip_128x64  avx512/;
+      specialize qw/aom_highbd_sad_skip_64x128  avx512/;
+      specialize qw/aom_highbd_sad_skip_64x64   avx512/;
+      specialize qw/aom_highbd_sad_skip_64x32   avx512/;
+      specialize qw/aom_highbd_sad_skip_32x64   avx512/;
+      specialize qw/aom_highbd_sad_skip_32x32   avx512/;
+      specialize qw/aom_highbd_sad_skip_32x16   avx512/;
+      specialize qw/aom_highbd_sad128x128_avg   avx512/;
+      specialize qw/aom_highbd_sad128x64_avg    avx512/;
+      specialize qw/aom_highbd_sad64x128_avg    avx512/;
+      specialize qw/aom_highbd_sad64x64_avg     avx512/;
+      specialize qw/aom_highbd_sad64x32_avg     avx512/;
+      specialize qw/aom_highbd_sad32x64_avg     avx512/;
+      specialize qw/aom_highbd_sad32x32_avg     avx512/;
+      specialize qw/aom_highbd_sad32x16_avg     avx512/;
+    }
   }
   #
   # Masked SAD
@@ -1233,6 +1262,33 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
     specialize qw/aom_highbd_sad32x8x3d    avx2 neon/;
     specialize qw/aom_highbd_sad16x64x3d   avx2 neon/;
     specialize qw/aom_highbd_sad16x4x3d    avx2 neon/;
+
+    if(aom_config("CONFIG_HIGHWAY") eq "yes") {
+      specialize qw/aom_highbd_sad128x128x4d       avx512/;
+      specialize qw/aom_highbd_sad128x64x4d        avx512/;
+      specialize qw/aom_highbd_sad64x128x4d        avx512/;
+      specialize qw/aom_highbd_sad64x64x4d         avx512/;
+      specialize qw/aom_highbd_sad64x32x4d         avx512/;
+      specialize qw/aom_highbd_sad32x64x4d         avx512/;
+      specialize qw/aom_highbd_sad32x32x4d         avx512/;
+      specialize qw/aom_highbd_sad32x16x4d         avx512/;
+      specialize qw/aom_highbd_sad_skip_128x128x4d avx512/;
+      specialize qw/aom_highbd_sad_skip_128x64x4d  avx512/;
+      specialize qw/aom_highbd_sad_skip_64x128x4d  avx512/;
+      specialize qw/aom_highbd_sad_skip_64x64x4d   avx512/;
+      specialize qw/aom_highbd_sad_skip_64x32x4d   avx512/;
+      specialize qw/aom_highbd_sad_skip_32x64x4d   avx512/;
+      specialize qw/aom_highbd_sad_skip_32x32x4d   avx512/;
+      specialize qw/aom_highbd_sad_skip_32x16x4d   avx512/;
+      specialize qw/aom_highbd_sad128x128x3d       avx512/;
+      specialize qw/aom_highbd_sad128x64x3d        avx512/;
+      specialize qw/aom_highbd_sad64x128x3d        avx512/;
+      specialize qw/aom_highbd_sad64x64x3d         avx512/;
+      specialize qw/aom_highbd_sad64x32x3d         avx512/;
+      specialize qw/aom_highbd_sad32x64x3d         avx512/;
+      specialize qw/aom_highbd_sad32x32x3d         avx512/;
+      specialize qw/aom_highbd_sad32x16x3d         avx512/;
+    }
     specialize qw/aom_highbd_sad8x32x3d         neon/;
     specialize qw/aom_highbd_sad4x16x3d         neon/;
   }
@@ -1440,6 +1496,33 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
   specialize qw/aom_sub_pixel_avg_variance4x8          neon ssse3/;
   specialize qw/aom_sub_pixel_avg_variance4x4          neon ssse3/;
 
+  if(aom_config("CONFIG_HIGHWAY") eq "yes") {
+    specialize qw/aom_variance128x128               avx512/;
+    specialize qw/aom_variance128x64                avx512/;
+    specialize qw/aom_variance64x128                avx512/;
+    specialize qw/aom_variance64x64                 avx512/;
+    specialize qw/aom_variance64x32                 avx512/;
+    specialize qw/aom_variance32x64                 avx512/;
+    specialize qw/aom_variance32x32                 avx512/;
+    specialize qw/aom_variance32x16                 avx512/;
+    specialize qw/aom_sub_pixel_variance128x128     avx512/;
+    specialize qw/aom_sub_pixel_variance128x64      avx512/;
+    specialize qw/aom_sub_pixel_variance64x128      avx512/;
+    specialize qw/aom_sub_pixel_variance64x64       avx512/;
+    specialize qw/aom_sub_pixel_variance64x32       avx512/;
+    specialize qw/aom_sub_pixel_variance32x64       avx512/;
+    specialize qw/aom_sub_pixel_variance32x32       avx512/;
+    specialize qw/aom_sub_pixel_variance32x16       avx512/;
+    specialize qw/aom_sub_pixel_avg_variance128x128 avx512/;
+    specialize qw/aom_sub_pixel_avg_variance128x64  avx512/;
+    specialize qw/aom_sub_pixel_avg_variance64x128  avx512/;
+    specialize qw/aom_sub_pixel_avg_variance64x64   avx512/;
+    specialize qw/aom_sub_pixel_avg_variance64x32   avx512/;
+    specialize qw/aom_sub_pixel_avg_variance32x64   avx512/;
+    specialize qw/aom_sub_pixel_avg_variance32x32   avx512/;
+    specialize qw/aom_sub_pixel_avg_variance32x16   avx512/;
+  }
+
   if (aom_config("CONFIG_REALTIME_ONLY") ne "yes") {
     specialize qw/aom_variance4x16  neon neon_dotprod sse2/;
     specialize qw/aom_variance16x4  neon neon_dotprod sse2 avx2/;
@@ -1523,6 +1606,19 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
     specialize qw/aom_highbd_8_variance4x8          neon sve/;
     specialize qw/aom_highbd_8_variance4x4   sse4_1 neon sve/;
 
+    if (aom_config("CONFIG_HIGHWAY") eq "yes") {
+      foreach $bd (8, 10, 12) {
+        specialize "aom_highbd_${bd}_variance128x128", qw/avx512/;
+        specialize "aom_highbd_${bd}_variance128x64", qw/avx512/;
+        specialize "aom_highbd_${bd}_variance64x128", qw/avx512/;
+        specialize "aom_highbd_${bd}_variance64x64", qw/avx512/;
+        specialize "aom_highbd_${bd}_variance64x32", qw/avx512/;
+        specialize "aom_highbd_${bd}_variance32x64", qw/avx512/;
+        specialize "aom_highbd_${bd}_variance32x32", qw/avx512/;
+        specialize "aom_highbd_${bd}_variance32x16", qw/avx512/;
+      }
+    }
+
     if (aom_config("CONFIG_REALTIME_ONLY") ne "yes") {
       foreach $bd (8, 10, 12) {
         my $avx2 = ($bd == 10) ? "avx2" : "";
@@ -1727,6 +1823,9 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
 
   # Flow estimation library
   if (aom_config("CONFIG_REALTIME_ONLY") ne "yes") {
+    add_proto qw/void aom_fast9_score_row/, "const uint8_t *src, int stride, int width, int threshold, uint8_t *scores";
+    specialize qw/aom_fast9_score_row avx2/;
+
     add_proto qw/bool aom_compute_mean_stddev/, "const unsigned char *frame, int stride, int x, int y, double *mean, double *one_over_stddev";
     specialize qw/aom_compute_mean_stddev sse4_1 avx2/;
 
@@ -1735,6 +1834,9 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
 
     add_proto qw/void aom_compute_flow_at_point/, "const uint8_t *src, const uint8_t *ref, int x, int y, int width, int height, int stride, double *u, double *v";
     specialize qw/aom_compute_flow_at_point sse4_1 avx2 neon sve/;
+
+    add_proto qw/int aom_ransac_score_affine/, "const double *mat, const struct correspondence *points, int num_points, int min_inliers, int *inlier_indices, double *sse";
+    specialize qw/aom_ransac_score_affine avx2/;
   }
 
 }  # CONFIG_AV1_ENCODER
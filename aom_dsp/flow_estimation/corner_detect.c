@@ -15,7 +15,7 @@
 #include <math.h>
 #include <assert.h>
 
-#include "third_party/fastfeat/fast.h"
+#include "config/aom_dsp_rtcd.h"
 
 #include "aom_dsp/aom_dsp_common.h"
 #include "aom_dsp/flow_estimation/corner_detect.h"
@@ -40,6 +40,175 @@ CornerList *av1_alloc_corner_list(void) {
   return corners;
 }
 
+// Offsets of the 16 pixels on the radius-3 Bresenham circle used by FAST,
+// in the same order as third_party/fastfeat.
+static void fast9_circle_offsets(int stride, int offsets[16]) {
+  static const int kCircleX[16] = { 0,  1,  2,  3,  3,  3,  2,  1,
+                                    0, -1, -2, -3, -3, -3, -2, -1 };
+  static const int kCircleY[16] = { 3,  3,  2,  1,  0, -1, -2, -3,
+                                    -3, -3, -2, -1, 0, 1,  2,  3 };
+  for (int i = 0; i < 16; i++) offsets[i] = kCircleY[i] * stride + kCircleX[i];
+}
+
+// Returns the largest, over all arcs of 9 contiguous circle values, of the
+// smallest value in the arc. The arcs wrap around the circle.
+static int max_arc_min(const int d[16]) {
+  int min2[16], min4[16];
+  for (int i = 0; i < 16; i++) min2[i] = AOMMIN(d[i], d[(i + 1) & 15]);
+  for (int i = 0; i < 16; i++) min4[i] = AOMMIN(min2[i], min2[(i + 2) & 15]);
+  int best = 0;
+  for (int i = 0; i < 16; i++) {
+    const int min8 = AOMMIN(min4[i], min4[(i + 4) & 15]);
+    best = AOMMAX(best, AOMMIN(min8, d[(i + 8) & 15]));
+  }
+  return best;
+}
+
+// Returns the FAST-9 score of the pixel at p, or 0 if it is not a corner at
+// the given threshold.
+//
+// A pixel is a corner at threshold t if 9 contiguous circle pixels are all
+// brighter than p + t, or all darker than p - t. The fastfeat score is the
+// largest t for which the pixel is still a corner, which is one less than the
+// best, over all arcs of 9, of the smallest difference to the center.
+static int fast9_score(const uint8_t *p, const int offsets[16],
+                       int threshold) {
+  const int c = *p;
+  // Every arc of 9 contains two adjacent ones of the circle pixels 0, 4, 8
+  // and 12, which rejects most pixels after only 4 loads.
+  const int p0 = p[offsets[0]], p4 = p[offsets[4]];
+  const int p8 = p[offsets[8]], p12 = p[offsets[12]];
+  const int hi = c + threshold, lo = c - threshold;
+  if (!((p0 > hi && p4 > hi) || (p4 > hi && p8 > hi) || (p8 > hi && p12 > hi) ||
+        (p12 > hi && p0 > hi) || (p0 < lo && p4 < lo) || (p4 < lo && p8 < lo) ||
+        (p8 < lo && p12 < lo) || (p12 < lo && p0 < lo))) {
+    return 0;
+  }
+
+  int bright[16], dark[16];
+  for (int i = 0; i < 16; i++) {
+    const int v = p[offsets[i]];
+    bright[i] = AOMMAX(v - c, 0);
+    dark[i] = AOMMAX(c - v, 0);
+  }
+  const int best = AOMMAX(max_arc_min(bright), max_arc_min(dark));
+  return best > threshold ? best - 1 : 0;
+}
+
+void aom_fast9_score_row_c(const uint8_t *src, int stride, int width,
+                           int threshold, uint8_t *scores) {
+  int offsets[16];
+  fast9_circle_offsets(stride, offsets);
+  for (int x = 3; x < width - 3; x++) {
+    scores[x] = (uint8_t)fast9_score(src + x, offsets, threshold);
+  }
+}
+
+typedef struct {
+  int *xy;
+  int *scores;
+  int num;
+  int capacity;
+} Fast9Corners;
+
+static bool append_corner(Fast9Corners *list, int x, int y, int score) {
+  if (list->num == list->capacity) {
+    const int capacity = AOMMAX(2 * list->capacity, 512);
+    int *xy = (int *)aom_malloc(2 * capacity * sizeof(*xy));
+    int *scores = (int *)aom_malloc(capacity * sizeof(*scores));
+    if (!xy || !scores) {
+      aom_free(xy);
+      aom_free(scores);
+      return false;
+    }
+    if (list->num > 0) {
+      memcpy(xy, list->xy, 2 * list->num * sizeof(*xy));
+      memcpy(scores, list->scores, list->num * sizeof(*scores));
+    }
+    aom_free(list->xy);
+    aom_free(list->scores);
+    list->xy = xy;
+    list->scores = scores;
+    list->capacity = capacity;
+  }
+  list->xy[2 * list->num + 0] = x;
+  list->xy[2 * list->num + 1] = y;
+  list->scores[list->num] = score;
+  list->num++;
+  return true;
+}
+
+// Appends the corners of row `cur` that survive non-maximum suppression, which
+// keeps a corner only if its score is strictly greater than the score of each
+// of its 8 neighbours. Pixels that are not corners have a score of 0.
+static bool nonmax_row(const uint8_t *above, const uint8_t *cur,
+                       const uint8_t *below, int width, int y,
+                       Fast9Corners *list) {
+  for (int x = 3; x < width - 3; x++) {
+    // Corners are sparse, so skip runs of non-corners 8 pixels at a time.
+    if (x + 8 <= width - 3) {
+      uint64_t run;
+      memcpy(&run, cur + x, sizeof(run));
+      if (run == 0) {
+        x += 7;
+        continue;
+      }
+    }
+    const int score = cur[x];
+    if (score == 0) continue;
+    if (score <= above[x - 1] || score <= above[x] || score <= above[x + 1] ||
+        score <= cur[x - 1] || score <= cur[x + 1] || score <= below[x - 1] ||
+        score <= below[x] || score <= below[x + 1]) {
+      continue;
+    }
+    if (!append_corner(list, x, y, score)) return false;
+  }
+  return true;
+}
+
+int av1_fast9_detect_nonmax(const uint8_t *buf, int width, int height,
+                            int stride, int threshold, int **corners,
+                            int **scores) {
+  *corners = NULL;
+  *scores = NULL;
+  if (width < 7 || height < 7) return 0;
+
+  // Scores of three consecutive rows. Rows outside [3, height - 3) and
+  // columns outside [3, width - 3) have no corners and stay 0.
+  uint8_t *rows = (uint8_t *)aom_calloc(3, width);
+  if (!rows) return -1;
+  uint8_t *above = rows;
+  uint8_t *cur = rows + width;
+  uint8_t *below = rows + 2 * width;
+
+  Fast9Corners list = { NULL, NULL, 0, 0 };
+  bool ok = true;
+  aom_fast9_score_row(buf + 3 * stride, stride, width, threshold, cur);
+  for (int y = 3; y < height - 3 && ok; y++) {
+    if (y + 1 < height - 3) {
+      aom_fast9_score_row(buf + (y + 1) * stride, stride, width, threshold,
+                          below);
+    } else {
+      memset(below, 0, width);
+    }
+    ok = nonmax_row(above, cur, below, width, y, &list);
+    uint8_t *const tmp = above;
+    above = cur;
+    cur = below;
+    below = tmp;
+  }
+  aom_free(rows);
+
+  if (!ok) {
+    aom_free(list.xy);
+    aom_free(list.scores);
+    return -1;
+  }
+  *corners = list.xy;
+  *scores = list.scores;
+  return list.num;
+}
+
 static bool compute_corner_list(const YV12_BUFFER_CONFIG *frame, int bit_depth,
                                 int downsample_level, CornerList *corners) {
   ImagePyramid *pyr = frame->y_pyramid;
@@ -59,19 +228,19 @@ static bool compute_corner_list(const YV12_BUFFER_CONFIG *frame, int bit_depth,
   int height = pyr->layers[downsample_level].height;
   int stride = pyr->layers[downsample_level].stride;
 
+  int *frame_corners_xy = NULL;
   int *scores = NULL;
-  int num_corners;
-  xy *const frame_corners_xy = aom_fast9_detect_nonmax(
-      buf, width, height, stride, FAST_BARRIER, &scores, &num_corners);
+  const int num_corners = av1_fast9_detect_nonmax(
+      buf, width, height, stride, FAST_BARRIER, &frame_corners_xy, &scores);
   if (num_corners < 0) return false;
 
   if (num_corners <= MAX_CORNERS) {
     // Use all detected corners
     for (int i = 0; i < num_corners; i++) {
       corners->corners[2 * i + 0] =
-          frame_corners_xy[i].x * (1 << downsample_level);
+          frame_corners_xy[2 * i + 0] * (1 << downsample_level);
       corners->corners[2 * i + 1] =
-          frame_corners_xy[i].y * (1 << downsample_level);
+          frame_corners_xy[2 * i + 1] * (1 << downsample_level);
     }
     corners->num_corners = num_corners;
   } else {
@@ -102,9 +271,9 @@ static bool compute_corner_list(const YV12_BUFFER_CONFIG *frame, int bit_depth,
       if (scores[i] > threshold) {
         assert(copied_corners < MAX_CORNERS);
         corners->corners[2 * copied_corners + 0] =
-            frame_corners_xy[i].x * (1 << downsample_level);
+            frame_corners_xy[2 * i + 0] * (1 << downsample_level);
         corners->corners[2 * copied_corners + 1] =
-            frame_corners_xy[i].y * (1 << downsample_level);
+            frame_corners_xy[2 * i + 1] * (1 << downsample_level);
         copied_corners += 1;
       }
     }
@@ -112,8 +281,8 @@ static bool compute_corner_list(const YV12_BUFFER_CONFIG *frame, int bit_depth,
     corners->num_corners = copied_corners;
   }
 
-  free(scores);
-  free(frame_corners_xy);
+  aom_free(scores);
+  aom_free(frame_corners_xy);
   return true;
 }
 
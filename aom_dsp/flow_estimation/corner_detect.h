@@ -70,6 +70,17 @@ bool av1_compute_corner_list(const YV12_BUFFER_CONFIG *frame, int bit_depth,
 bool aom_is_corner_list_valid(CornerList *corners);
 #endif
 
+// Detects FAST-9 corners in an 8-bit image and applies non-maximum
+// suppression, with the same results as aom_fast9_detect_nonmax() in
+// third_party/fastfeat.
+//
+// On success, returns the number of corners n and sets *corners to an array of
+// n (x, y) pairs and *scores to an array of n scores, both of which must be
+// freed with aom_free(). Returns -1 on allocation failure.
+int av1_fast9_detect_nonmax(const uint8_t *buf, int width, int height,
+                            int stride, int threshold, int **corners,
+                            int **scores);
+
 void av1_invalidate_corner_list(CornerList *corners);
 
 void av1_free_corner_list(CornerList *corners);
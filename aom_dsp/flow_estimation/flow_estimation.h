@@ -56,7 +56,7 @@ typedef struct {
 //
 // A correspondence (x, y) -> (rx, ry) means that point (x, y) in the
 // source frame corresponds to point (rx, ry) in the ref frame.
-typedef struct {
+typedef struct correspondence {
   double x, y;
   double rx, ry;
 } Correspondence;
@@ -17,6 +17,8 @@
 #include <string.h>
 #include <assert.h>
 
+#include "config/aom_dsp_rtcd.h"
+
 #include "aom_dsp/flow_estimation/ransac.h"
 #include "aom_dsp/mathutils.h"
 #include "aom_mem/aom_mem.h"
@@ -27,9 +29,6 @@
 #define MAX_MINPTS 4
 #define MINPTS_MULTIPLIER 5
 
-#define INLIER_THRESHOLD 1.25
-#define INLIER_THRESHOLD_SQUARED (INLIER_THRESHOLD * INLIER_THRESHOLD)
-
 // Number of initial models to generate
 #define NUM_TRIALS 20
 
@@ -56,7 +55,8 @@ typedef bool (*FindTransformationFunc)(const Correspondence *points,
                                        const int *indices, int num_indices,
                                        double *params);
 typedef void (*ScoreModelFunc)(const double *mat, const Correspondence *points,
-                               int num_points, RANSAC_MOTION *model);
+                               int num_points, int min_inliers,
+                               RANSAC_MOTION *model);
 
 // vtable-like structure which stores all of the information needed by RANSAC
 // for a particular model type
@@ -86,7 +86,9 @@ typedef struct {
 
 #if ALLOW_TRANSLATION_MODELS
 static void score_translation(const double *mat, const Correspondence *points,
-                              int num_points, RANSAC_MOTION *model) {
+                              int num_points, int min_inliers,
+                              RANSAC_MOTION *model) {
+  (void)min_inliers;
   model->num_inliers = 0;
   model->sse = 0.0;
 
@@ -103,7 +105,7 @@ static void score_translation(const double *mat, const Correspondence *points,
     const double dy = proj_y - y2;
     const double sse = dx * dx + dy * dy;
 
-    if (sse < INLIER_THRESHOLD_SQUARED) {
+    if (sse < RANSAC_INLIER_THRESHOLD_SQUARED) {
       model->inlier_indices[model->num_inliers++] = i;
       model->sse += sse;
     }
@@ -111,12 +113,17 @@ static void score_translation(const double *mat, const Correspondence *points,
 }
 #endif  // ALLOW_TRANSLATION_MODELS
 
-static void score_affine(const double *mat, const Correspondence *points,
-                         int num_points, RANSAC_MOTION *model) {
-  model->num_inliers = 0;
-  model->sse = 0.0;
+int aom_ransac_score_affine_c(const double *mat, const Correspondence *points,
+                              int num_points, int min_inliers,
+                              int *inlier_indices, double *sse) {
+  // Once more than this many outliers have been seen, the model cannot reach
+  // min_inliers any more, so stop scoring it.
+  const int max_outliers = num_points - min_inliers;
+  int num_inliers = 0;
+  double sse_sum = 0.0;
 
   for (int i = 0; i < num_points; ++i) {
+    if (i - num_inliers > max_outliers) break;
     const double x1 = points[i].x;
     const double y1 = points[i].y;
     const double x2 = points[i].rx;
@@ -127,13 +134,23 @@ static void score_affine(const double *mat, const Correspondence *points,
 
     const double dx = proj_x - x2;
     const double dy = proj_y - y2;
-    const double sse = dx * dx + dy * dy;
+    const double err = dx * dx + dy * dy;
 
-    if (sse < INLIER_THRESHOLD_SQUARED) {
-      model->inlier_indices[model->num_inliers++] = i;
-      model->sse += sse;
+    if (err < RANSAC_INLIER_THRESHOLD_SQUARED) {
+      inlier_indices[num_inliers++] = i;
+      sse_sum += err;
     }
   }
+  *sse = sse_sum;
+  return num_inliers;
+}
+
+static void score_affine(const double *mat, const Correspondence *points,
+                         int num_points, int min_inliers,
+                         RANSAC_MOTION *model) {
+  model->num_inliers =
+      aom_ransac_score_affine(mat, points, num_points, min_inliers,
+                              model->inlier_indices, &model->sse);
 }
 
 #if ALLOW_TRANSLATION_MODELS
@@ -354,10 +371,17 @@ static bool ransac_internal(const Correspondence *matched_points, int npoints,
       continue;
     }
 
+    // Preemptive scoring: a model is only useful if it can at least tie with
+    // the worst kept motion, so stop scoring it as soon as it has too many
+    // outliers to get there. Models stopped early end up with fewer than
+    // needed_inliers inliers and are rejected below, as they would have been
+    // if scored in full.
+    const int needed_inliers =
+        AOMMAX(min_inliers, worst_kept_motion->num_inliers);
     model_info->score_model(params_this_motion, matched_points, npoints,
-                            &current_motion);
+                            needed_inliers, &current_motion);
 
-    if (current_motion.num_inliers < min_inliers) {
+    if (current_motion.num_inliers < needed_inliers) {
       // Reject models with too few inliers
       continue;
     }
@@ -425,7 +449,7 @@ static bool ransac_internal(const Correspondence *matched_points, int npoints,
       }
 
       // Score the newly generated model
-      model_info->score_model(params_this_motion, matched_points, npoints,
+      model_info->score_model(params_this_motion, matched_points, npoints, 0,
                               &current_motion);
 
       // At this point, there are three possibilities:
@@ -24,6 +24,12 @@
 extern "C" {
 #endif
 
+// A correspondence is an inlier of a model if the model maps (x, y) to within
+// this distance of (rx, ry).
+#define RANSAC_INLIER_THRESHOLD 1.25
+#define RANSAC_INLIER_THRESHOLD_SQUARED \
+  (RANSAC_INLIER_THRESHOLD * RANSAC_INLIER_THRESHOLD)
+
 bool ransac(const Correspondence *matched_points, int npoints,
             TransformationType type, MotionModel *motion_models,
             int num_desired_motions, bool *mem_alloc_failed);
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <immintrin.h>
+
+#include "aom_dsp/aom_dsp_common.h"
+#include "aom_dsp/x86/synonyms.h"
+#include "aom_dsp/x86/synonyms_avx2.h"
+
+#include "config/aom_dsp_rtcd.h"
+
+// Returns, for each lane, the largest over all arcs of 9 contiguous circle
+// values of the smallest value in the arc. The arcs wrap around the circle.
+static inline __m256i max_arc_min_avx2(const __m256i d[16]) {
+  __m256i min2[16], min4[16];
+  for (int i = 0; i < 16; i++) min2[i] = _mm256_min_epu8(d[i], d[(i + 1) & 15]);
+  for (int i = 0; i < 16; i++) {
+    min4[i] = _mm256_min_epu8(min2[i], min2[(i + 2) & 15]);
+  }
+  __m256i best = _mm256_setzero_si256();
+  for (int i = 0; i < 16; i++) {
+    const __m256i min8 = _mm256_min_epu8(min4[i], min4[(i + 4) & 15]);
+    const __m256i min9 = _mm256_min_epu8(min8, d[(i + 8) & 15]);
+    best = _mm256_max_epu8(best, min9);
+  }
+  return best;
+}
+
+// Scores 32 pixels starting at p. See fast9_score() in corner_detect.c: the
+// differences to the center are computed with saturating subtraction, so
+// pixels on the wrong side of the center contribute 0.
+static inline __m256i fast9_score_32_avx2(const uint8_t *p,
+                                          const int offsets[16],
+                                          __m256i threshold_plus_one) {
+  const __m256i c = yy_loadu_256(p);
+  __m256i bright[16], dark[16];
+  for (int i = 0; i < 16; i += 4) {
+    const __m256i v = yy_loadu_256(p + offsets[i]);
+    bright[i] = _mm256_subs_epu8(v, c);
+    dark[i] = _mm256_subs_epu8(c, v);
+  }
+  // Every arc of 9 contains two adjacent ones of the circle pixels 0, 4, 8
+  // and 12. Most groups of 32 pixels have no candidate at all.
+  __m256i quick = _mm256_setzero_si256();
+  for (int i = 0; i < 16; i += 4) {
+    const int j = (i + 4) & 15;
+    quick = _mm256_max_epu8(quick, _mm256_min_epu8(bright[i], bright[j]));
+    quick = _mm256_max_epu8(quick, _mm256_min_epu8(dark[i], dark[j]));
+  }
+  // quick > threshold, as an unsigned comparison.
+  const __m256i quick_pass = _mm256_cmpeq_epi8(
+      _mm256_max_epu8(quick, threshold_plus_one), quick);
+  if (_mm256_testz_si256(quick_pass, quick_pass)) {
+    return _mm256_setzero_si256();
+  }
+
+  for (int i = 0; i < 16; i++) {
+    if ((i & 3) == 0) continue;
+    const __m256i v = yy_loadu_256(p + offsets[i]);
+    bright[i] = _mm256_subs_epu8(v, c);
+    dark[i] = _mm256_subs_epu8(c, v);
+  }
+  const __m256i best = _mm256_max_epu8(max_arc_min_avx2(bright),
+                                       max_arc_min_avx2(dark));
+  const __m256i is_corner = _mm256_cmpeq_epi8(
+      _mm256_max_epu8(best, threshold_plus_one), best);
+  const __m256i score = _mm256_subs_epu8(best, _mm256_set1_epi8(1));
+  return _mm256_and_si256(score, is_corner);
+}
+
+void aom_fast9_score_row_avx2(const uint8_t *src, int stride, int width,
+                              int threshold, uint8_t *scores) {
+  // threshold + 1 must fit in an unsigned byte.
+  if (threshold < 0 || threshold > 254) {
+    aom_fast9_score_row_c(src, stride, width, threshold, scores);
+    return;
+  }
+  static const int kCircleX[16] = { 0,  1,  2,  3,  3,  3,  2,  1,
+                                    0, -1, -2, -3, -3, -3, -2, -1 };
+  static const int kCircleY[16] = { 3,  3,  2,  1,  0, -1, -2, -3,
+                                    -3, -3, -2, -1, 0, 1,  2,  3 };
+  int offsets[16];
+  for (int i = 0; i < 16; i++) offsets[i] = kCircleY[i] * stride + kCircleX[i];
+  const __m256i threshold_plus_one = _mm256_set1_epi8((char)(threshold + 1));
+
+  // The loads reach 3 pixels to the right of each group of 32, which must stay
+  // inside the row.
+  int x = 3;
+  for (; x + 32 + 3 <= width; x += 32) {
+    yy_storeu_256(scores + x,
+                  fast9_score_32_avx2(src + x, offsets, threshold_plus_one));
+  }
+  if (x < width - 3) {
+    // Score the last pixels with the C code, which only writes
+    // [3, width - 3); shift the row so that it starts at x - 3.
+    aom_fast9_score_row_c(src + x - 3, stride, width - x + 3, threshold,
+                          scores + x - 3);
+  }
+}
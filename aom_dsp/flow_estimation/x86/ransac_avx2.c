@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <immintrin.h>
+
+#include "aom_dsp/flow_estimation/flow_estimation.h"
+#include "aom_dsp/flow_estimation/ransac.h"
+
+#include "config/aom_dsp_rtcd.h"
+
+// Scores 4 correspondences at a time. Each lane computes the projection error
+// with the same operations as the C code, and the errors of the inliers are
+// then summed in index order, so the output is bit-exact.
+int aom_ransac_score_affine_avx2(const double *mat,
+                                 const struct correspondence *points,
+                                 int num_points, int min_inliers,
+                                 int *inlier_indices, double *sse) {
+  const __m256d m0 = _mm256_set1_pd(mat[0]);
+  const __m256d m1 = _mm256_set1_pd(mat[1]);
+  const __m256d m2 = _mm256_set1_pd(mat[2]);
+  const __m256d m3 = _mm256_set1_pd(mat[3]);
+  const __m256d m4 = _mm256_set1_pd(mat[4]);
+  const __m256d m5 = _mm256_set1_pd(mat[5]);
+  const __m256d threshold = _mm256_set1_pd(RANSAC_INLIER_THRESHOLD_SQUARED);
+  const int max_outliers = num_points - min_inliers;
+  int num_inliers = 0;
+  double sse_sum = 0.0;
+
+  int i = 0;
+  for (; i + 4 <= num_points; i += 4) {
+    if (i - num_inliers > max_outliers) {
+      *sse = sse_sum;
+      return num_inliers;
+    }
+    // Each Correspondence is { x, y, rx, ry }; transpose 4 of them.
+    const __m256d p0 = _mm256_loadu_pd(&points[i + 0].x);
+    const __m256d p1 = _mm256_loadu_pd(&points[i + 1].x);
+    const __m256d p2 = _mm256_loadu_pd(&points[i + 2].x);
+    const __m256d p3 = _mm256_loadu_pd(&points[i + 3].x);
+    const __m256d t0 = _mm256_unpacklo_pd(p0, p1);  // x0 x1 rx0 rx1
+    const __m256d t1 = _mm256_unpackhi_pd(p0, p1);  // y0 y1 ry0 ry1
+    const __m256d t2 = _mm256_unpacklo_pd(p2, p3);  // x2 x3 rx2 rx3
+    const __m256d t3 = _mm256_unpackhi_pd(p2, p3);  // y2 y3 ry2 ry3
+    const __m256d x1 = _mm256_permute2f128_pd(t0, t2, 0x20);
+    const __m256d y1 = _mm256_permute2f128_pd(t1, t3, 0x20);
+    const __m256d x2 = _mm256_permute2f128_pd(t0, t2, 0x31);
+    const __m256d y2 = _mm256_permute2f128_pd(t1, t3, 0x31);
+
+    const __m256d proj_x = _mm256_add_pd(
+        _mm256_add_pd(_mm256_mul_pd(m2, x1), _mm256_mul_pd(m3, y1)), m0);
+    const __m256d proj_y = _mm256_add_pd(
+        _mm256_add_pd(_mm256_mul_pd(m4, x1), _mm256_mul_pd(m5, y1)), m1);
+    const __m256d dx = _mm256_sub_pd(proj_x, x2);
+    const __m256d dy = _mm256_sub_pd(proj_y, y2);
+    const __m256d err =
+        _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy));
+    const int mask =
+        _mm256_movemask_pd(_mm256_cmp_pd(err, threshold, _CMP_LT_OQ));
+    if (mask == 0) continue;
+
+    double errs[4];
+    _mm256_storeu_pd(errs, err);
+    for (int j = 0; j < 4; ++j) {
+      if (mask & (1 << j)) {
+        inlier_indices[num_inliers++] = i + j;
+        sse_sum += errs[j];
+      }
+    }
+  }
+
+  for (; i < num_points; ++i) {
+    if (i - num_inliers > max_outliers) break;
+    const double x1 = points[i].x;
+    const double y1 = points[i].y;
+    const double x2 = points[i].rx;
+    const double y2 = points[i].ry;
+
+    const double proj_x = mat[2] * x1 + mat[3] * y1 + mat[0];
+    const double proj_y = mat[4] * x1 + mat[5] * y1 + mat[1];
+
+    const double dx = proj_x - x2;
+    const double dy = proj_y - y2;
+    const double err = dx * dx + dy * dy;
+
+    if (err < RANSAC_INLIER_THRESHOLD_SQUARED) {
+      inlier_indices[num_inliers++] = i;
+      sse_sum += err;
+    }
+  }
+  *sse = sse_sum;
+  return num_inliers;
+}
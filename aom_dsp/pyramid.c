@@ -103,12 +103,13 @@ ImagePyramid *aom_alloc_pyramid(int width, int height, bool image_is_16bit) {
   const int msb = get_msb(AOMMIN(width, height));
   const int n_levels = AOMMAX(msb - MIN_PYRAMID_SIZE_LOG2, 1);
 
-  ImagePyramid *pyr = aom_calloc(1, sizeof(*pyr));
+  ImagePyramid *pyr = aom_calloc_tagged(AOM_MEM_TAG_PYRAMID, 1, sizeof(*pyr));
   if (!pyr) {
     return NULL;
   }
 
-  pyr->layers = aom_calloc(n_levels, sizeof(*pyr->layers));
+  pyr->layers =
+      aom_calloc_tagged(AOM_MEM_TAG_PYRAMID, n_levels, sizeof(*pyr->layers));
   if (!pyr->layers) {
     aom_free(pyr);
     return NULL;
@@ -189,7 +190,8 @@ ImagePyramid *aom_alloc_pyramid(int width, int height, bool image_is_16bit) {
   }
 
   pyr->buffer_alloc =
-      aom_memalign(PYRAMID_ALIGNMENT, buffer_size * sizeof(*pyr->buffer_alloc));
+      aom_memalign_tagged(AOM_MEM_TAG_PYRAMID, PYRAMID_ALIGNMENT,
+                          buffer_size * sizeof(*pyr->buffer_alloc));
   if (!pyr->buffer_alloc) {
     aom_free(pyr->layers);
     aom_free(pyr);
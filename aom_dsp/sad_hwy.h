@@ -11,6 +11,7 @@
 #ifndef AOM_AOM_DSP_SAD_HWY_H_
 #define AOM_AOM_DSP_SAD_HWY_H_
 
+#include "aom_dsp/aom_dsp_common.h"
 #include "aom_dsp/reduce_sum_hwy.h"
 #include "third_party/highway/hwy/highway.h"
 
@@ -111,6 +112,93 @@ HWY_MAYBE_UNUSED void SumOfAbsoluteDiffND(const uint8_t *src_ptr,
   hn::StoreU(block_sum, block_sum_tag, res);
 }
 
+// The high bitdepth kernels accumulate absolute differences in 16-bit lanes,
+// which hold 16 differences of 12-bit pixels, and widen them to 32 bits once
+// per group of rows.
+template <int BlockWidth>
+HWY_MAYBE_UNUSED unsigned int HighbdSumOfAbsoluteDiff(
+    const uint8_t *src8, int src_stride, const uint8_t *ref8, int ref_stride,
+    int h, const uint8_t *second_pred8 = nullptr) {
+  constexpr hn::CappedTag<uint16_t, BlockWidth> pixel_tag;
+  constexpr hn::RepartitionToWide<decltype(pixel_tag)> intermediate_sum_tag;
+  constexpr int kRowsPerFlush = 16 * hn::MaxLanes(pixel_tag) / BlockWidth;
+  const int vw = hn::Lanes(pixel_tag);
+  const uint16_t *src_ptr = CONVERT_TO_SHORTPTR(src8);
+  const uint16_t *ref_ptr = CONVERT_TO_SHORTPTR(ref8);
+  const uint16_t *second_pred =
+      second_pred8 != nullptr ? CONVERT_TO_SHORTPTR(second_pred8) : nullptr;
+  auto sum_sad = hn::Zero(intermediate_sum_tag);
+  const bool is_sad_avg = second_pred != nullptr;
+  for (int i = 0; i < h; i += kRowsPerFlush) {
+    auto row_sad = hn::Zero(pixel_tag);
+    const int rows = AOMMIN(kRowsPerFlush, h - i);
+    for (int k = 0; k < rows; ++k) {
+      for (int j = 0; j < BlockWidth; j += vw) {
+        auto src_vec = hn::LoadU(pixel_tag, &src_ptr[j]);
+        auto ref_vec = hn::LoadU(pixel_tag, &ref_ptr[j]);
+        if (is_sad_avg) {
+          auto sec_pred_vec = hn::LoadU(pixel_tag, &second_pred[j]);
+          ref_vec = hn::AverageRound(ref_vec, sec_pred_vec);
+        }
+        row_sad = hn::Add(row_sad, hn::AbsDiff(src_vec, ref_vec));
+      }
+      src_ptr += src_stride;
+      ref_ptr += ref_stride;
+      if (is_sad_avg) {
+        second_pred += BlockWidth;
+      }
+    }
+    sum_sad = hn::Add(sum_sad, hn::SumsOf2(row_sad));
+  }
+  return static_cast<unsigned int>(
+      hn::ReduceSum(intermediate_sum_tag, sum_sad));
+}
+
+template <int BlockWidth, int NumRef>
+HWY_MAYBE_UNUSED void HighbdSumOfAbsoluteDiffND(
+    const uint8_t *src8, int src_stride, const uint8_t *const ref8[4],
+    int ref_stride, int h, uint32_t res[4]) {
+  static_assert(NumRef == 3 || NumRef == 4, "NumRef must be 3 or 4.");
+  constexpr hn::CappedTag<uint16_t, BlockWidth> pixel_tag;
+  constexpr hn::RepartitionToWide<decltype(pixel_tag)> intermediate_sum_tag;
+  constexpr int kRowsPerFlush = 16 * hn::MaxLanes(pixel_tag) / BlockWidth;
+  const int vw = hn::Lanes(pixel_tag);
+  const uint16_t *src_ptr = CONVERT_TO_SHORTPTR(src8);
+  const uint16_t *ref_ptr[NumRef];
+  hn::VFromD<decltype(intermediate_sum_tag)> sum_sad[NumRef];
+  for (int r = 0; r < NumRef; ++r) {
+    ref_ptr[r] = CONVERT_TO_SHORTPTR(ref8[r]);
+    sum_sad[r] = hn::Zero(intermediate_sum_tag);
+  }
+  for (int i = 0; i < h; i += kRowsPerFlush) {
+    hn::VFromD<decltype(pixel_tag)> row_sad[NumRef];
+    for (int r = 0; r < NumRef; ++r) {
+      row_sad[r] = hn::Zero(pixel_tag);
+    }
+    const int rows = AOMMIN(kRowsPerFlush, h - i);
+    for (int k = 0; k < rows; ++k) {
+      for (int j = 0; j < BlockWidth; j += vw) {
+        auto src_vec = hn::LoadU(pixel_tag, &src_ptr[j]);
+        for (int r = 0; r < NumRef; ++r) {
+          auto ref_vec = hn::LoadU(pixel_tag, &ref_ptr[r][j]);
+          row_sad[r] = hn::Add(row_sad[r], hn::AbsDiff(src_vec, ref_vec));
+        }
+      }
+      src_ptr += src_stride;
+      for (int r = 0; r < NumRef; ++r) {
+        ref_ptr[r] += ref_stride;
+      }
+    }
+    for (int r = 0; r < NumRef; ++r) {
+      sum_sad[r] = hn::Add(sum_sad[r], hn::SumsOf2(row_sad[r]));
+    }
+  }
+  for (int r = 0; r < NumRef; ++r) {
+    res[r] = static_cast<uint32_t>(
+        hn::ReduceSum(intermediate_sum_tag, sum_sad[r]));
+  }
+}
+
 }  // namespace HWY_NAMESPACE
 }  // namespace
 
@@ -184,6 +272,79 @@ HWY_MAYBE_UNUSED void SumOfAbsoluteDiffND(const uint8_t *src_ptr,
                                                ref_stride, h, second_pred);  \
   }
 
+#define FHIGHBD_SAD(w, h, suffix)                                             \
+  extern "C" unsigned int aom_highbd_sad##w##x##h##_##suffix(                 \
+      const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr,         \
+      int ref_stride);                                                        \
+  HWY_ATTR unsigned int aom_highbd_sad##w##x##h##_##suffix(                   \
+      const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr,         \
+      int ref_stride) {                                                       \
+    return HWY_NAMESPACE::HighbdSumOfAbsoluteDiff<w>(src_ptr, src_stride,     \
+                                                     ref_ptr, ref_stride, h); \
+  }
+
+#define FHIGHBD_SAD_4D(w, h, suffix)                                           \
+  extern "C" void aom_highbd_sad##w##x##h##x4d_##suffix(                       \
+      const uint8_t *src_ptr, int src_stride, const uint8_t *const ref_ptr[4], \
+      int ref_stride, uint32_t res[4]);                                        \
+  HWY_ATTR void aom_highbd_sad##w##x##h##x4d_##suffix(                         \
+      const uint8_t *src_ptr, int src_stride, const uint8_t *const ref_ptr[4], \
+      int ref_stride, uint32_t res[4]) {                                       \
+    HWY_NAMESPACE::HighbdSumOfAbsoluteDiffND<w, 4>(src_ptr, src_stride,        \
+                                                   ref_ptr, ref_stride, h,     \
+                                                   res);                       \
+  }
+
+#define FHIGHBD_SAD_3D(w, h, suffix)                                           \
+  extern "C" void aom_highbd_sad##w##x##h##x3d_##suffix(                       \
+      const uint8_t *src_ptr, int src_stride, const uint8_t *const ref_ptr[4], \
+      int ref_stride, uint32_t res[4]);                                        \
+  HWY_ATTR void aom_highbd_sad##w##x##h##x3d_##suffix(                         \
+      const uint8_t *src_ptr, int src_stride, const uint8_t *const ref_ptr[4], \
+      int ref_stride, uint32_t res[4]) {                                       \
+    HWY_NAMESPACE::HighbdSumOfAbsoluteDiffND<w, 3>(src_ptr, src_stride,        \
+                                                   ref_ptr, ref_stride, h,     \
+                                                   res);                       \
+  }
+
+#define FHIGHBD_SAD_SKIP(w, h, suffix)                                    \
+  extern "C" unsigned int aom_highbd_sad_skip_##w##x##h##_##suffix(       \
+      const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr,     \
+      int ref_stride);                                                    \
+  HWY_ATTR unsigned int aom_highbd_sad_skip_##w##x##h##_##suffix(         \
+      const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr,     \
+      int ref_stride) {                                                   \
+    return 2 * HWY_NAMESPACE::HighbdSumOfAbsoluteDiff<w>(                 \
+                   src_ptr, 2 * src_stride, ref_ptr, 2 * ref_stride,      \
+                   ((h) >> 1));                                           \
+  }
+
+#define FHIGHBD_SAD_4D_SKIP(w, h, suffix)                                      \
+  extern "C" void aom_highbd_sad_skip_##w##x##h##x4d_##suffix(                 \
+      const uint8_t *src_ptr, int src_stride, const uint8_t *const ref_ptr[4], \
+      int ref_stride, uint32_t res[4]);                                        \
+  HWY_ATTR void aom_highbd_sad_skip_##w##x##h##x4d_##suffix(                   \
+      const uint8_t *src_ptr, int src_stride, const uint8_t *const ref_ptr[4], \
+      int ref_stride, uint32_t res[4]) {                                       \
+    HWY_NAMESPACE::HighbdSumOfAbsoluteDiffND<w, 4>(                            \
+        src_ptr, 2 * src_stride, ref_ptr, 2 * ref_stride, ((h) >> 1), res);    \
+    res[0] <<= 1;                                                              \
+    res[1] <<= 1;                                                              \
+    res[2] <<= 1;                                                              \
+    res[3] <<= 1;                                                              \
+  }
+
+#define FHIGHBD_SAD_AVG(w, h, suffix)                                         \
+  extern "C" unsigned int aom_highbd_sad##w##x##h##_avg_##suffix(             \
+      const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr,         \
+      int ref_stride, const uint8_t *second_pred);                            \
+  HWY_ATTR unsigned int aom_highbd_sad##w##x##h##_avg_##suffix(               \
+      const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr,         \
+      int ref_stride, const uint8_t *second_pred) {                           \
+    return HWY_NAMESPACE::HighbdSumOfAbsoluteDiff<w>(                         \
+        src_ptr, src_stride, ref_ptr, ref_stride, h, second_pred);            \
+  }
+
 #define FOR_EACH_SAD_BLOCK_SIZE(X, suffix) \
   X(128, 128, suffix)                      \
   X(128, 64, suffix)                       \
@@ -191,6 +352,13 @@ HWY_MAYBE_UNUSED void SumOfAbsoluteDiffND(const uint8_t *src_ptr,
   X(64, 64, suffix)                        \
   X(64, 32, suffix)
 
+// 32 high bitdepth pixels already fill a 512-bit vector.
+#define FOR_EACH_HIGHBD_SAD_BLOCK_SIZE(X, suffix) \
+  FOR_EACH_SAD_BLOCK_SIZE(X, suffix)              \
+  X(32, 64, suffix)                               \
+  X(32, 32, suffix)                               \
+  X(32, 16, suffix)
+
 HWY_AFTER_NAMESPACE();
 
 #endif  // AOM_AOM_DSP_SAD_HWY_H_
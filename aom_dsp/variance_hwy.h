@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+#ifndef AOM_AOM_DSP_VARIANCE_HWY_H_
+#define AOM_AOM_DSP_VARIANCE_HWY_H_
+
+#include "aom_dsp/aom_dsp_common.h"
+#include "aom_dsp/aom_filter.h"
+#include "third_party/highway/hwy/highway.h"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace {
+namespace HWY_NAMESPACE {
+
+namespace hn = hwy::HWY_NAMESPACE;
+
+// Computes the sum and the sum of squares of the differences between the
+// predicted block produced row by row by |pred_fn| and the 8-bit reference
+// block at |ref|. |pred_fn| fills one row of 16-bit predicted pixels per call.
+template <int BlockWidth, int BlockHeight, typename PredFn>
+HWY_ATTR HWY_INLINE void VarianceRows(const uint8_t *ref, int ref_stride,
+                                      PredFn pred_fn, uint32_t *sse,
+                                      int *sum) {
+  constexpr hn::CappedTag<int16_t, BlockWidth> d16;
+  constexpr hn::Rebind<uint8_t, decltype(d16)> d8;
+  constexpr hn::RepartitionToWide<decltype(d16)> d32;
+  constexpr int kLanes = hn::MaxLanes(d16);
+  constexpr int kNumVecs = BlockWidth / kLanes;
+  // Each 16-bit lane of the running sum gains kNumVecs differences of up to
+  // 255 in magnitude per row, so widen it before 128 of them pile up.
+  constexpr int kRowsPerFlush = AOMMIN(BlockHeight, 128 / kNumVecs);
+  static_assert(BlockHeight % kRowsPerFlush == 0 && kRowsPerFlush % 2 == 0,
+                "Rows must be processed in whole pairs of flush groups.");
+  const auto one = hn::Set(d16, 1);
+  auto sum32 = hn::Zero(d32);
+  auto sse0 = hn::Zero(d32);
+  auto sse1 = hn::Zero(d32);
+  hn::VFromD<decltype(d16)> pred[kNumVecs];
+  for (int i = 0; i < BlockHeight; i += kRowsPerFlush) {
+    auto sum16 = hn::Zero(d16);
+    // Alternate between two sse accumulators so consecutive rows do not wait
+    // on each other's multiply-accumulate.
+    for (int k = 0; k < kRowsPerFlush; k += 2) {
+      pred_fn(pred);
+      for (int j = 0; j < kNumVecs; ++j) {
+        const auto r = hn::PromoteTo(d16, hn::LoadU(d8, ref + j * kLanes));
+        const auto diff = hn::Sub(pred[j], r);
+        sum16 = hn::Add(sum16, diff);
+        sse0 = hn::ReorderWidenMulAccumulate(d32, diff, diff, sse0, sse1);
+      }
+      ref += ref_stride;
+      pred_fn(pred);
+      for (int j = 0; j < kNumVecs; ++j) {
+        const auto r = hn::PromoteTo(d16, hn::LoadU(d8, ref + j * kLanes));
+        const auto diff = hn::Sub(pred[j], r);
+        sum16 = hn::Add(sum16, diff);
+        sse1 = hn::ReorderWidenMulAccumulate(d32, diff, diff, sse1, sse0);
+      }
+      ref += ref_stride;
+    }
+    sum32 = hn::Add(sum32, hn::WidenMulPairwiseAdd(d32, sum16, one));
+  }
+  *sse = static_cast<uint32_t>(hn::ReduceSum(d32, hn::Add(sse0, sse1)));
+  *sum = hn::ReduceSum(d32, sum32);
+}
+
+template <int BlockWidth, int BlockHeight>
+HWY_MAYBE_UNUSED unsigned int Variance(const uint8_t *src, int src_stride,
+                                       const uint8_t *ref, int ref_stride,
+                                       unsigned int *sse) {
+  constexpr hn::CappedTag<int16_t, BlockWidth> d16;
+  constexpr hn::Rebind<uint8_t, decltype(d16)> d8;
+  constexpr int kLanes = hn::MaxLanes(d16);
+  constexpr int kNumVecs = BlockWidth / kLanes;
+  auto load_src = [&](hn::VFromD<decltype(d16)> *pred) HWY_ATTR {
+    for (int j = 0; j < kNumVecs; ++j) {
+      pred[j] = hn::PromoteTo(d16, hn::LoadU(d8, src + j * kLanes));
+    }
+    src += src_stride;
+  };
+  int sum;
+  VarianceRows<BlockWidth, BlockHeight>(ref, ref_stride, load_src, sse, &sum);
+  return *sse - static_cast<uint32_t>((static_cast<int64_t>(sum) * sum) /
+                                      (BlockWidth * BlockHeight));
+}
+
+// Returns ROUND_POWER_OF_TWO(a * (128 - f) + b * f, FILTER_BITS) where
+// |filter| holds f << 8. Since the taps sum to 128 this is a plus the rounded
+// (b - a) * f / 128, which is exactly what vpmulhrsw computes.
+template <class V>
+HWY_ATTR HWY_INLINE V BilinearFilter(V a, V b, V filter) {
+  return hn::Add(a, hn::MulFixedPoint15(hn::Sub(b, a), filter));
+}
+
+template <int BlockWidth, int BlockHeight, bool kFilterX, bool kFilterY,
+          bool kAvg>
+HWY_ATTR HWY_INLINE uint32_t SubpelVarianceImpl(
+    const uint8_t *src, int src_stride, int xoffset, int yoffset,
+    const uint8_t *ref, int ref_stride, uint32_t *sse,
+    const uint8_t *second_pred) {
+  using VI16 = hn::Vec<hn::CappedTag<int16_t, BlockWidth>>;
+  constexpr hn::CappedTag<int16_t, BlockWidth> d16;
+  constexpr hn::Rebind<uint8_t, decltype(d16)> d8;
+  constexpr int kLanes = hn::MaxLanes(d16);
+  constexpr int kNumVecs = BlockWidth / kLanes;
+  const auto filter_x = hn::Set(d16, bilinear_filters_2t[xoffset][1] << 8);
+  const auto filter_y = hn::Set(d16, bilinear_filters_2t[yoffset][1] << 8);
+  const auto one = hn::Set(d16, 1);
+
+  // Produces one horizontally filtered row, as the first pass of the C code.
+  auto filter_row = [&](VI16 *out) HWY_ATTR {
+    for (int j = 0; j < kNumVecs; ++j) {
+      const auto a = hn::PromoteTo(d16, hn::LoadU(d8, src + j * kLanes));
+      if (kFilterX) {
+        const auto b = hn::PromoteTo(d16, hn::LoadU(d8, src + j * kLanes + 1));
+        out[j] = BilinearFilter(a, b, filter_x);
+      } else {
+        out[j] = a;
+      }
+    }
+    src += src_stride;
+  };
+
+  VI16 prev[kNumVecs];
+  if (kFilterY) filter_row(prev);
+  auto predict_row = [&](VI16 *pred) HWY_ATTR {
+    if (kFilterY) {
+      VI16 cur[kNumVecs];
+      filter_row(cur);
+      for (int j = 0; j < kNumVecs; ++j) {
+        pred[j] = BilinearFilter(prev[j], cur[j], filter_y);
+        prev[j] = cur[j];
+      }
+    } else {
+      filter_row(pred);
+    }
+    if (kAvg) {
+      for (int j = 0; j < kNumVecs; ++j) {
+        const auto p =
+            hn::PromoteTo(d16, hn::LoadU(d8, second_pred + j * kLanes));
+        pred[j] = hn::ShiftRight<1>(hn::Add(hn::Add(pred[j], p), one));
+      }
+      second_pred += BlockWidth;
+    }
+  };
+
+  int sum;
+  VarianceRows<BlockWidth, BlockHeight>(ref, ref_stride, predict_row, sse,
+                                        &sum);
+  return *sse - static_cast<uint32_t>((static_cast<int64_t>(sum) * sum) /
+                                      (BlockWidth * BlockHeight));
+}
+
+// Filters in a single pass, skipping either direction whose offset is zero
+// since the corresponding bilinear filter is the identity.
+template <int BlockWidth, int BlockHeight, bool kAvg>
+HWY_MAYBE_UNUSED uint32_t SubpelVariance(const uint8_t *src, int src_stride,
+                                         int xoffset, int yoffset,
+                                         const uint8_t *ref, int ref_stride,
+                                         uint32_t *sse,
+                                         const uint8_t *second_pred) {
+  if (xoffset == 0) {
+    if (yoffset == 0) {
+      return SubpelVarianceImpl<BlockWidth, BlockHeight, false, false, kAvg>(
+          src, src_stride, xoffset, yoffset, ref, ref_stride, sse,
+          second_pred);
+    }
+    return SubpelVarianceImpl<BlockWidth, BlockHeight, false, true, kAvg>(
+        src, src_stride, xoffset, yoffset, ref, ref_stride, sse, second_pred);
+  }
+  if (yoffset == 0) {
+    return SubpelVarianceImpl<BlockWidth, BlockHeight, true, false, kAvg>(
+        src, src_stride, xoffset, yoffset, ref, ref_stride, sse, second_pred);
+  }
+  return SubpelVarianceImpl<BlockWidth, BlockHeight, true, true, kAvg>(
+      src, src_stride, xoffset, yoffset, ref, ref_stride, sse, second_pred);
+}
+
+template <int BlockWidth, int BlockHeight, int BitDepth>
+HWY_MAYBE_UNUSED uint32_t HighbdVariance(const uint8_t *src8, int src_stride,
+                                         const uint8_t *ref8, int ref_stride,
+                                         uint32_t *sse) {
+  constexpr hn::CappedTag<int16_t, BlockWidth> d16;
+  constexpr hn::RepartitionToWide<decltype(d16)> d32;
+  constexpr hn::Repartition<uint32_t, decltype(d16)> du32;
+  constexpr int kLanes = hn::MaxLanes(d16);
+  constexpr int kNumVecs = BlockWidth / kLanes;
+  // A 12-bit squared difference pair can reach 2 * 4095^2, so the 32-bit sse
+  // accumulators are widened to 64 bits every 64 / kNumVecs rows. Lower bit
+  // depths cannot overflow within a 128x128 block.
+  constexpr int kRowsPerFlush =
+      BitDepth == 12 ? AOMMIN(BlockHeight, 64 / kNumVecs) : BlockHeight;
+  static_assert(BlockHeight % kRowsPerFlush == 0 && kRowsPerFlush % 2 == 0,
+                "Rows must be processed in whole pairs of flush groups.");
+  const int16_t *src = reinterpret_cast<const int16_t *>(
+      CONVERT_TO_SHORTPTR(src8));
+  const int16_t *ref = reinterpret_cast<const int16_t *>(
+      CONVERT_TO_SHORTPTR(ref8));
+  const auto one = hn::Set(d16, 1);
+  auto sum0 = hn::Zero(d32);
+  auto sum1 = hn::Zero(d32);
+  auto sse64 = hn::Zero(hn::RepartitionToWide<decltype(du32)>());
+  for (int i = 0; i < BlockHeight; i += kRowsPerFlush) {
+    auto sse0 = hn::Zero(d32);
+    auto sse1 = hn::Zero(d32);
+    for (int k = 0; k < kRowsPerFlush; k += 2) {
+      for (int j = 0; j < kNumVecs; ++j) {
+        const auto diff = hn::Sub(hn::LoadU(d16, src + j * kLanes),
+                                  hn::LoadU(d16, ref + j * kLanes));
+        sum0 = hn::ReorderWidenMulAccumulate(d32, diff, one, sum0, sum1);
+        sse0 = hn::ReorderWidenMulAccumulate(d32, diff, diff, sse0, sse1);
+      }
+      src += src_stride;
+      ref += ref_stride;
+      for (int j = 0; j < kNumVecs; ++j) {
+        const auto diff = hn::Sub(hn::LoadU(d16, src + j * kLanes),
+                                  hn::LoadU(d16, ref + j * kLanes));
+        sum1 = hn::ReorderWidenMulAccumulate(d32, diff, one, sum1, sum0);
+        sse1 = hn::ReorderWidenMulAccumulate(d32, diff, diff, sse1, sse0);
+      }
+      src += src_stride;
+      ref += ref_stride;
+    }
+    sse64 = hn::Add(sse64, hn::SumsOf2(hn::BitCast(du32, hn::Add(sse0, sse1))));
+  }
+  const uint64_t sse_long =
+      hn::ReduceSum(hn::RepartitionToWide<decltype(du32)>(), sse64);
+  const int64_t sum_long = hn::ReduceSum(d32, hn::Add(sum0, sum1));
+  int sum;
+  if (BitDepth == 8) {
+    *sse = static_cast<uint32_t>(sse_long);
+    sum = static_cast<int>(sum_long);
+    return *sse - static_cast<uint32_t>((static_cast<int64_t>(sum) * sum) /
+                                        (BlockWidth * BlockHeight));
+  }
+  constexpr int kSseShift = 2 * (BitDepth - 8);
+  constexpr int kSumShift = BitDepth - 8;
+  *sse = static_cast<uint32_t>(ROUND_POWER_OF_TWO(sse_long, kSseShift));
+  sum = static_cast<int>(ROUND_POWER_OF_TWO(sum_long, kSumShift));
+  const int64_t var = static_cast<int64_t>(*sse) -
+                      ((static_cast<int64_t>(sum) * sum) /
+                       (BlockWidth * BlockHeight));
+  return var >= 0 ? static_cast<uint32_t>(var) : 0;
+}
+
+}  // namespace HWY_NAMESPACE
+}  // namespace
+
+#define FVARIANCE(w, h, suffix)                                               \
+  extern "C" unsigned int aom_variance##w##x##h##_##suffix(                   \
+      const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr,      \
+      int ref_stride, unsigned int *sse);                                     \
+  HWY_ATTR unsigned int aom_variance##w##x##h##_##suffix(                     \
+      const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr,      \
+      int ref_stride, unsigned int *sse) {                                    \
+    return HWY_NAMESPACE::Variance<w, h>(src_ptr, source_stride, ref_ptr,     \
+                                         ref_stride, sse);                    \
+  }
+
+#define FSUBPEL_VARIANCE(w, h, suffix)                                        \
+  extern "C" uint32_t aom_sub_pixel_variance##w##x##h##_##suffix(             \
+      const uint8_t *src_ptr, int source_stride, int xoffset, int yoffset,    \
+      const uint8_t *ref_ptr, int ref_stride, uint32_t *sse);                 \
+  HWY_ATTR uint32_t aom_sub_pixel_variance##w##x##h##_##suffix(               \
+      const uint8_t *src_ptr, int source_stride, int xoffset, int yoffset,    \
+      const uint8_t *ref_ptr, int ref_stride, uint32_t *sse) {                \
+    return HWY_NAMESPACE::SubpelVariance<w, h, false>(                        \
+        src_ptr, source_stride, xoffset, yoffset, ref_ptr, ref_stride, sse,   \
+        nullptr);                                                             \
+  }
+
+#define FSUBPEL_AVG_VARIANCE(w, h, suffix)                                    \
+  extern "C" uint32_t aom_sub_pixel_avg_variance##w##x##h##_##suffix(         \
+      const uint8_t *src_ptr, int source_stride, int xoffset, int yoffset,    \
+      const uint8_t *ref_ptr, int ref_stride, uint32_t *sse,                  \
+      const uint8_t *second_pred);                                            \
+  HWY_ATTR uint32_t aom_sub_pixel_avg_variance##w##x##h##_##suffix(           \
+      const uint8_t *src_ptr, int source_stride, int xoffset, int yoffset,    \
+      const uint8_t *ref_ptr, int ref_stride, uint32_t *sse,                  \
+      const uint8_t *second_pred) {                                           \
+    return HWY_NAMESPACE::SubpelVariance<w, h, true>(                         \
+        src_ptr, source_stride, xoffset, yoffset, ref_ptr, ref_stride, sse,   \
+        second_pred);                                                         \
+  }
+
+#define FHIGHBD_VARIANCE_BD(w, h, bd, suffix)                                 \
+  extern "C" uint32_t aom_highbd_##bd##_variance##w##x##h##_##suffix(         \
+      const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr,      \
+      int ref_stride, uint32_t *sse);                                         \
+  HWY_ATTR uint32_t aom_highbd_##bd##_variance##w##x##h##_##suffix(           \
+      const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr,      \
+      int ref_stride, uint32_t *sse) {                                        \
+    return HWY_NAMESPACE::HighbdVariance<w, h, bd>(src_ptr, source_stride,    \
+                                                   ref_ptr, ref_stride, sse); \
+  }
+
+#define FHIGHBD_VARIANCE(w, h, suffix)  \
+  FHIGHBD_VARIANCE_BD(w, h, 8, suffix)  \
+  FHIGHBD_VARIANCE_BD(w, h, 10, suffix) \
+  FHIGHBD_VARIANCE_BD(w, h, 12, suffix)
+
+#define FOR_EACH_VARIANCE_BLOCK_SIZE(X, suffix) \
+  X(128, 128, suffix)                           \
+  X(128, 64, suffix)                            \
+  X(64, 128, suffix)                            \
+  X(64, 64, suffix)                             \
+  X(64, 32, suffix)                             \
+  X(32, 64, suffix)                             \
+  X(32, 32, suffix)                             \
+  X(32, 16, suffix)
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // AOM_AOM_DSP_VARIANCE_HWY_H_
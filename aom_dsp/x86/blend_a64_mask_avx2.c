@@ -20,6 +20,7 @@
 
 #include "aom_dsp/x86/synonyms.h"
 #include "aom_dsp/x86/synonyms_avx2.h"
+#include "aom_dsp/x86/blend_avx2.h"
 #include "aom_dsp/x86/blend_sse4.h"
 #include "aom_dsp/x86/blend_mask_sse4.h"
 
@@ -1369,4 +1370,183 @@ void aom_highbd_blend_a64_d16_mask_avx2(
                                     subh, conv_params, bd);
   }
 }
+
+//////////////////////////////////////////////////////////////////////////////
+// aom_highbd_blend_a64_mask_avx2()
+//////////////////////////////////////////////////////////////////////////////
+
+// Each of the kernels below blends 16 pixels of a row per iteration; the
+// variants only differ in how the 16 mask values are derived.
+
+static inline void highbd_blend_a64_mask_w16n_avx2(
+    uint16_t *dst, uint32_t dst_stride, const uint16_t *src0,
+    uint32_t src0_stride, const uint16_t *src1, uint32_t src1_stride,
+    const uint8_t *mask, uint32_t mask_stride, int w, int h,
+    blend_unit_avx2_fn blend) {
+  const __m256i v_maxval_w = _mm256_set1_epi16(AOM_BLEND_A64_MAX_ALPHA);
+
+  do {
+    for (int c = 0; c < w; c += 16) {
+      const __m256i v_m0_w = _mm256_cvtepu8_epi16(xx_loadu_128(mask + c));
+      const __m256i v_m1_w = _mm256_sub_epi16(v_maxval_w, v_m0_w);
+
+      yy_storeu_256(dst + c, blend(src0 + c, src1 + c, v_m0_w, v_m1_w));
+    }
+    dst += dst_stride;
+    src0 += src0_stride;
+    src1 += src1_stride;
+    mask += mask_stride;
+  } while (--h);
+}
+
+static inline void highbd_blend_a64_mask_sx_w16n_avx2(
+    uint16_t *dst, uint32_t dst_stride, const uint16_t *src0,
+    uint32_t src0_stride, const uint16_t *src1, uint32_t src1_stride,
+    const uint8_t *mask, uint32_t mask_stride, int w, int h,
+    blend_unit_avx2_fn blend) {
+  const __m256i v_maxval_w = _mm256_set1_epi16(AOM_BLEND_A64_MAX_ALPHA);
+  const __m256i v_one_b = _mm256_set1_epi8(1);
+
+  do {
+    for (int c = 0; c < w; c += 16) {
+      // Horizontal pair sums; the in-lane madd keeps the output in order.
+      const __m256i v_r_b = yy_loadu_256(mask + 2 * c);
+      const __m256i v_s_w = _mm256_maddubs_epi16(v_r_b, v_one_b);
+      const __m256i v_m0_w = yy_roundn_epu16(v_s_w, 1);
+      const __m256i v_m1_w = _mm256_sub_epi16(v_maxval_w, v_m0_w);
+
+      yy_storeu_256(dst + c, blend(src0 + c, src1 + c, v_m0_w, v_m1_w));
+    }
+    dst += dst_stride;
+    src0 += src0_stride;
+    src1 += src1_stride;
+    mask += mask_stride;
+  } while (--h);
+}
+
+static inline void highbd_blend_a64_mask_sy_w16n_avx2(
+    uint16_t *dst, uint32_t dst_stride, const uint16_t *src0,
+    uint32_t src0_stride, const uint16_t *src1, uint32_t src1_stride,
+    const uint8_t *mask, uint32_t mask_stride, int w, int h,
+    blend_unit_avx2_fn blend) {
+  const __m256i v_maxval_w = _mm256_set1_epi16(AOM_BLEND_A64_MAX_ALPHA);
+
+  do {
+    for (int c = 0; c < w; c += 16) {
+      const __m256i v_ra_w = _mm256_cvtepu8_epi16(xx_loadu_128(mask + c));
+      const __m256i v_rb_w =
+          _mm256_cvtepu8_epi16(xx_loadu_128(mask + mask_stride + c));
+      const __m256i v_m0_w =
+          yy_roundn_epu16(_mm256_add_epi16(v_ra_w, v_rb_w), 1);
+      const __m256i v_m1_w = _mm256_sub_epi16(v_maxval_w, v_m0_w);
+
+      yy_storeu_256(dst + c, blend(src0 + c, src1 + c, v_m0_w, v_m1_w));
+    }
+    dst += dst_stride;
+    src0 += src0_stride;
+    src1 += src1_stride;
+    mask += 2 * mask_stride;
+  } while (--h);
+}
+
+static inline void highbd_blend_a64_mask_sx_sy_w16n_avx2(
+    uint16_t *dst, uint32_t dst_stride, const uint16_t *src0,
+    uint32_t src0_stride, const uint16_t *src1, uint32_t src1_stride,
+    const uint8_t *mask, uint32_t mask_stride, int w, int h,
+    blend_unit_avx2_fn blend) {
+  const __m256i v_maxval_w = _mm256_set1_epi16(AOM_BLEND_A64_MAX_ALPHA);
+  const __m256i v_one_b = _mm256_set1_epi8(1);
+
+  do {
+    for (int c = 0; c < w; c += 16) {
+      const __m256i v_ra_b = yy_loadu_256(mask + 2 * c);
+      const __m256i v_rb_b = yy_loadu_256(mask + mask_stride + 2 * c);
+      const __m256i v_s_w =
+          _mm256_add_epi16(_mm256_maddubs_epi16(v_ra_b, v_one_b),
+                           _mm256_maddubs_epi16(v_rb_b, v_one_b));
+      const __m256i v_m0_w = yy_roundn_epu16(v_s_w, 2);
+      const __m256i v_m1_w = _mm256_sub_epi16(v_maxval_w, v_m0_w);
+
+      yy_storeu_256(dst + c, blend(src0 + c, src1 + c, v_m0_w, v_m1_w));
+    }
+    dst += dst_stride;
+    src0 += src0_stride;
+    src1 += src1_stride;
+    mask += 2 * mask_stride;
+  } while (--h);
+}
+
+void aom_highbd_blend_a64_mask_avx2(uint8_t *dst_8, uint32_t dst_stride,
+                                    const uint8_t *src0_8,
+                                    uint32_t src0_stride,
+                                    const uint8_t *src1_8,
+                                    uint32_t src1_stride, const uint8_t *mask,
+                                    uint32_t mask_stride, int w, int h,
+                                    int subw, int subh, int bd) {
+  assert(IMPLIES(src0_8 == dst_8, src0_stride == dst_stride));
+  assert(IMPLIES(src1_8 == dst_8, src1_stride == dst_stride));
+
+  assert(h >= 1);
+  assert(w >= 1);
+  assert(IS_POWER_OF_TWO(h));
+  assert(IS_POWER_OF_TWO(w));
+
+  assert(bd == 8 || bd == 10 || bd == 12);
+
+  if (w < 16) {
+    // Narrow blocks gain nothing from the wider registers.
+    aom_highbd_blend_a64_mask_sse4_1(dst_8, dst_stride, src0_8, src0_stride,
+                                     src1_8, src1_stride, mask, mask_stride, w,
+                                     h, subw, subh, bd);
+    return;
+  }
+
+  uint16_t *const dst = CONVERT_TO_SHORTPTR(dst_8);
+  const uint16_t *const src0 = CONVERT_TO_SHORTPTR(src0_8);
+  const uint16_t *const src1 = CONVERT_TO_SHORTPTR(src1_8);
+
+  if (subw && subh) {
+    if (bd == 12) {
+      highbd_blend_a64_mask_sx_sy_w16n_avx2(dst, dst_stride, src0, src0_stride,
+                                            src1, src1_stride, mask,
+                                            mask_stride, w, h,
+                                            blend_16_b12_avx2);
+    } else {
+      highbd_blend_a64_mask_sx_sy_w16n_avx2(dst, dst_stride, src0, src0_stride,
+                                            src1, src1_stride, mask,
+                                            mask_stride, w, h,
+                                            blend_16_b10_avx2);
+    }
+  } else if (subw) {
+    if (bd == 12) {
+      highbd_blend_a64_mask_sx_w16n_avx2(dst, dst_stride, src0, src0_stride,
+                                         src1, src1_stride, mask, mask_stride,
+                                         w, h, blend_16_b12_avx2);
+    } else {
+      highbd_blend_a64_mask_sx_w16n_avx2(dst, dst_stride, src0, src0_stride,
+                                         src1, src1_stride, mask, mask_stride,
+                                         w, h, blend_16_b10_avx2);
+    }
+  } else if (subh) {
+    if (bd == 12) {
+      highbd_blend_a64_mask_sy_w16n_avx2(dst, dst_stride, src0, src0_stride,
+                                         src1, src1_stride, mask, mask_stride,
+                                         w, h, blend_16_b12_avx2);
+    } else {
+      highbd_blend_a64_mask_sy_w16n_avx2(dst, dst_stride, src0, src0_stride,
+                                         src1, src1_stride, mask, mask_stride,
+                                         w, h, blend_16_b10_avx2);
+    }
+  } else {
+    if (bd == 12) {
+      highbd_blend_a64_mask_w16n_avx2(dst, dst_stride, src0, src0_stride, src1,
+                                      src1_stride, mask, mask_stride, w, h,
+                                      blend_16_b12_avx2);
+    } else {
+      highbd_blend_a64_mask_w16n_avx2(dst, dst_stride, src0, src0_stride, src1,
+                                      src1_stride, mask, mask_stride, w, h,
+                                      blend_16_b10_avx2);
+    }
+  }
+}
 #endif  // CONFIG_AV1_HIGHBITDEPTH
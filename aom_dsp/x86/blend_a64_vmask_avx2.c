@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <immintrin.h>  // AVX2
+
+#include <assert.h>
+
+#include "aom/aom_integer.h"
+#include "aom_ports/mem.h"
+#include "aom_dsp/aom_dsp_common.h"
+#include "aom_dsp/blend.h"
+
+#include "aom_dsp/x86/synonyms.h"
+#include "aom_dsp/x86/synonyms_avx2.h"
+#include "aom_dsp/x86/blend_avx2.h"
+
+#include "config/aom_dsp_rtcd.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// Low bitdepth
+//////////////////////////////////////////////////////////////////////////////
+
+// Returns the (m, AOM_BLEND_A64_MAX_ALPHA - m) byte pair that weights
+// interleaved src0/src1 bytes in _mm256_maddubs_epi16().
+static inline int16_t vmask_pair(uint8_t m) {
+  return (int16_t)(m | ((AOM_BLEND_A64_MAX_ALPHA - m) << 8));
+}
+
+// Blends two rows of 16 pixels per iteration, one row per 128-bit lane.
+static void blend_a64_vmask_w16_avx2(uint8_t *dst, uint32_t dst_stride,
+                                     const uint8_t *src0, uint32_t src0_stride,
+                                     const uint8_t *src1, uint32_t src1_stride,
+                                     const uint8_t *mask, int h) {
+  do {
+    const __m256i v_m_b = yy_set_m128i(_mm_set1_epi16(vmask_pair(mask[1])),
+                                       _mm_set1_epi16(vmask_pair(mask[0])));
+    const __m256i v_s0_b = yy_loadu2_128(src0 + src0_stride, src0);
+    const __m256i v_s1_b = yy_loadu2_128(src1 + src1_stride, src1);
+
+    const __m256i v_p0_w =
+        _mm256_maddubs_epi16(_mm256_unpacklo_epi8(v_s0_b, v_s1_b), v_m_b);
+    const __m256i v_p1_w =
+        _mm256_maddubs_epi16(_mm256_unpackhi_epi8(v_s0_b, v_s1_b), v_m_b);
+
+    const __m256i v_res0_w = yy_roundn_epu16(v_p0_w, AOM_BLEND_A64_ROUND_BITS);
+    const __m256i v_res1_w = yy_roundn_epu16(v_p1_w, AOM_BLEND_A64_ROUND_BITS);
+    const __m256i v_res_b = _mm256_packus_epi16(v_res0_w, v_res1_w);
+
+    yy_storeu2_128(dst + dst_stride, dst, v_res_b);
+
+    dst += 2 * dst_stride;
+    src0 += 2 * src0_stride;
+    src1 += 2 * src1_stride;
+    mask += 2;
+    h -= 2;
+  } while (h > 0);
+}
+
+static void blend_a64_vmask_w32n_avx2(uint8_t *dst, uint32_t dst_stride,
+                                      const uint8_t *src0, uint32_t src0_stride,
+                                      const uint8_t *src1, uint32_t src1_stride,
+                                      const uint8_t *mask, int w, int h) {
+  do {
+    const __m256i v_m_b = _mm256_set1_epi16(vmask_pair(*mask));
+    for (int c = 0; c < w; c += 32) {
+      const __m256i v_s0_b = yy_loadu_256(src0 + c);
+      const __m256i v_s1_b = yy_loadu_256(src1 + c);
+
+      const __m256i v_p0_w =
+          _mm256_maddubs_epi16(_mm256_unpacklo_epi8(v_s0_b, v_s1_b), v_m_b);
+      const __m256i v_p1_w =
+          _mm256_maddubs_epi16(_mm256_unpackhi_epi8(v_s0_b, v_s1_b), v_m_b);
+
+      const __m256i v_res0_w =
+          yy_roundn_epu16(v_p0_w, AOM_BLEND_A64_ROUND_BITS);
+      const __m256i v_res1_w =
+          yy_roundn_epu16(v_p1_w, AOM_BLEND_A64_ROUND_BITS);
+
+      // The in-lane pack undoes the in-lane interleave above.
+      yy_storeu_256(dst + c, _mm256_packus_epi16(v_res0_w, v_res1_w));
+    }
+    dst += dst_stride;
+    src0 += src0_stride;
+    src1 += src1_stride;
+    mask += 1;
+  } while (--h);
+}
+
+void aom_blend_a64_vmask_avx2(uint8_t *dst, uint32_t dst_stride,
+                              const uint8_t *src0, uint32_t src0_stride,
+                              const uint8_t *src1, uint32_t src1_stride,
+                              const uint8_t *mask, int w, int h) {
+  assert(IMPLIES(src0 == dst, src0_stride == dst_stride));
+  assert(IMPLIES(src1 == dst, src1_stride == dst_stride));
+
+  assert(h >= 1);
+  assert(w >= 1);
+  assert(IS_POWER_OF_TWO(h));
+  assert(IS_POWER_OF_TWO(w));
+
+  if (w < 16 || (w == 16 && h == 1)) {
+    aom_blend_a64_vmask_sse4_1(dst, dst_stride, src0, src0_stride, src1,
+                               src1_stride, mask, w, h);
+  } else if (w == 16) {
+    blend_a64_vmask_w16_avx2(dst, dst_stride, src0, src0_stride, src1,
+                             src1_stride, mask, h);
+  } else {
+    blend_a64_vmask_w32n_avx2(dst, dst_stride, src0, src0_stride, src1,
+                              src1_stride, mask, w, h);
+  }
+}
+
+#if CONFIG_AV1_HIGHBITDEPTH
+//////////////////////////////////////////////////////////////////////////////
+// High bitdepth
+//////////////////////////////////////////////////////////////////////////////
+
+static inline void highbd_blend_a64_vmask_w16n_avx2(
+    uint16_t *dst, uint32_t dst_stride, const uint16_t *src0,
+    uint32_t src0_stride, const uint16_t *src1, uint32_t src1_stride,
+    const uint8_t *mask, int w, int h, blend_unit_avx2_fn blend) {
+  const __m256i v_maxval_w = _mm256_set1_epi16(AOM_BLEND_A64_MAX_ALPHA);
+
+  do {
+    const __m256i v_m0_w = _mm256_set1_epi16(*mask);
+    const __m256i v_m1_w = _mm256_sub_epi16(v_maxval_w, v_m0_w);
+    for (int c = 0; c < w; c += 16) {
+      yy_storeu_256(dst + c, blend(src0 + c, src1 + c, v_m0_w, v_m1_w));
+    }
+    dst += dst_stride;
+    src0 += src0_stride;
+    src1 += src1_stride;
+    mask += 1;
+  } while (--h);
+}
+
+void aom_highbd_blend_a64_vmask_avx2(
+    uint8_t *dst_8, uint32_t dst_stride, const uint8_t *src0_8,
+    uint32_t src0_stride, const uint8_t *src1_8, uint32_t src1_stride,
+    const uint8_t *mask, int w, int h, int bd) {
+  assert(IMPLIES(src0_8 == dst_8, src0_stride == dst_stride));
+  assert(IMPLIES(src1_8 == dst_8, src1_stride == dst_stride));
+
+  assert(h >= 1);
+  assert(w >= 1);
+  assert(IS_POWER_OF_TWO(h));
+  assert(IS_POWER_OF_TWO(w));
+
+  assert(bd == 8 || bd == 10 || bd == 12);
+
+  if (w < 16) {
+    aom_highbd_blend_a64_vmask_sse4_1(dst_8, dst_stride, src0_8, src0_stride,
+                                      src1_8, src1_stride, mask, w, h, bd);
+    return;
+  }
+
+  uint16_t *const dst = CONVERT_TO_SHORTPTR(dst_8);
+  const uint16_t *const src0 = CONVERT_TO_SHORTPTR(src0_8);
+  const uint16_t *const src1 = CONVERT_TO_SHORTPTR(src1_8);
+
+  if (bd == 12) {
+    highbd_blend_a64_vmask_w16n_avx2(dst, dst_stride, src0, src0_stride, src1,
+                                     src1_stride, mask, w, h,
+                                     blend_16_b12_avx2);
+  } else {
+    highbd_blend_a64_vmask_w16n_avx2(dst, dst_stride, src0, src0_stride, src1,
+                                     src1_stride, mask, w, h,
+                                     blend_16_b10_avx2);
+  }
+}
+#endif  // CONFIG_AV1_HIGHBITDEPTH
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#ifndef AOM_AOM_DSP_X86_BLEND_AVX2_H_
+#define AOM_AOM_DSP_X86_BLEND_AVX2_H_
+
+#include <immintrin.h>
+
+#include "aom_dsp/blend.h"
+#include "aom_dsp/x86/synonyms_avx2.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// Common high bitdepth kernels
+//////////////////////////////////////////////////////////////////////////////
+
+typedef __m256i (*blend_unit_avx2_fn)(const uint16_t *src0,
+                                      const uint16_t *src1,
+                                      const __m256i v_m0_w,
+                                      const __m256i v_m1_w);
+
+// Blends 16 pixels of up to 10 bits. The weighted sum is at most
+// 1023 * AOM_BLEND_A64_MAX_ALPHA, so it fits in an unsigned 16-bit lane.
+static inline __m256i blend_16_b10_avx2(const uint16_t *src0,
+                                        const uint16_t *src1,
+                                        const __m256i v_m0_w,
+                                        const __m256i v_m1_w) {
+  const __m256i v_s0_w = yy_loadu_256(src0);
+  const __m256i v_s1_w = yy_loadu_256(src1);
+
+  const __m256i v_p0_w = _mm256_mullo_epi16(v_s0_w, v_m0_w);
+  const __m256i v_p1_w = _mm256_mullo_epi16(v_s1_w, v_m1_w);
+
+  const __m256i v_sum_w = _mm256_add_epi16(v_p0_w, v_p1_w);
+
+  return yy_roundn_epu16(v_sum_w, AOM_BLEND_A64_ROUND_BITS);
+}
+
+// Blends 16 pixels of 12 bits, which needs 32-bit intermediates.
+static inline __m256i blend_16_b12_avx2(const uint16_t *src0,
+                                        const uint16_t *src1,
+                                        const __m256i v_m0_w,
+                                        const __m256i v_m1_w) {
+  const __m256i v_s0_w = yy_loadu_256(src0);
+  const __m256i v_s1_w = yy_loadu_256(src1);
+  const __m256i v_round_d =
+      _mm256_set1_epi32((1 << AOM_BLEND_A64_ROUND_BITS) >> 1);
+
+  // Interleave
+  const __m256i v_m01l_w = _mm256_unpacklo_epi16(v_m0_w, v_m1_w);
+  const __m256i v_m01h_w = _mm256_unpackhi_epi16(v_m0_w, v_m1_w);
+  const __m256i v_s01l_w = _mm256_unpacklo_epi16(v_s0_w, v_s1_w);
+  const __m256i v_s01h_w = _mm256_unpackhi_epi16(v_s0_w, v_s1_w);
+
+  // Multiply-Add
+  const __m256i v_suml_d = _mm256_madd_epi16(v_s01l_w, v_m01l_w);
+  const __m256i v_sumh_d = _mm256_madd_epi16(v_s01h_w, v_m01h_w);
+
+  // Round
+  const __m256i v_resl_d = _mm256_srli_epi32(
+      _mm256_add_epi32(v_suml_d, v_round_d), AOM_BLEND_A64_ROUND_BITS);
+  const __m256i v_resh_d = _mm256_srli_epi32(
+      _mm256_add_epi32(v_sumh_d, v_round_d), AOM_BLEND_A64_ROUND_BITS);
+
+  // Pack. This undoes the in-lane interleave above.
+  return _mm256_packus_epi32(v_resl_d, v_resh_d);
+}
+
+#endif  // AOM_AOM_DSP_X86_BLEND_AVX2_H_
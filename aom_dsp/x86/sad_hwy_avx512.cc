@@ -20,3 +20,12 @@ FOR_EACH_SAD_BLOCK_SIZE(FSAD_AVG, avx512)
 FOR_EACH_SAD_BLOCK_SIZE(FSAD_4D, avx512)
 FOR_EACH_SAD_BLOCK_SIZE(FSAD_4D_SKIP, avx512)
 FOR_EACH_SAD_BLOCK_SIZE(FSAD_3D, avx512)
+
+#if CONFIG_AV1_HIGHBITDEPTH
+FOR_EACH_HIGHBD_SAD_BLOCK_SIZE(FHIGHBD_SAD, avx512)
+FOR_EACH_HIGHBD_SAD_BLOCK_SIZE(FHIGHBD_SAD_SKIP, avx512)
+FOR_EACH_HIGHBD_SAD_BLOCK_SIZE(FHIGHBD_SAD_AVG, avx512)
+FOR_EACH_HIGHBD_SAD_BLOCK_SIZE(FHIGHBD_SAD_4D, avx512)
+FOR_EACH_HIGHBD_SAD_BLOCK_SIZE(FHIGHBD_SAD_4D_SKIP, avx512)
+FOR_EACH_HIGHBD_SAD_BLOCK_SIZE(FHIGHBD_SAD_3D, avx512)
+#endif  // CONFIG_AV1_HIGHBITDEPTH
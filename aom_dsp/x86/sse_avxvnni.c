@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <immintrin.h>
+
+#include "config/aom_config.h"
+#include "config/aom_dsp_rtcd.h"
+
+#include "aom_dsp/x86/synonyms.h"
+#include "aom_dsp/x86/synonyms_avx2.h"
+
+static inline __m256i abs_diff_u8_avx2(__m256i a, __m256i b) {
+  return _mm256_or_si256(_mm256_subs_epu8(a, b), _mm256_subs_epu8(b, a));
+}
+
+// The squared difference only depends on |a - b|, which fits in 8 bits, so
+// two unpacks against zero widen 32 pixels instead of the four needed to
+// widen a and b separately.
+static inline __m256i sse_w32_avxvnni(__m256i sum, const uint8_t *a,
+                                      const uint8_t *b) {
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i v_d = abs_diff_u8_avx2(yy_loadu_256(a), yy_loadu_256(b));
+  const __m256i v_d0_w = _mm256_unpacklo_epi8(v_d, zero);
+  const __m256i v_d1_w = _mm256_unpackhi_epi8(v_d, zero);
+  sum = _mm256_dpwssd_avx_epi32(sum, v_d0_w, v_d0_w);
+  return _mm256_dpwssd_avx_epi32(sum, v_d1_w, v_d1_w);
+}
+
+static inline int64_t summary_all_avxvnni(__m256i sum0, __m256i sum1,
+                                          __m256i sum2, __m256i sum3) {
+  // A 128x128 block puts at most 128 * 128 * 255 * 255 / 8 into each lane,
+  // so the 32-bit sums below cannot wrap.
+  const __m256i sum = _mm256_add_epi32(_mm256_add_epi32(sum0, sum1),
+                                       _mm256_add_epi32(sum2, sum3));
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i sum_4x64 = _mm256_add_epi64(_mm256_unpacklo_epi32(sum, zero),
+                                            _mm256_unpackhi_epi32(sum, zero));
+  const __m128i sum_2x64 = _mm_add_epi64(_mm256_castsi256_si128(sum_4x64),
+                                         _mm256_extracti128_si256(sum_4x64, 1));
+  const __m128i sum_1x64 = _mm_add_epi64(sum_2x64, _mm_srli_si128(sum_2x64, 8));
+  int64_t result;
+  xx_storel_64(&result, sum_1x64);
+  return result;
+}
+
+// Rows are processed four at a time, each into its own accumulator, so that
+// the vpdpwssd latency is hidden behind independent dependency chains.
+int64_t aom_sse_avxvnni(const uint8_t *a, int a_stride, const uint8_t *b,
+                        int b_stride, int width, int height) {
+  // Narrower blocks are dominated by the per-row overhead, where the AVX2
+  // kernel is as fast.
+  if ((width & 31) != 0 || (height & 3) != 0) {
+    return aom_sse_avx2(a, a_stride, b, b_stride, width, height);
+  }
+  __m256i sum0 = _mm256_setzero_si256();
+  __m256i sum1 = _mm256_setzero_si256();
+  __m256i sum2 = _mm256_setzero_si256();
+  __m256i sum3 = _mm256_setzero_si256();
+  int y = 0;
+  do {
+    for (int x = 0; x < width; x += 32) {
+      sum0 = sse_w32_avxvnni(sum0, a + x, b + x);
+      sum1 = sse_w32_avxvnni(sum1, a + a_stride + x, b + b_stride + x);
+      sum2 = sse_w32_avxvnni(sum2, a + 2 * a_stride + x, b + 2 * b_stride + x);
+      sum3 = sse_w32_avxvnni(sum3, a + 3 * a_stride + x, b + 3 * b_stride + x);
+    }
+    a += a_stride << 2;
+    b += b_stride << 2;
+    y += 4;
+  } while (y < height);
+  return summary_all_avxvnni(sum0, sum1, sum2, sum3);
+}
@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#define HWY_BASELINE_TARGETS HWY_AVX3_DL
+#define HWY_BROKEN_32BIT 0
+
+#include "aom_dsp/variance_hwy.h"
+
+FOR_EACH_VARIANCE_BLOCK_SIZE(FVARIANCE, avx512)
+FOR_EACH_VARIANCE_BLOCK_SIZE(FSUBPEL_VARIANCE, avx512)
+FOR_EACH_VARIANCE_BLOCK_SIZE(FSUBPEL_AVG_VARIANCE, avx512)
+#if CONFIG_AV1_HIGHBITDEPTH
+FOR_EACH_VARIANCE_BLOCK_SIZE(FHIGHBD_VARIANCE, avx512)
+#endif  // CONFIG_AV1_HIGHBITDEPTH
@@ -37,46 +37,187 @@ static int check_size_argument_overflow(size_t nmemb, size_t size,
   return 1;
 }
 
-static size_t *GetMallocAddressLocation(void *const mem) {
-  return ((size_t *)mem) - 1;
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+
+#if defined(_WIN64)
+static size_t atomic_add(volatile size_t *p, size_t v) {
+  return (size_t)_InterlockedExchangeAdd64((volatile __int64 *)p, (__int64)v) +
+         v;
 }
 
-static void SetActualMallocAddress(void *const mem,
-                                   const void *const malloc_addr) {
-  size_t *const malloc_addr_location = GetMallocAddressLocation(mem);
-  *malloc_addr_location = (size_t)malloc_addr;
+static int atomic_cas(volatile size_t *p, size_t expected, size_t desired) {
+  return (size_t)_InterlockedCompareExchange64(
+             (volatile __int64 *)p, (__int64)desired, (__int64)expected) ==
+         expected;
+}
+#else
+static size_t atomic_add(volatile size_t *p, size_t v) {
+  return (size_t)_InterlockedExchangeAdd((volatile long *)p, (long)v) + v;
 }
 
-static void *GetActualMallocAddress(void *const mem) {
-  const size_t *const malloc_addr_location = GetMallocAddressLocation(mem);
-  return (void *)(*malloc_addr_location);
+static int atomic_cas(volatile size_t *p, size_t expected, size_t desired) {
+  return (size_t)_InterlockedCompareExchange(
+             (volatile long *)p, (long)desired, (long)expected) == expected;
 }
+#endif
 
-void *aom_memalign(size_t align, size_t size) {
+static size_t atomic_load(volatile size_t *p) { return *p; }
+#elif defined(__GNUC__)
+static size_t atomic_add(size_t *p, size_t v) {
+  return __atomic_add_fetch(p, v, __ATOMIC_RELAXED);
+}
+
+static int atomic_cas(size_t *p, size_t expected, size_t desired) {
+  return __atomic_compare_exchange_n(p, &expected, desired, /*weak=*/1,
+                                     __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+}
+
+static size_t atomic_load(size_t *p) {
+  return __atomic_load_n(p, __ATOMIC_RELAXED);
+}
+#else
+// The counts may be off if several threads allocate at the same time.
+static size_t atomic_add(size_t *p, size_t v) { return *p += v; }
+
+static int atomic_cas(size_t *p, size_t expected, size_t desired) {
+  if (*p != expected) return 0;
+  *p = desired;
+  return 1;
+}
+
+static size_t atomic_load(size_t *p) { return *p; }
+#endif
+
+typedef struct {
+  size_t live;
+  size_t peak;
+} MemCounter;
+
+// Indexed by aom_mem_tag_t. The last entry counts all tags together.
+static MemCounter mem_counters[AOM_MEM_TAG_COUNT + 1];
+
+static aom_mem_hooks_t mem_hooks;
+
+static void account_alloc(MemCounter *counter, size_t size) {
+  const size_t live = atomic_add(&counter->live, size);
+  size_t peak = atomic_load(&counter->peak);
+  while (live > peak && !atomic_cas(&counter->peak, peak, live)) {
+    peak = atomic_load(&counter->peak);
+  }
+}
+
+static void account_free(MemCounter *counter, size_t size) {
+  atomic_add(&counter->live, (size_t)0 - size);
+}
+
+// The bookkeeping stored in front of every allocation.
+typedef struct {
+  size_t tag;
+  size_t size;
+  size_t malloc_addr;
+} AllocInfo;
+
+static AllocInfo *GetAllocInfo(void *const mem) {
+  return ((AllocInfo *)mem) - 1;
+}
+
+void *aom_memalign_tagged(aom_mem_tag_t tag, size_t align, size_t size) {
   void *x = NULL;
+  assert(sizeof(AllocInfo) == ADDRESS_STORAGE_SIZE);
+  assert((int)tag >= 0 && tag < AOM_MEM_TAG_COUNT);
   if (!check_size_argument_overflow(1, size, align)) return NULL;
   const size_t aligned_size = size + GetAllocationPaddingSize(align);
-  void *const addr = malloc(aligned_size);
+  void *const addr = mem_hooks.alloc
+                         ? mem_hooks.alloc(mem_hooks.priv, aligned_size)
+                         : malloc(aligned_size);
   if (addr) {
     x = aom_align_addr((unsigned char *)addr + ADDRESS_STORAGE_SIZE, align);
-    SetActualMallocAddress(x, addr);
+    AllocInfo *const info = GetAllocInfo(x);
+    info->tag = tag;
+    info->size = aligned_size;
+    info->malloc_addr = (size_t)addr;
+    account_alloc(&mem_counters[tag], aligned_size);
+    account_alloc(&mem_counters[AOM_MEM_TAG_COUNT], aligned_size);
   }
   return x;
 }
 
-void *aom_malloc(size_t size) { return aom_memalign(DEFAULT_ALIGNMENT, size); }
+void *aom_malloc_tagged(aom_mem_tag_t tag, size_t size) {
+  return aom_memalign_tagged(tag, DEFAULT_ALIGNMENT, size);
+}
 
-void *aom_calloc(size_t num, size_t size) {
+void *aom_calloc_tagged(aom_mem_tag_t tag, size_t num, size_t size) {
   if (!check_size_argument_overflow(num, size, DEFAULT_ALIGNMENT)) return NULL;
   const size_t total_size = num * size;
-  void *const x = aom_malloc(total_size);
+  void *const x = aom_malloc_tagged(tag, total_size);
   if (x) memset(x, 0, total_size);
   return x;
 }
 
+void *aom_memalign(size_t align, size_t size) {
+  return aom_memalign_tagged(AOM_MEM_TAG_OTHER, align, size);
+}
+
+void *aom_malloc(size_t size) {
+  return aom_memalign_tagged(AOM_MEM_TAG_OTHER, DEFAULT_ALIGNMENT, size);
+}
+
+void *aom_calloc(size_t num, size_t size) {
+  return aom_calloc_tagged(AOM_MEM_TAG_OTHER, num, size);
+}
+
 void aom_free(void *memblk) {
   if (memblk) {
-    void *addr = GetActualMallocAddress(memblk);
-    free(addr);
+    const AllocInfo *const info = GetAllocInfo(memblk);
+    void *const addr = (void *)info->malloc_addr;
+    account_free(&mem_counters[info->tag], info->size);
+    account_free(&mem_counters[AOM_MEM_TAG_COUNT], info->size);
+    if (mem_hooks.free) {
+      mem_hooks.free(mem_hooks.priv, addr);
+    } else {
+      free(addr);
+    }
+  }
+}
+
+void aom_mem_set_tag(void *memblk, aom_mem_tag_t tag) {
+  assert((int)tag >= 0 && tag < AOM_MEM_TAG_COUNT);
+  if (memblk == NULL) return;
+  AllocInfo *const info = GetAllocInfo(memblk);
+  if (info->tag == (size_t)tag) return;
+  account_free(&mem_counters[info->tag], info->size);
+  account_alloc(&mem_counters[tag], info->size);
+  info->tag = tag;
+}
+
+int aom_mem_set_hooks(const aom_mem_hooks_t *hooks) {
+  if (hooks != NULL && (hooks->alloc == NULL || hooks->free == NULL)) {
+    return -1;
+  }
+  // Memory must be freed by the hooks it was allocated with.
+  if (atomic_load(&mem_counters[AOM_MEM_TAG_COUNT].live) != 0) return -1;
+  if (hooks != NULL) {
+    mem_hooks = *hooks;
+  } else {
+    memset(&mem_hooks, 0, sizeof(mem_hooks));
+  }
+  return 0;
+}
+
+int aom_mem_get_usage(aom_mem_tag_t tag, aom_mem_usage_t *usage) {
+  if ((int)tag < 0 || tag > AOM_MEM_TAG_COUNT || usage == NULL) return -1;
+  usage->live_bytes = atomic_load(&mem_counters[tag].live);
+  usage->peak_bytes = atomic_load(&mem_counters[tag].peak);
+  return 0;
+}
+
+void aom_mem_reset_peak_usage(void) {
+  for (int i = 0; i <= AOM_MEM_TAG_COUNT; ++i) {
+    MemCounter *const counter = &mem_counters[i];
+    size_t peak = atomic_load(&counter->peak);
+    while (!atomic_cas(&counter->peak, peak, atomic_load(&counter->live))) {
+      peak = atomic_load(&counter->peak);
+    }
   }
 }
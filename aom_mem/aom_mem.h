@@ -15,6 +15,7 @@
 #include <assert.h>
 
 #include "aom/aom_integer.h"
+#include "aom/aom_memory.h"
 #include "config/aom_config.h"
 
 #if defined(__uClinux__)
@@ -39,6 +40,16 @@ void *aom_malloc(size_t size);
 void *aom_calloc(size_t num, size_t size);
 void aom_free(void *memblk);
 
+// Like the functions above, but account the memory to the given subsystem
+// instead of AOM_MEM_TAG_OTHER.
+void *aom_memalign_tagged(aom_mem_tag_t tag, size_t align, size_t size);
+void *aom_malloc_tagged(aom_mem_tag_t tag, size_t size);
+void *aom_calloc_tagged(aom_mem_tag_t tag, size_t num, size_t size);
+
+// Accounts memory allocated by the functions above to another subsystem. Used
+// for buffers allocated by shared helpers such as aom_realloc_frame_buffer().
+void aom_mem_set_tag(void *memblk, aom_mem_tag_t tag);
+
 static inline void *aom_memset16(void *dest, int val, size_t length) {
   size_t i;
   uint16_t *dest16 = (uint16_t *)dest;
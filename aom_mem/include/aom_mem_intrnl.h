@@ -14,7 +14,9 @@
 
 #include "config/aom_config.h"
 
-#define ADDRESS_STORAGE_SIZE sizeof(size_t)
+// Each allocation is preceded by the address returned by the allocator, the
+// number of bytes allocated and the aom_mem_tag_t the bytes are accounted to.
+#define ADDRESS_STORAGE_SIZE (3 * sizeof(size_t))
 
 #ifndef DEFAULT_ALIGNMENT
 #if defined(VXWORKS)
@@ -168,6 +168,7 @@ static inline uint64_t xgetbv(void) {
 #define HAS_AVX2 0x80
 #define HAS_SSE4_2 0x100
 #define HAS_AVX512 0x200
+#define HAS_AVXVNNI 0x400
 
 #ifndef BIT
 #define BIT(n) (1u << (n))
@@ -191,6 +192,8 @@ static inline uint64_t xgetbv(void) {
 // 14 (AVX512-POPCNTDQ)
 #define AVX512_DL_BITS \
   (BIT(1) | BIT(6) | BIT(8) | BIT(9) | BIT(10) | BIT(11) | BIT(12) | BIT(14))
+// Bit 4 (AVX-VNNI) of leaf 7, sub-leaf 1, register eax
+#define AVXVNNI_BITS BIT(4)
 
 #define FEATURE_SET(reg, feature) \
   (((reg) & (feature##_BITS)) == (feature##_BITS))
@@ -243,6 +246,13 @@ static inline int x86_simd_caps(void) {
                   ? HAS_AVX512
                   : 0;
         }
+        // AVX-VNNI is the VEX-encoded form of the AVX512-VNNI dot products and
+        // only needs YMM state. It is reported independently of AVX512, so
+        // AVX512 cores do not necessarily have it.
+        if ((flags & HAS_AVX2) && reg_eax >= 1) {
+          cpuid(7, 1, reg_eax, reg_ebx, reg_ecx, reg_edx);
+          flags |= FEATURE_SET(reg_eax, AVXVNNI) ? HAS_AVXVNNI : 0;
+        }
       }
     }
   }
@@ -129,7 +129,8 @@ static int realloc_frame_buffer_aligned(
 
       if (frame_size != (size_t)frame_size) return AOM_CODEC_MEM_ERROR;
 
-      ybf->buffer_alloc = (uint8_t *)aom_memalign(32, (size_t)frame_size);
+      ybf->buffer_alloc = (uint8_t *)aom_memalign_tagged(
+          AOM_MEM_TAG_FRAME_BUFFERS, 32, (size_t)frame_size);
       if (!ybf->buffer_alloc) return AOM_CODEC_MEM_ERROR;
 
       ybf->buffer_alloc_sz = (size_t)frame_size;
@@ -469,6 +469,7 @@ static const arg_def_t *const av1_key_val_args[] = {
   &g_av1_codec_arg_defs.kf_max_pyr_height,
   &g_av1_codec_arg_defs.auto_tiles,
   &g_av1_codec_arg_defs.screen_detection_mode,
+  &g_av1_codec_arg_defs.max_memory,
   &g_av1_codec_arg_defs.sharpness,
   &g_av1_codec_arg_defs.enable_adaptive_sharpness,
   NULL,
@@ -1545,6 +1546,28 @@ static void initialize_encoder(struct stream_state *stream,
     ctx_exit_on_error(&stream->encoder, "Failed to set codec option");
   }
 
+  aom_memory_budget_info_t budget_info;
+  AOM_CODEC_CONTROL_TYPECHECKED(&stream->encoder, AV1E_GET_MEMORY_BUDGET_INFO,
+                                &budget_info);
+  ctx_exit_on_error(&stream->encoder, "Failed to get memory budget info");
+  if (budget_info.degradations) {
+    fprintf(stderr, "Memory budget: %.1f MiB, lag in frames %u,%s%s%s%s\n",
+            budget_info.estimated_bytes / (1024.0 * 1024.0),
+            budget_info.lag_in_frames,
+            (budget_info.degradations & AOM_MEM_BUDGET_COARSE_TPL)
+                ? " 32x32 TPL statistics,"
+                : "",
+            (budget_info.degradations & AOM_MEM_BUDGET_NO_GLOBAL_MOTION)
+                ? " global motion disabled,"
+                : "",
+            (budget_info.degradations & AOM_MEM_BUDGET_SHORT_LAG)
+                ? " lag in frames reduced,"
+                : "",
+            (budget_info.degradations & AOM_MEM_BUDGET_EXCEEDED)
+                ? " budget exceeded"
+                : " within budget");
+  }
+
 #if CONFIG_TUNE_VMAF
   if (stream->config.vmaf_model_path) {
     AOM_CODEC_CONTROL_TYPECHECKED(&stream->encoder, AV1E_SET_VMAF_MODEL_PATH,
@@ -721,5 +721,10 @@ const av1_codec_arg_definitions_t g_av1_codec_arg_defs = {
       "Screen content detection mode (1: standard (default in good quality and "
       "realtime modes), 2: anti-aliased text and graphics aware (default in "
       "all intra mode))"),
+  .max_memory = ARG_DEF(
+      NULL, "max-memory", 1,
+      "Memory budget of the encoder in MiB (0: no budget (default)). The "
+      "encoder uses coarser TPL statistics, disables global motion and "
+      "shortens the lag in frames as needed to fit in the budget"),
 #endif  // CONFIG_AV1_ENCODER
 };
@@ -93,6 +93,10 @@ list(APPEND AOM_AV1_COMMON_SOURCES
             "${AOM_ROOT}/av1/common/warped_motion.h")
 
 if(CONFIG_HIGHWAY)
+  list(APPEND AOM_AV1_COMMON_SOURCES
+              "${AOM_ROOT}/av1/common/av1_inv_txfm2d_hwy.h")
+  list(APPEND AOM_AV1_COMMON_SOURCES "${AOM_ROOT}/av1/common/cdef_block_hwy.h")
+  list(APPEND AOM_AV1_COMMON_SOURCES "${AOM_ROOT}/av1/common/convolve_hwy.h")
   list(APPEND AOM_AV1_COMMON_SOURCES "${AOM_ROOT}/av1/common/selfguided_hwy.h")
   list(APPEND AOM_AV1_COMMON_SOURCES "${AOM_ROOT}/av1/common/warp_plane_hwy.h")
 endif()
@@ -193,6 +197,8 @@ list(APPEND AOM_AV1_ENCODER_SOURCES
             "${AOM_ROOT}/av1/encoder/mcomp.c"
             "${AOM_ROOT}/av1/encoder/mcomp.h"
             "${AOM_ROOT}/av1/encoder/mcomp_structs.h"
+            "${AOM_ROOT}/av1/encoder/mem_budget.c"
+            "${AOM_ROOT}/av1/encoder/mem_budget.h"
             "${AOM_ROOT}/av1/encoder/ml.c"
             "${AOM_ROOT}/av1/encoder/ml.h"
             "${AOM_ROOT}/av1/encoder/model_rd.h"
@@ -315,7 +321,9 @@ list(APPEND AOM_AV1_COMMON_INTRIN_AVX2
             "${AOM_ROOT}/av1/common/x86/cfl_avx2.c"
             "${AOM_ROOT}/av1/common/x86/convolve_2d_avx2.c"
             "${AOM_ROOT}/av1/common/x86/convolve_avx2.c"
+            "${AOM_ROOT}/av1/common/x86/filterintra_avx2.c"
             "${AOM_ROOT}/av1/common/x86/highbd_inv_txfm_avx2.c"
+            "${AOM_ROOT}/av1/common/x86/intra_edge_avx2.c"
             "${AOM_ROOT}/av1/common/x86/jnt_convolve_avx2.c"
             "${AOM_ROOT}/av1/common/x86/reconinter_avx2.c"
             "${AOM_ROOT}/av1/common/x86/resize_avx2.c"
@@ -329,6 +337,9 @@ if(CONFIG_HIGHWAY)
   list(APPEND AOM_AV1_COMMON_INTRIN_AVX2
               "${AOM_ROOT}/av1/common/x86/warp_plane_hwy_avx2.cc")
   list(APPEND AOM_AV1_COMMON_INTRIN_AVX512
+              "${AOM_ROOT}/av1/common/x86/av1_inv_txfm2d_hwy_avx512.cc"
+              "${AOM_ROOT}/av1/common/x86/cdef_block_hwy_avx512.cc"
+              "${AOM_ROOT}/av1/common/x86/convolve_hwy_avx512.cc"
               "${AOM_ROOT}/av1/common/x86/selfguided_hwy_avx512.cc"
               "${AOM_ROOT}/av1/common/x86/warp_plane_hwy_avx512.cc")
 endif()
@@ -340,6 +351,9 @@ list(APPEND AOM_AV1_ENCODER_INTRIN_SSE2
             "${AOM_ROOT}/av1/encoder/x86/av1_fwd_txfm_sse2.c"
             "${AOM_ROOT}/av1/encoder/x86/av1_fwd_txfm_sse2.h"
             "${AOM_ROOT}/av1/encoder/x86/av1_k_means_sse2.c"
+            "${AOM_ROOT}/av1/encoder/x86/dwt_sse2.c"
+            "${AOM_ROOT}/av1/encoder/x86/palette_sse2.c"
+            "${AOM_ROOT}/av1/encoder/x86/palette_x86.h"
             "${AOM_ROOT}/av1/encoder/x86/av1_quantize_sse2.c"
             "${AOM_ROOT}/av1/encoder/x86/encodetxb_sse2.c"
             "${AOM_ROOT}/av1/encoder/x86/error_intrin_sse2.c"
@@ -375,7 +389,10 @@ list(APPEND AOM_AV1_ENCODER_INTRIN_AVX2
             "${AOM_ROOT}/av1/encoder/x86/wedge_utils_avx2.c"
             "${AOM_ROOT}/av1/encoder/x86/encodetxb_avx2.c"
             "${AOM_ROOT}/av1/encoder/x86/rdopt_avx2.c"
+            "${AOM_ROOT}/av1/encoder/x86/reconinter_enc_avx2.c"
             "${AOM_ROOT}/av1/encoder/x86/av1_k_means_avx2.c"
+            "${AOM_ROOT}/av1/encoder/x86/dwt_avx2.c"
+            "${AOM_ROOT}/av1/encoder/x86/palette_avx2.c"
             "${AOM_ROOT}/av1/encoder/x86/temporal_filter_avx2.c"
             "${AOM_ROOT}/av1/encoder/x86/pickrst_avx2.c")
 
@@ -522,6 +539,9 @@ if(CONFIG_AV1_TEMPORAL_DENOISING)
   list(APPEND AOM_AV1_ENCODER_INTRIN_SSE2
               "${AOM_ROOT}/av1/encoder/x86/av1_temporal_denoiser_sse2.c")
 
+  list(APPEND AOM_AV1_ENCODER_INTRIN_AVX2
+              "${AOM_ROOT}/av1/encoder/x86/av1_temporal_denoiser_avx2.c")
+
   list(APPEND AOM_AV1_ENCODER_INTRIN_NEON
               "${AOM_ROOT}/av1/encoder/arm/av1_temporal_denoiser_neon.c")
 endif()
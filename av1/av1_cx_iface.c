@@ -47,6 +47,7 @@
 #include "av1/encoder/external_partition.h"
 #include "av1/encoder/firstpass.h"
 #include "av1/encoder/lookahead.h"
+#include "av1/encoder/mem_budget.h"
 #include "av1/encoder/rc_utils.h"
 #include "av1/arg_defs.h"
 
@@ -247,6 +248,7 @@ struct av1_extracfg {
   int sb_qp_sweep;
   aom_screen_detection_mode screen_detection_mode;
   unsigned int validate_input_hbd;
+  unsigned int max_memory_mb;
 };
 
 #if !CONFIG_REALTIME_ONLY
@@ -404,6 +406,7 @@ static const struct av1_extracfg default_extra_cfg = {
   0,               // sb_qp_sweep
   AOM_SCREEN_DETECTION_STANDARD,
   1,  // validate_input_hbd
+  0,  // max_memory_mb
 };
 #else
 // Some settings are changed for realtime only build.
@@ -561,6 +564,7 @@ static const struct av1_extracfg default_extra_cfg = {
   0,               // sb_qp_sweep
   AOM_SCREEN_DETECTION_STANDARD,
   1,  // validate_input_hbd
+  0,  // max_memory_mb
 };
 #endif
 
@@ -590,6 +594,14 @@ struct aom_codec_alg_priv {
   int num_lap_buffers;
   STATS_BUFFER_CTX stats_buf_context;
   bool monochrome_on_init;
+  aom_zero_copy_input_t zero_copy_input;
+  // The input image of the current encoder_encode() call until it is handed
+  // to the lookahead queue, in zero-copy input mode.
+  const aom_image_t *unreleased_input;
+  // The memory budget chosen by apply_memory_budget().
+  size_t mem_budget_estimate;
+  unsigned int mem_budget_degradations;
+  int mem_budget_lag_in_frames;
 };
 
 static inline int gcd(int64_t a, int b) {
@@ -1357,6 +1369,7 @@ static void set_encoder_config(AV1EncoderConfig *oxcf,
   // TODO(any): Fix and Enable TPL for resize-mode > 0
   algo_cfg->enable_tpl_model =
       resize_cfg->resize_mode ? 0 : extra_cfg->enable_tpl_model;
+  algo_cfg->coarse_tpl_stats = false;
   algo_cfg->loopfilter_control = extra_cfg->loopfilter_control;
   algo_cfg->skip_postproc_filtering = extra_cfg->skip_postproc_filtering;
   algo_cfg->screen_detection_mode = extra_cfg->screen_detection_mode;
@@ -1461,7 +1474,7 @@ static void set_encoder_config(AV1EncoderConfig *oxcf,
   // Temporal denoiser is for nonrd pickmode so disable it for speed < 7.
   // Also disable it for speed 7 for now since it needs to be modified for
   // the check_partition_merge_mode feature.
-  if (cfg->g_bit_depth == AOM_BITS_8 && oxcf->speed > 7) {
+  if (oxcf->speed > 7) {
     oxcf->noise_sensitivity = extra_cfg->noise_sensitivity;
   } else {
     oxcf->noise_sensitivity = 0;
@@ -1649,6 +1662,38 @@ AV1EncoderConfig av1_get_encoder_config(const aom_codec_enc_cfg_t *cfg) {
   return oxcf;
 }
 
+// Degrades ctx->oxcf to fit in the budget of AV1E_SET_MAX_MEMORY_MB. The
+// degradations are chosen until the lookahead is allocated, and reapplied
+// after that since the buffers they size are not reallocated.
+static void apply_memory_budget(aom_codec_alg_priv_t *ctx) {
+  AV1EncoderConfig *const oxcf = &ctx->oxcf;
+  if (ctx->ppi->lookahead == NULL) {
+    if (ctx->extra_cfg.max_memory_mb == 0) {
+      ctx->mem_budget_degradations = 0;
+      ctx->mem_budget_estimate =
+          av1_estimate_encoder_memory(oxcf, ctx->num_lap_buffers);
+    } else {
+      const size_t budget =
+          (size_t)AOMMIN(ctx->extra_cfg.max_memory_mb, SIZE_MAX >> 20) << 20;
+      ctx->mem_budget_degradations = av1_fit_memory_budget(
+          oxcf, ctx->num_lap_buffers, budget, &ctx->mem_budget_estimate);
+    }
+    ctx->mem_budget_lag_in_frames = oxcf->gf_cfg.lag_in_frames;
+    return;
+  }
+  const unsigned int degradations = ctx->mem_budget_degradations;
+  if (degradations & AOM_MEM_BUDGET_COARSE_TPL) {
+    oxcf->algo_cfg.coarse_tpl_stats = true;
+  }
+  if (degradations & AOM_MEM_BUDGET_NO_GLOBAL_MOTION) {
+    oxcf->tool_cfg.enable_global_motion = false;
+  }
+  if (degradations & AOM_MEM_BUDGET_SHORT_LAG) {
+    oxcf->gf_cfg.lag_in_frames =
+        AOMMIN(oxcf->gf_cfg.lag_in_frames, ctx->mem_budget_lag_in_frames);
+  }
+}
+
 static aom_codec_err_t encoder_set_config(aom_codec_alg_priv_t *ctx,
                                           const aom_codec_enc_cfg_t *cfg) {
   aom_codec_err_t res;
@@ -1699,6 +1744,7 @@ static aom_codec_err_t encoder_set_config(aom_codec_alg_priv_t *ctx,
   if (res == AOM_CODEC_OK) {
     ctx->cfg = *cfg;
     set_encoder_config(&ctx->oxcf, &ctx->cfg, &ctx->extra_cfg);
+    apply_memory_budget(ctx);
     // On profile change, request a key frame
     force_key |= ctx->ppi->seq_params.profile != ctx->oxcf.profile;
     bool is_sb_size_changed = false;
@@ -1765,6 +1811,7 @@ static aom_codec_err_t update_encoder_cfg(aom_codec_alg_priv_t *ctx) {
   if (ctx->ppi->cpi->svc.number_spatial_layers > 1)
     ctx->extra_cfg.noise_sensitivity = 0;
   set_encoder_config(&ctx->oxcf, &ctx->cfg, &ctx->extra_cfg);
+  apply_memory_budget(ctx);
   av1_check_fpmt_config(ctx->ppi, &ctx->oxcf);
   bool is_sb_size_changed = false;
   av1_change_config_seq(ctx->ppi, &ctx->oxcf, &is_sb_size_changed);
@@ -1922,6 +1969,37 @@ static aom_codec_err_t ctrl_set_validate_input_hbd(aom_codec_alg_priv_t *ctx,
   return update_extra_cfg(ctx, &extra_cfg);
 }
 
+static aom_codec_err_t ctrl_set_zero_copy_input(aom_codec_alg_priv_t *ctx,
+                                                va_list args) {
+  const aom_zero_copy_input_t *const zero_copy_input =
+      CAST(AV1E_SET_ZERO_COPY_INPUT, args);
+  if (zero_copy_input == NULL) return AOM_CODEC_INVALID_PARAM;
+  // The lookahead queue may already hold images pushed in the other mode.
+  if (ctx->ppi->lookahead != NULL) return AOM_CODEC_ERROR;
+  ctx->zero_copy_input = *zero_copy_input;
+  return AOM_CODEC_OK;
+}
+
+static aom_codec_err_t ctrl_set_max_memory_mb(aom_codec_alg_priv_t *ctx,
+                                             va_list args) {
+  // The lookahead has been allocated with the previous budget.
+  if (ctx->ppi->lookahead != NULL) return AOM_CODEC_ERROR;
+  struct av1_extracfg extra_cfg = ctx->extra_cfg;
+  extra_cfg.max_memory_mb = CAST(AV1E_SET_MAX_MEMORY_MB, args);
+  return update_extra_cfg(ctx, &extra_cfg);
+}
+
+static aom_codec_err_t ctrl_get_memory_budget_info(aom_codec_alg_priv_t *ctx,
+                                                   va_list args) {
+  aom_memory_budget_info_t *const info =
+      va_arg(args, aom_memory_budget_info_t *);
+  if (info == NULL) return AOM_CODEC_INVALID_PARAM;
+  info->estimated_bytes = ctx->mem_budget_estimate;
+  info->degradations = ctx->mem_budget_degradations;
+  info->lag_in_frames = ctx->oxcf.gf_cfg.lag_in_frames;
+  return AOM_CODEC_OK;
+}
+
 static aom_codec_err_t ctrl_set_arnr_max_frames(aom_codec_alg_priv_t *ctx,
                                                 va_list args) {
   struct av1_extracfg extra_cfg = ctx->extra_cfg;
@@ -3205,7 +3283,7 @@ static void destroy_extra_config(struct av1_extracfg *extra_cfg) {
 }
 
 static aom_codec_err_t encoder_destroy(aom_codec_alg_priv_t *ctx) {
-  free(ctx->cx_data);
+  aom_free(ctx->cx_data);
   destroy_extra_config(&ctx->extra_cfg);
 
   if (ctx->ppi) {
@@ -3213,7 +3291,7 @@ static aom_codec_err_t encoder_destroy(aom_codec_alg_priv_t *ctx) {
     av1_extrc_delete(&ppi->cpi->ext_ratectrl);
     for (int i = 0; i < MAX_PARALLEL_FRAMES - 1; i++) {
       if (ppi->parallel_frames_data[i].cx_data) {
-        free(ppi->parallel_frames_data[i].cx_data);
+        aom_free(ppi->parallel_frames_data[i].cx_data);
       }
     }
 #if CONFIG_ENTROPY_STATS
@@ -3271,13 +3349,91 @@ static inline int get_src_border_in_pixels(AV1_COMP *cpi, BLOCK_SIZE sb_size) {
   return border_in_pixels;
 }
 
+static void release_input_image(void *priv, const void *input_ref) {
+  aom_codec_alg_priv_t *const ctx = (aom_codec_alg_priv_t *)priv;
+  ctx->zero_copy_input.release_cb(ctx->zero_copy_input.priv,
+                                  (const aom_image_t *)input_ref);
+}
+
+// Returns where encoder_encode() writes the compressed data: straight into the
+// buffer set with aom_codec_set_cx_data_buf() if it can hold as much as
+// ctx->cx_data, or else ctx->cx_data.
+static unsigned char *get_cx_data_dst(const aom_codec_alg_priv_t *ctx) {
+  const aom_fixed_buf_t *const dst_buf = &ctx->base.enc.cx_data_dst_buf;
+  const size_t pad_before = ctx->base.enc.cx_data_pad_before;
+  // Invisible frames of earlier calls are pending in ctx->cx_data. Padding
+  // after the data is not supported, as the encoder may write past the end of
+  // the data while packing the bitstream.
+  if (dst_buf->buf == NULL || ctx->cx_data == NULL ||
+      ctx->pending_cx_data_sz != 0 || ctx->base.enc.cx_data_pad_after != 0 ||
+      dst_buf->sz < pad_before || dst_buf->sz - pad_before < ctx->cx_data_sz) {
+    return ctx->cx_data;
+  }
+  return (unsigned char *)dst_buf->buf + pad_before;
+}
+
+// Moves the invisible frames still pending at the end of an encoder_encode()
+// call to ctx->cx_data, where the next call expects them.
+static void keep_pending_cx_data(aom_codec_alg_priv_t *ctx,
+                                 const unsigned char *cx_data) {
+  if (cx_data != ctx->cx_data && ctx->pending_cx_data_sz != 0) {
+    memcpy(ctx->cx_data, cx_data, ctx->pending_cx_data_sz);
+  }
+}
+
+// Returns whether each plane of img, with the border image2yuvconfig() derived
+// from the stride, lies within the image allocation without overlapping the
+// others, so that the lookahead can extend the frame into that border.
+static bool input_border_is_allocated(const aom_image_t *img,
+                                      const YV12_BUFFER_CONFIG *sd) {
+  if (img->img_data == NULL || img->planes[AOM_PLANE_V] == NULL) return false;
+  const uintptr_t data_start = (uintptr_t)img->img_data;
+  const uintptr_t data_end = data_start + img->sz;
+  const int bytes_per_pixel = (img->fmt & AOM_IMG_FMT_HIGHBITDEPTH) ? 2 : 1;
+  uintptr_t start[3], end[3];
+  for (int plane = 0; plane < 3; plane++) {
+    const int is_uv = plane > 0;
+    const int border_x = sd->border >> (is_uv ? sd->subsampling_x : 0);
+    const int border_y = sd->border >> (is_uv ? sd->subsampling_y : 0);
+    const int stride = img->stride[plane];
+    const uintptr_t top_left = (uintptr_t)img->planes[plane];
+    const uintptr_t before = (uintptr_t)border_y * stride +
+                             (uintptr_t)border_x * bytes_per_pixel;
+    const uintptr_t after =
+        (uintptr_t)(sd->crop_heights[is_uv] + border_y - 1) * stride +
+        (uintptr_t)(sd->crop_widths[is_uv] + border_x) * bytes_per_pixel;
+    if (stride <= 0 || top_left < data_start + before ||
+        top_left + after > data_end) {
+      return false;
+    }
+    start[plane] = top_left - before;
+    end[plane] = top_left + after;
+  }
+  for (int i = 0; i < 3; i++) {
+    for (int j = i + 1; j < 3; j++) {
+      if (start[i] < end[j] && start[j] < end[i]) return false;
+    }
+  }
+  return true;
+}
+
+// Returns whether the lookahead may use img in place of a copy. It must not
+// when the encoder writes to its source frames.
+static bool input_can_be_used_in_place(const aom_codec_alg_priv_t *ctx,
+                                       const aom_image_t *img,
+                                       const YV12_BUFFER_CONFIG *sd) {
+  if (ctx->extra_cfg.tuning == AOM_TUNE_BUTTERAUGLI ||
+      ctx->extra_cfg.noise_sensitivity > 0) {
+    return false;
+  }
+  return input_border_is_allocated(img, sd);
+}
+
 // TODO(Mufaddal): Check feasibility of abstracting functions related to LAP
 // into a separate function.
-static aom_codec_err_t encoder_encode(aom_codec_alg_priv_t *ctx,
-                                      const aom_image_t *img,
-                                      aom_codec_pts_t pts,
-                                      unsigned long duration,
-                                      aom_enc_frame_flags_t enc_flags) {
+static aom_codec_err_t encoder_encode_internal(
+    aom_codec_alg_priv_t *ctx, const aom_image_t *img, aom_codec_pts_t pts,
+    unsigned long duration, aom_enc_frame_flags_t enc_flags) {
   const size_t kMinCompressedSize = 8192;
   volatile aom_codec_err_t res = AOM_CODEC_OK;
   AV1_PRIMARY *const ppi = ctx->ppi;
@@ -3327,8 +3483,9 @@ static aom_codec_err_t encoder_encode(aom_codec_alg_priv_t *ctx,
       if (data_sz < kMinCompressedSize) data_sz = kMinCompressedSize;
       if (ctx->cx_data == NULL || ctx->cx_data_sz < data_sz) {
         ctx->cx_data_sz = data_sz;
-        free(ctx->cx_data);
-        ctx->cx_data = (unsigned char *)malloc(ctx->cx_data_sz);
+        aom_free(ctx->cx_data);
+        ctx->cx_data = (unsigned char *)aom_malloc_tagged(AOM_MEM_TAG_BITSTREAM,
+                                                          ctx->cx_data_sz);
         if (ctx->cx_data == NULL) {
           ctx->cx_data_sz = 0;
           return AOM_CODEC_MEM_ERROR;
@@ -3338,10 +3495,12 @@ static aom_codec_err_t encoder_encode(aom_codec_alg_priv_t *ctx,
         if (ppi->parallel_frames_data[i].cx_data == NULL ||
             ppi->parallel_frames_data[i].cx_data_sz < data_sz) {
           ppi->parallel_frames_data[i].cx_data_sz = data_sz;
-          free(ppi->parallel_frames_data[i].cx_data);
+          aom_free(ppi->parallel_frames_data[i].cx_data);
           ppi->parallel_frames_data[i].frame_size = 0;
           ppi->parallel_frames_data[i].cx_data =
-              (unsigned char *)malloc(ppi->parallel_frames_data[i].cx_data_sz);
+              (unsigned char *)aom_malloc_tagged(
+                  AOM_MEM_TAG_BITSTREAM,
+                  ppi->parallel_frames_data[i].cx_data_sz);
           if (ppi->parallel_frames_data[i].cx_data == NULL) {
             ppi->parallel_frames_data[i].cx_data_sz = 0;
             return AOM_CODEC_MEM_ERROR;
@@ -3354,12 +3513,14 @@ static aom_codec_err_t encoder_encode(aom_codec_alg_priv_t *ctx,
   aom_codec_pkt_list_init(&ctx->pkt_list);
 
   volatile aom_enc_frame_flags_t flags = enc_flags;
+  unsigned char *const cx_data = get_cx_data_dst(ctx);
 
   // The jmp_buf is valid only for the duration of the function that calls
   // setjmp(). Therefore, this function must reset the 'setjmp' field to 0
   // before it returns.
   if (setjmp(ppi->error.jmp)) {
     ppi->error.setjmp = 0;
+    keep_pending_cx_data(ctx, cx_data);
     res = update_error_state(ctx, &ppi->error);
     return res;
   }
@@ -3488,13 +3649,22 @@ static aom_codec_err_t encoder_encode(aom_codec_alg_priv_t *ctx,
           ppi->parallel_cpi[i]->oxcf.border_in_pixels = oxcf->border_in_pixels;
         }
 
-        const int src_border_in_pixels = get_src_border_in_pixels(cpi, sb_size);
+        // In zero-copy input mode, the lookahead frames are laid out like the
+        // input images it can use in place, see AV1E_SET_ZERO_COPY_INPUT.
+        const int src_border_in_pixels =
+            ctx->zero_copy_input.release_cb
+                ? AOM_BORDER_IN_PIXELS
+                : get_src_border_in_pixels(cpi, sb_size);
         ppi->lookahead = av1_lookahead_init(
             cpi->oxcf.frm_dim_cfg.width, cpi->oxcf.frm_dim_cfg.height,
             subsampling_x, subsampling_y, use_highbitdepth, lag_in_frames,
             src_border_in_pixels, cpi->common.features.byte_alignment,
             ctx->num_lap_buffers, (cpi->oxcf.kf_cfg.key_freq_max == 0),
             cpi->alloc_pyramid);
+        if (ppi->lookahead && ctx->zero_copy_input.release_cb) {
+          av1_lookahead_set_release_fn(ppi->lookahead, release_input_image,
+                                       ctx);
+        }
       }
       if (!ppi->lookahead)
         aom_internal_error(&ppi->error, AOM_CODEC_MEM_ERROR,
@@ -3517,16 +3687,26 @@ static aom_codec_err_t encoder_encode(aom_codec_alg_priv_t *ctx,
         }
       }
 
+      // In zero-copy input mode, hand the image over to the lookahead if it
+      // may be used in place. Otherwise it is copied and released on return.
+      const aom_image_t *input_ref = NULL;
+      if (ctx->unreleased_input != NULL &&
+          input_can_be_used_in_place(ctx, img, &sd)) {
+        input_ref = img;
+        ctx->unreleased_input = NULL;
+      }
+
       // Store the original flags in to the frame buffer. Will extract the
       // key frame flag when we actually encode this frame.
       if (av1_receive_raw_frame(cpi, flags | ctx->next_frame_flags, &sd,
-                                src_time_stamp, src_end_time_stamp)) {
+                                src_time_stamp, src_end_time_stamp,
+                                input_ref)) {
         res = update_error_state(ctx, cpi->common.error);
       }
       ctx->next_frame_flags = 0;
     }
 
-    cpi_data.cx_data = ctx->cx_data;
+    cpi_data.cx_data = cx_data;
     cpi_data.cx_data_sz = ctx->cx_data_sz;
 
     /* Any pending invisible frames? */
@@ -3739,19 +3919,19 @@ static aom_codec_err_t encoder_encode(aom_codec_alg_priv_t *ctx,
           aom_internal_error(&ppi->error, AOM_CODEC_ERROR,
                              "ctx->cx_data buffer full");
         }
-        memmove(ctx->cx_data + move_offset, ctx->cx_data, cpi_data.frame_size);
+        memmove(cx_data + move_offset, cx_data, cpi_data.frame_size);
         obu_header_size = av1_write_obu_header(
             &ppi->level_params, &cpi->frame_header_count,
             OBU_TEMPORAL_DELIMITER,
             ppi->seq_params.has_nonzero_operating_point_idc,
-            /*is_layer_specific_obu=*/false, 0, ctx->cx_data);
+            /*is_layer_specific_obu=*/false, 0, cx_data);
         if (obu_header_size != 1) {
           aom_internal_error(&ppi->error, AOM_CODEC_ERROR, NULL);
         }
 
         // OBUs are preceded/succeeded by an unsigned leb128 coded integer.
         if (av1_write_uleb_obu_size(obu_payload_size,
-                                    ctx->cx_data + obu_header_size,
+                                    cx_data + obu_header_size,
                                     length_field_size) != AOM_CODEC_OK) {
           aom_internal_error(&ppi->error, AOM_CODEC_ERROR, NULL);
         }
@@ -3811,8 +3991,8 @@ static aom_codec_err_t encoder_encode(aom_codec_alg_priv_t *ctx,
           aom_internal_error(&ppi->error, AOM_CODEC_ERROR,
                              "ctx->cx_data buffer full");
         }
-        memmove(ctx->cx_data + length_field_size, ctx->cx_data, tu_size);
-        if (av1_write_uleb_obu_size(tu_size, ctx->cx_data, length_field_size) !=
+        memmove(cx_data + length_field_size, cx_data, tu_size);
+        if (av1_write_uleb_obu_size(tu_size, cx_data, length_field_size) !=
             AOM_CODEC_OK) {
           aom_internal_error(&ppi->error, AOM_CODEC_ERROR, NULL);
         }
@@ -3821,8 +4001,16 @@ static aom_codec_err_t encoder_encode(aom_codec_alg_priv_t *ctx,
 
       pkt.kind = AOM_CODEC_CX_FRAME_PKT;
 
-      pkt.data.frame.buf = ctx->cx_data;
-      pkt.data.frame.sz = ctx->pending_cx_data_sz;
+      if (cx_data == ctx->cx_data) {
+        pkt.data.frame.buf = ctx->cx_data;
+        pkt.data.frame.sz = ctx->pending_cx_data_sz;
+      } else {
+        // Like aom_codec_get_cx_data() does when it copies the packet, report
+        // the padding as part of the packet.
+        pkt.data.frame.buf = ctx->base.enc.cx_data_dst_buf.buf;
+        pkt.data.frame.sz =
+            ctx->base.enc.cx_data_pad_before + ctx->pending_cx_data_sz;
+      }
       pkt.data.frame.partition_id = -1;
       pkt.data.frame.vis_frame_size = cpi_data.frame_size;
 
@@ -3849,10 +4037,29 @@ static aom_codec_err_t encoder_encode(aom_codec_alg_priv_t *ctx,
     }
   }
 
+  keep_pending_cx_data(ctx, cx_data);
   ppi->error.setjmp = 0;
   return res;
 }
 
+static aom_codec_err_t encoder_encode(aom_codec_alg_priv_t *ctx,
+                                      const aom_image_t *img,
+                                      aom_codec_pts_t pts,
+                                      unsigned long duration,
+                                      aom_enc_frame_flags_t enc_flags) {
+  ctx->unreleased_input = ctx->zero_copy_input.release_cb ? img : NULL;
+  const aom_codec_err_t res =
+      encoder_encode_internal(ctx, img, pts, duration, enc_flags);
+  // Return an image the lookahead did not take, which is either copied or
+  // rejected by now.
+  if (ctx->unreleased_input != NULL) {
+    ctx->zero_copy_input.release_cb(ctx->zero_copy_input.priv,
+                                    ctx->unreleased_input);
+    ctx->unreleased_input = NULL;
+  }
+  return res;
+}
+
 static const aom_codec_cx_pkt_t *encoder_get_cxdata(aom_codec_alg_priv_t *ctx,
                                                     aom_codec_iter_t *iter) {
   return aom_codec_pkt_list_get(&ctx->pkt_list.head, iter);
@@ -4847,6 +5054,9 @@ static aom_codec_err_t encoder_set_option(aom_codec_alg_priv_t *ctx,
   } else if (arg_match_helper(&arg, &g_av1_codec_arg_defs.screen_detection_mode,
                               argv, err_string)) {
     extra_cfg.screen_detection_mode = arg_parse_int_helper(&arg, err_string);
+  } else if (arg_match_helper(&arg, &g_av1_codec_arg_defs.max_memory, argv,
+                              err_string)) {
+    extra_cfg.max_memory_mb = arg_parse_uint_helper(&arg, err_string);
   } else {
     match = 0;
     snprintf(err_string, ARG_ERR_MSG_MAX_LEN, "Cannot find aom option %s",
@@ -5072,6 +5282,8 @@ static aom_codec_ctrl_fn_map_t encoder_ctrl_maps[] = {
   { AV1E_SET_ENABLE_ADAPTIVE_SHARPNESS, ctrl_set_enable_adaptive_sharpness },
   { AV1E_SET_EXTERNAL_RATE_CONTROL, ctrl_set_external_rate_control },
   { AOME_SET_VALIDATE_INPUT_HBD, ctrl_set_validate_input_hbd },
+  { AV1E_SET_ZERO_COPY_INPUT, ctrl_set_zero_copy_input },
+  { AV1E_SET_MAX_MEMORY_MB, ctrl_set_max_memory_mb },
 
   // Getters
   { AOME_GET_LAST_QUANTIZER, ctrl_get_quantizer },
@@ -5091,6 +5303,7 @@ static aom_codec_ctrl_fn_map_t encoder_ctrl_maps[] = {
   { AV1E_GET_HIGH_MOTION_CONTENT_SCREEN_RTC,
     ctrl_get_high_motion_content_screen_rtc },
   { AV1E_GET_GOP_INFO, ctrl_get_gop_info },
+  { AV1E_GET_MEMORY_BUDGET_INFO, ctrl_get_memory_budget_info },
 
   CTRL_MAP_END,
 };
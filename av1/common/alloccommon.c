@@ -150,8 +150,10 @@ static inline void alloc_cdef_linebuf(AV1_COMMON *const cm, uint16_t **linebuf,
   CdefInfo *cdef_info = &cm->cdef_info;
   for (int plane = 0; plane < num_planes; plane++) {
     if (linebuf[plane] == NULL)
-      CHECK_MEM_ERROR(cm, linebuf[plane],
-                      aom_malloc(cdef_info->allocated_linebuf_size[plane]));
+      CHECK_MEM_ERROR(
+          cm, linebuf[plane],
+          aom_malloc_tagged(AOM_MEM_TAG_CDEF_LR,
+                            cdef_info->allocated_linebuf_size[plane]));
   }
 }
 
@@ -160,12 +162,15 @@ static inline void alloc_cdef_bufs(AV1_COMMON *const cm, uint16_t **colbuf,
   CdefInfo *cdef_info = &cm->cdef_info;
   if (*srcbuf == NULL)
     CHECK_MEM_ERROR(cm, *srcbuf,
-                    aom_memalign(16, cdef_info->allocated_srcbuf_size));
+                    aom_memalign_tagged(AOM_MEM_TAG_CDEF_LR, 16,
+                                        cdef_info->allocated_srcbuf_size));
 
   for (int plane = 0; plane < num_planes; plane++) {
     if (colbuf[plane] == NULL)
-      CHECK_MEM_ERROR(cm, colbuf[plane],
-                      aom_malloc(cdef_info->allocated_colbuf_size[plane]));
+      CHECK_MEM_ERROR(
+          cm, colbuf[plane],
+          aom_malloc_tagged(AOM_MEM_TAG_CDEF_LR,
+                            cdef_info->allocated_colbuf_size[plane]));
   }
 }
 
@@ -301,11 +306,14 @@ void av1_alloc_restoration_buffers(AV1_COMMON *cm, bool is_sgr_enabled) {
 
   if (cm->rst_tmpbuf == NULL && is_sgr_enabled) {
     CHECK_MEM_ERROR(cm, cm->rst_tmpbuf,
-                    (int32_t *)aom_memalign(16, RESTORATION_TMPBUF_SIZE));
+                    (int32_t *)aom_memalign_tagged(AOM_MEM_TAG_CDEF_LR, 16,
+                                                   RESTORATION_TMPBUF_SIZE));
   }
 
   if (cm->rlbs == NULL) {
-    CHECK_MEM_ERROR(cm, cm->rlbs, aom_malloc(sizeof(RestorationLineBuffers)));
+    CHECK_MEM_ERROR(cm, cm->rlbs,
+                    aom_malloc_tagged(AOM_MEM_TAG_CDEF_LR,
+                                      sizeof(RestorationLineBuffers)));
   }
 
   // For striped loop restoration, we divide each plane into "stripes",
@@ -336,10 +344,12 @@ void av1_alloc_restoration_buffers(AV1_COMMON *cm, bool is_sgr_enabled) {
       aom_free(boundaries->stripe_boundary_above);
       aom_free(boundaries->stripe_boundary_below);
 
-      CHECK_MEM_ERROR(cm, boundaries->stripe_boundary_above,
-                      (uint8_t *)aom_memalign(32, buf_size));
-      CHECK_MEM_ERROR(cm, boundaries->stripe_boundary_below,
-                      (uint8_t *)aom_memalign(32, buf_size));
+      CHECK_MEM_ERROR(
+          cm, boundaries->stripe_boundary_above,
+          (uint8_t *)aom_memalign_tagged(AOM_MEM_TAG_CDEF_LR, 32, buf_size));
+      CHECK_MEM_ERROR(
+          cm, boundaries->stripe_boundary_below,
+          (uint8_t *)aom_memalign_tagged(AOM_MEM_TAG_CDEF_LR, 32, buf_size));
 
       boundaries->stripe_boundary_size = buf_size;
     }
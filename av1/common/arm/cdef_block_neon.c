@@ -449,6 +449,15 @@ void cdef_find_dir_dual_neon(const uint16_t *img1, const uint16_t *img2,
   *out_dir_2nd_8x8 = cdef_find_dir(img2, stride, var_out_2nd, coeff_shift);
 }
 
+void cdef_find_dir_quad_neon(const uint16_t *const img[4], int stride,
+                             int32_t *const var[4], int coeff_shift,
+                             int *const dir[4]) {
+  cdef_find_dir_dual_neon(img[0], img[1], stride, var[0], var[1], coeff_shift,
+                          dir[0], dir[1]);
+  cdef_find_dir_dual_neon(img[2], img[3], stride, var[2], var[3], coeff_shift,
+                          dir[2], dir[3]);
+}
+
 // sign(a-b) * min(abs(a-b), max(0, threshold - (abs(a-b) >> adjdamp)))
 static inline int16x8_t constrain16(uint16x8_t a, uint16x8_t b,
                                     unsigned int threshold, int adjdamp) {
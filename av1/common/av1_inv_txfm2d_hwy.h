@@ -0,0 +1,2042 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#ifndef AOM_AV1_COMMON_AV1_INV_TXFM2D_HWY_H_
+#define AOM_AV1_COMMON_AV1_INV_TXFM2D_HWY_H_
+
+#include <assert.h>
+#include <stdint.h>
+
+#include "config/aom_config.h"
+#include "config/av1_rtcd.h"
+#include "third_party/highway/hwy/highway.h"
+#include "aom_ports/mem.h"
+#include "av1/common/av1_txfm.h"
+#include "av1/common/blockd.h"
+#include "av1/common/enums.h"
+#include "av1/common/idct.h"
+
+#define FOR_EACH_INV_TXFM2D(X, suffix) \
+  X(4, 4, suffix)                      \
+  X(8, 8, suffix)                      \
+  X(16, 16, suffix)                    \
+  X(32, 32, suffix)                    \
+  X(64, 64, suffix)                    \
+  X(4, 8, suffix)                      \
+  X(8, 4, suffix)                      \
+  X(8, 16, suffix)                     \
+  X(16, 8, suffix)                     \
+  X(16, 32, suffix)                    \
+  X(32, 16, suffix)                    \
+  X(32, 64, suffix)                    \
+  X(64, 32, suffix)                    \
+  X(4, 16, suffix)                     \
+  X(16, 4, suffix)                     \
+  X(8, 32, suffix)                     \
+  X(32, 8, suffix)                     \
+  X(16, 64, suffix)                    \
+  X(64, 16, suffix)
+
+#if HWY_CXX_LANG >= 201703L
+#define CONSTEXPR_IF constexpr
+#else
+#define CONSTEXPR_IF
+#endif
+
+HWY_BEFORE_NAMESPACE();
+
+namespace {
+namespace HWY_NAMESPACE {
+
+namespace hn = hwy::HWY_NAMESPACE;
+
+// The 1D transforms below follow av1_inv_txfm1d.c statement by statement,
+// with each lane holding one row (or column) of the block. All stages of a
+// pass share the same clamping range, see av1_gen_inv_stage_range().
+
+template <typename V>
+HWY_ATTR HWY_INLINE V ClampValue(V v, V lo, V hi) {
+  return hn::Min(hn::Max(v, lo), hi);
+}
+
+template <typename V>
+HWY_ATTR HWY_INLINE V RoundShift(V v, int bit) {
+  const hn::DFromV<V> d;
+  return hn::ShiftRightSame(hn::Add(v, hn::Set(d, 1 << (bit - 1))), bit);
+}
+
+// As explained in half_btf(), wrapping 32-bit arithmetic gives the same
+// result as the 64-bit intermediate of the C code for conformant input.
+template <typename V>
+HWY_ATTR HWY_INLINE V HalfBtf(int32_t w0, V in0, int32_t w1, V in1, int bit) {
+  const hn::DFromV<V> d;
+  const V sum = hn::MulAdd(hn::Set(d, w0), in0, hn::Mul(hn::Set(d, w1), in1));
+  return RoundShift(sum, bit);
+}
+
+template <typename V>
+HWY_ATTR HWY_INLINE void Idct4(const V *input, V *output, int8_t cos_bit,
+                               V clamp_lo, V clamp_hi) {
+  const int32_t *cospi = cospi_arr(cos_bit);
+
+  V *bf0, *bf1;
+  V step[4];
+
+  // stage 1;
+  bf1 = output;
+  bf1[0] = input[0];
+  bf1[1] = input[2];
+  bf1[2] = input[1];
+  bf1[3] = input[3];
+
+  // stage 2
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = HalfBtf(cospi[32], bf0[0], cospi[32], bf0[1], cos_bit);
+  bf1[1] = HalfBtf(cospi[32], bf0[0], -cospi[32], bf0[1], cos_bit);
+  bf1[2] = HalfBtf(cospi[48], bf0[2], -cospi[16], bf0[3], cos_bit);
+  bf1[3] = HalfBtf(cospi[16], bf0[2], cospi[48], bf0[3], cos_bit);
+
+  // stage 3
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = ClampValue(bf0[0] + bf0[3], clamp_lo, clamp_hi);
+  bf1[1] = ClampValue(bf0[1] + bf0[2], clamp_lo, clamp_hi);
+  bf1[2] = ClampValue(bf0[1] - bf0[2], clamp_lo, clamp_hi);
+  bf1[3] = ClampValue(bf0[0] - bf0[3], clamp_lo, clamp_hi);
+}
+
+template <typename V>
+HWY_ATTR HWY_INLINE void Idct8(const V *input, V *output, int8_t cos_bit,
+                               V clamp_lo, V clamp_hi) {
+  const int32_t *cospi = cospi_arr(cos_bit);
+
+  V *bf0, *bf1;
+  V step[8];
+
+  // stage 1;
+  bf1 = output;
+  bf1[0] = input[0];
+  bf1[1] = input[4];
+  bf1[2] = input[2];
+  bf1[3] = input[6];
+  bf1[4] = input[1];
+  bf1[5] = input[5];
+  bf1[6] = input[3];
+  bf1[7] = input[7];
+
+  // stage 2
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = bf0[0];
+  bf1[1] = bf0[1];
+  bf1[2] = bf0[2];
+  bf1[3] = bf0[3];
+  bf1[4] = HalfBtf(cospi[56], bf0[4], -cospi[8], bf0[7], cos_bit);
+  bf1[5] = HalfBtf(cospi[24], bf0[5], -cospi[40], bf0[6], cos_bit);
+  bf1[6] = HalfBtf(cospi[40], bf0[5], cospi[24], bf0[6], cos_bit);
+  bf1[7] = HalfBtf(cospi[8], bf0[4], cospi[56], bf0[7], cos_bit);
+
+  // stage 3
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = HalfBtf(cospi[32], bf0[0], cospi[32], bf0[1], cos_bit);
+  bf1[1] = HalfBtf(cospi[32], bf0[0], -cospi[32], bf0[1], cos_bit);
+  bf1[2] = HalfBtf(cospi[48], bf0[2], -cospi[16], bf0[3], cos_bit);
+  bf1[3] = HalfBtf(cospi[16], bf0[2], cospi[48], bf0[3], cos_bit);
+  bf1[4] = ClampValue(bf0[4] + bf0[5], clamp_lo, clamp_hi);
+  bf1[5] = ClampValue(bf0[4] - bf0[5], clamp_lo, clamp_hi);
+  bf1[6] = ClampValue(bf0[7] - bf0[6], clamp_lo, clamp_hi);
+  bf1[7] = ClampValue(bf0[6] + bf0[7], clamp_lo, clamp_hi);
+
+  // stage 4
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = ClampValue(bf0[0] + bf0[3], clamp_lo, clamp_hi);
+  bf1[1] = ClampValue(bf0[1] + bf0[2], clamp_lo, clamp_hi);
+  bf1[2] = ClampValue(bf0[1] - bf0[2], clamp_lo, clamp_hi);
+  bf1[3] = ClampValue(bf0[0] - bf0[3], clamp_lo, clamp_hi);
+  bf1[4] = bf0[4];
+  bf1[5] = HalfBtf(-cospi[32], bf0[5], cospi[32], bf0[6], cos_bit);
+  bf1[6] = HalfBtf(cospi[32], bf0[5], cospi[32], bf0[6], cos_bit);
+  bf1[7] = bf0[7];
+
+  // stage 5
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = ClampValue(bf0[0] + bf0[7], clamp_lo, clamp_hi);
+  bf1[1] = ClampValue(bf0[1] + bf0[6], clamp_lo, clamp_hi);
+  bf1[2] = ClampValue(bf0[2] + bf0[5], clamp_lo, clamp_hi);
+  bf1[3] = ClampValue(bf0[3] + bf0[4], clamp_lo, clamp_hi);
+  bf1[4] = ClampValue(bf0[3] - bf0[4], clamp_lo, clamp_hi);
+  bf1[5] = ClampValue(bf0[2] - bf0[5], clamp_lo, clamp_hi);
+  bf1[6] = ClampValue(bf0[1] - bf0[6], clamp_lo, clamp_hi);
+  bf1[7] = ClampValue(bf0[0] - bf0[7], clamp_lo, clamp_hi);
+}
+
+template <typename V>
+HWY_ATTR HWY_INLINE void Idct16(const V *input, V *output, int8_t cos_bit,
+                                V clamp_lo, V clamp_hi) {
+  const int32_t *cospi = cospi_arr(cos_bit);
+
+  V *bf0, *bf1;
+  V step[16];
+
+  // stage 1;
+  bf1 = output;
+  bf1[0] = input[0];
+  bf1[1] = input[8];
+  bf1[2] = input[4];
+  bf1[3] = input[12];
+  bf1[4] = input[2];
+  bf1[5] = input[10];
+  bf1[6] = input[6];
+  bf1[7] = input[14];
+  bf1[8] = input[1];
+  bf1[9] = input[9];
+  bf1[10] = input[5];
+  bf1[11] = input[13];
+  bf1[12] = input[3];
+  bf1[13] = input[11];
+  bf1[14] = input[7];
+  bf1[15] = input[15];
+
+  // stage 2
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = bf0[0];
+  bf1[1] = bf0[1];
+  bf1[2] = bf0[2];
+  bf1[3] = bf0[3];
+  bf1[4] = bf0[4];
+  bf1[5] = bf0[5];
+  bf1[6] = bf0[6];
+  bf1[7] = bf0[7];
+  bf1[8] = HalfBtf(cospi[60], bf0[8], -cospi[4], bf0[15], cos_bit);
+  bf1[9] = HalfBtf(cospi[28], bf0[9], -cospi[36], bf0[14], cos_bit);
+  bf1[10] = HalfBtf(cospi[44], bf0[10], -cospi[20], bf0[13], cos_bit);
+  bf1[11] = HalfBtf(cospi[12], bf0[11], -cospi[52], bf0[12], cos_bit);
+  bf1[12] = HalfBtf(cospi[52], bf0[11], cospi[12], bf0[12], cos_bit);
+  bf1[13] = HalfBtf(cospi[20], bf0[10], cospi[44], bf0[13], cos_bit);
+  bf1[14] = HalfBtf(cospi[36], bf0[9], cospi[28], bf0[14], cos_bit);
+  bf1[15] = HalfBtf(cospi[4], bf0[8], cospi[60], bf0[15], cos_bit);
+
+  // stage 3
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = bf0[0];
+  bf1[1] = bf0[1];
+  bf1[2] = bf0[2];
+  bf1[3] = bf0[3];
+  bf1[4] = HalfBtf(cospi[56], bf0[4], -cospi[8], bf0[7], cos_bit);
+  bf1[5] = HalfBtf(cospi[24], bf0[5], -cospi[40], bf0[6], cos_bit);
+  bf1[6] = HalfBtf(cospi[40], bf0[5], cospi[24], bf0[6], cos_bit);
+  bf1[7] = HalfBtf(cospi[8], bf0[4], cospi[56], bf0[7], cos_bit);
+  bf1[8] = ClampValue(bf0[8] + bf0[9], clamp_lo, clamp_hi);
+  bf1[9] = ClampValue(bf0[8] - bf0[9], clamp_lo, clamp_hi);
+  bf1[10] = ClampValue(bf0[11] - bf0[10], clamp_lo, clamp_hi);
+  bf1[11] = ClampValue(bf0[10] + bf0[11], clamp_lo, clamp_hi);
+  bf1[12] = ClampValue(bf0[12] + bf0[13], clamp_lo, clamp_hi);
+  bf1[13] = ClampValue(bf0[12] - bf0[13], clamp_lo, clamp_hi);
+  bf1[14] = ClampValue(bf0[15] - bf0[14], clamp_lo, clamp_hi);
+  bf1[15] = ClampValue(bf0[14] + bf0[15], clamp_lo, clamp_hi);
+
+  // stage 4
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = HalfBtf(cospi[32], bf0[0], cospi[32], bf0[1], cos_bit);
+  bf1[1] = HalfBtf(cospi[32], bf0[0], -cospi[32], bf0[1], cos_bit);
+  bf1[2] = HalfBtf(cospi[48], bf0[2], -cospi[16], bf0[3], cos_bit);
+  bf1[3] = HalfBtf(cospi[16], bf0[2], cospi[48], bf0[3], cos_bit);
+  bf1[4] = ClampValue(bf0[4] + bf0[5], clamp_lo, clamp_hi);
+  bf1[5] = ClampValue(bf0[4] - bf0[5], clamp_lo, clamp_hi);
+  bf1[6] = ClampValue(bf0[7] - bf0[6], clamp_lo, clamp_hi);
+  bf1[7] = ClampValue(bf0[6] + bf0[7], clamp_lo, clamp_hi);
+  bf1[8] = bf0[8];
+  bf1[9] = HalfBtf(-cospi[16], bf0[9], cospi[48], bf0[14], cos_bit);
+  bf1[10] = HalfBtf(-cospi[48], bf0[10], -cospi[16], bf0[13], cos_bit);
+  bf1[11] = bf0[11];
+  bf1[12] = bf0[12];
+  bf1[13] = HalfBtf(-cospi[16], bf0[10], cospi[48], bf0[13], cos_bit);
+  bf1[14] = HalfBtf(cospi[48], bf0[9], cospi[16], bf0[14], cos_bit);
+  bf1[15] = bf0[15];
+
+  // stage 5
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = ClampValue(bf0[0] + bf0[3], clamp_lo, clamp_hi);
+  bf1[1] = ClampValue(bf0[1] + bf0[2], clamp_lo, clamp_hi);
+  bf1[2] = ClampValue(bf0[1] - bf0[2], clamp_lo, clamp_hi);
+  bf1[3] = ClampValue(bf0[0] - bf0[3], clamp_lo, clamp_hi);
+  bf1[4] = bf0[4];
+  bf1[5] = HalfBtf(-cospi[32], bf0[5], cospi[32], bf0[6], cos_bit);
+  bf1[6] = HalfBtf(cospi[32], bf0[5], cospi[32], bf0[6], cos_bit);
+  bf1[7] = bf0[7];
+  bf1[8] = ClampValue(bf0[8] + bf0[11], clamp_lo, clamp_hi);
+  bf1[9] = ClampValue(bf0[9] + bf0[10], clamp_lo, clamp_hi);
+  bf1[10] = ClampValue(bf0[9] - bf0[10], clamp_lo, clamp_hi);
+  bf1[11] = ClampValue(bf0[8] - bf0[11], clamp_lo, clamp_hi);
+  bf1[12] = ClampValue(bf0[15] - bf0[12], clamp_lo, clamp_hi);
+  bf1[13] = ClampValue(bf0[14] - bf0[13], clamp_lo, clamp_hi);
+  bf1[14] = ClampValue(bf0[13] + bf0[14], clamp_lo, clamp_hi);
+  bf1[15] = ClampValue(bf0[12] + bf0[15], clamp_lo, clamp_hi);
+
+  // stage 6
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = ClampValue(bf0[0] + bf0[7], clamp_lo, clamp_hi);
+  bf1[1] = ClampValue(bf0[1] + bf0[6], clamp_lo, clamp_hi);
+  bf1[2] = ClampValue(bf0[2] + bf0[5], clamp_lo, clamp_hi);
+  bf1[3] = ClampValue(bf0[3] + bf0[4], clamp_lo, clamp_hi);
+  bf1[4] = ClampValue(bf0[3] - bf0[4], clamp_lo, clamp_hi);
+  bf1[5] = ClampValue(bf0[2] - bf0[5], clamp_lo, clamp_hi);
+  bf1[6] = ClampValue(bf0[1] - bf0[6], clamp_lo, clamp_hi);
+  bf1[7] = ClampValue(bf0[0] - bf0[7], clamp_lo, clamp_hi);
+  bf1[8] = bf0[8];
+  bf1[9] = bf0[9];
+  bf1[10] = HalfBtf(-cospi[32], bf0[10], cospi[32], bf0[13], cos_bit);
+  bf1[11] = HalfBtf(-cospi[32], bf0[11], cospi[32], bf0[12], cos_bit);
+  bf1[12] = HalfBtf(cospi[32], bf0[11], cospi[32], bf0[12], cos_bit);
+  bf1[13] = HalfBtf(cospi[32], bf0[10], cospi[32], bf0[13], cos_bit);
+  bf1[14] = bf0[14];
+  bf1[15] = bf0[15];
+
+  // stage 7
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = ClampValue(bf0[0] + bf0[15], clamp_lo, clamp_hi);
+  bf1[1] = ClampValue(bf0[1] + bf0[14], clamp_lo, clamp_hi);
+  bf1[2] = ClampValue(bf0[2] + bf0[13], clamp_lo, clamp_hi);
+  bf1[3] = ClampValue(bf0[3] + bf0[12], clamp_lo, clamp_hi);
+  bf1[4] = ClampValue(bf0[4] + bf0[11], clamp_lo, clamp_hi);
+  bf1[5] = ClampValue(bf0[5] + bf0[10], clamp_lo, clamp_hi);
+  bf1[6] = ClampValue(bf0[6] + bf0[9], clamp_lo, clamp_hi);
+  bf1[7] = ClampValue(bf0[7] + bf0[8], clamp_lo, clamp_hi);
+  bf1[8] = ClampValue(bf0[7] - bf0[8], clamp_lo, clamp_hi);
+  bf1[9] = ClampValue(bf0[6] - bf0[9], clamp_lo, clamp_hi);
+  bf1[10] = ClampValue(bf0[5] - bf0[10], clamp_lo, clamp_hi);
+  bf1[11] = ClampValue(bf0[4] - bf0[11], clamp_lo, clamp_hi);
+  bf1[12] = ClampValue(bf0[3] - bf0[12], clamp_lo, clamp_hi);
+  bf1[13] = ClampValue(bf0[2] - bf0[13], clamp_lo, clamp_hi);
+  bf1[14] = ClampValue(bf0[1] - bf0[14], clamp_lo, clamp_hi);
+  bf1[15] = ClampValue(bf0[0] - bf0[15], clamp_lo, clamp_hi);
+}
+
+template <typename V>
+HWY_ATTR HWY_INLINE void Idct32(const V *input, V *output, int8_t cos_bit,
+                                V clamp_lo, V clamp_hi) {
+  const int32_t *cospi = cospi_arr(cos_bit);
+
+  V *bf0, *bf1;
+  V step[32];
+
+  // stage 1;
+  bf1 = output;
+  bf1[0] = input[0];
+  bf1[1] = input[16];
+  bf1[2] = input[8];
+  bf1[3] = input[24];
+  bf1[4] = input[4];
+  bf1[5] = input[20];
+  bf1[6] = input[12];
+  bf1[7] = input[28];
+  bf1[8] = input[2];
+  bf1[9] = input[18];
+  bf1[10] = input[10];
+  bf1[11] = input[26];
+  bf1[12] = input[6];
+  bf1[13] = input[22];
+  bf1[14] = input[14];
+  bf1[15] = input[30];
+  bf1[16] = input[1];
+  bf1[17] = input[17];
+  bf1[18] = input[9];
+  bf1[19] = input[25];
+  bf1[20] = input[5];
+  bf1[21] = input[21];
+  bf1[22] = input[13];
+  bf1[23] = input[29];
+  bf1[24] = input[3];
+  bf1[25] = input[19];
+  bf1[26] = input[11];
+  bf1[27] = input[27];
+  bf1[28] = input[7];
+  bf1[29] = input[23];
+  bf1[30] = input[15];
+  bf1[31] = input[31];
+
+  // stage 2
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = bf0[0];
+  bf1[1] = bf0[1];
+  bf1[2] = bf0[2];
+  bf1[3] = bf0[3];
+  bf1[4] = bf0[4];
+  bf1[5] = bf0[5];
+  bf1[6] = bf0[6];
+  bf1[7] = bf0[7];
+  bf1[8] = bf0[8];
+  bf1[9] = bf0[9];
+  bf1[10] = bf0[10];
+  bf1[11] = bf0[11];
+  bf1[12] = bf0[12];
+  bf1[13] = bf0[13];
+  bf1[14] = bf0[14];
+  bf1[15] = bf0[15];
+  bf1[16] = HalfBtf(cospi[62], bf0[16], -cospi[2], bf0[31], cos_bit);
+  bf1[17] = HalfBtf(cospi[30], bf0[17], -cospi[34], bf0[30], cos_bit);
+  bf1[18] = HalfBtf(cospi[46], bf0[18], -cospi[18], bf0[29], cos_bit);
+  bf1[19] = HalfBtf(cospi[14], bf0[19], -cospi[50], bf0[28], cos_bit);
+  bf1[20] = HalfBtf(cospi[54], bf0[20], -cospi[10], bf0[27], cos_bit);
+  bf1[21] = HalfBtf(cospi[22], bf0[21], -cospi[42], bf0[26], cos_bit);
+  bf1[22] = HalfBtf(cospi[38], bf0[22], -cospi[26], bf0[25], cos_bit);
+  bf1[23] = HalfBtf(cospi[6], bf0[23], -cospi[58], bf0[24], cos_bit);
+  bf1[24] = HalfBtf(cospi[58], bf0[23], cospi[6], bf0[24], cos_bit);
+  bf1[25] = HalfBtf(cospi[26], bf0[22], cospi[38], bf0[25], cos_bit);
+  bf1[26] = HalfBtf(cospi[42], bf0[21], cospi[22], bf0[26], cos_bit);
+  bf1[27] = HalfBtf(cospi[10], bf0[20], cospi[54], bf0[27], cos_bit);
+  bf1[28] = HalfBtf(cospi[50], bf0[19], cospi[14], bf0[28], cos_bit);
+  bf1[29] = HalfBtf(cospi[18], bf0[18], cospi[46], bf0[29], cos_bit);
+  bf1[30] = HalfBtf(cospi[34], bf0[17], cospi[30], bf0[30], cos_bit);
+  bf1[31] = HalfBtf(cospi[2], bf0[16], cospi[62], bf0[31], cos_bit);
+
+  // stage 3
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = bf0[0];
+  bf1[1] = bf0[1];
+  bf1[2] = bf0[2];
+  bf1[3] = bf0[3];
+  bf1[4] = bf0[4];
+  bf1[5] = bf0[5];
+  bf1[6] = bf0[6];
+  bf1[7] = bf0[7];
+  bf1[8] = HalfBtf(cospi[60], bf0[8], -cospi[4], bf0[15], cos_bit);
+  bf1[9] = HalfBtf(cospi[28], bf0[9], -cospi[36], bf0[14], cos_bit);
+  bf1[10] = HalfBtf(cospi[44], bf0[10], -cospi[20], bf0[13], cos_bit);
+  bf1[11] = HalfBtf(cospi[12], bf0[11], -cospi[52], bf0[12], cos_bit);
+  bf1[12] = HalfBtf(cospi[52], bf0[11], cospi[12], bf0[12], cos_bit);
+  bf1[13] = HalfBtf(cospi[20], bf0[10], cospi[44], bf0[13], cos_bit);
+  bf1[14] = HalfBtf(cospi[36], bf0[9], cospi[28], bf0[14], cos_bit);
+  bf1[15] = HalfBtf(cospi[4], bf0[8], cospi[60], bf0[15], cos_bit);
+  bf1[16] = ClampValue(bf0[16] + bf0[17], clamp_lo, clamp_hi);
+  bf1[17] = ClampValue(bf0[16] - bf0[17], clamp_lo, clamp_hi);
+  bf1[18] = ClampValue(bf0[19] - bf0[18], clamp_lo, clamp_hi);
+  bf1[19] = ClampValue(bf0[18] + bf0[19], clamp_lo, clamp_hi);
+  bf1[20] = ClampValue(bf0[20] + bf0[21], clamp_lo, clamp_hi);
+  bf1[21] = ClampValue(bf0[20] - bf0[21], clamp_lo, clamp_hi);
+  bf1[22] = ClampValue(bf0[23] - bf0[22], clamp_lo, clamp_hi);
+  bf1[23] = ClampValue(bf0[22] + bf0[23], clamp_lo, clamp_hi);
+  bf1[24] = ClampValue(bf0[24] + bf0[25], clamp_lo, clamp_hi);
+  bf1[25] = ClampValue(bf0[24] - bf0[25], clamp_lo, clamp_hi);
+  bf1[26] = ClampValue(bf0[27] - bf0[26], clamp_lo, clamp_hi);
+  bf1[27] = ClampValue(bf0[26] + bf0[27], clamp_lo, clamp_hi);
+  bf1[28] = ClampValue(bf0[28] + bf0[29], clamp_lo, clamp_hi);
+  bf1[29] = ClampValue(bf0[28] - bf0[29], clamp_lo, clamp_hi);
+  bf1[30] = ClampValue(bf0[31] - bf0[30], clamp_lo, clamp_hi);
+  bf1[31] = ClampValue(bf0[30] + bf0[31], clamp_lo, clamp_hi);
+
+  // stage 4
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = bf0[0];
+  bf1[1] = bf0[1];
+  bf1[2] = bf0[2];
+  bf1[3] = bf0[3];
+  bf1[4] = HalfBtf(cospi[56], bf0[4], -cospi[8], bf0[7], cos_bit);
+  bf1[5] = HalfBtf(cospi[24], bf0[5], -cospi[40], bf0[6], cos_bit);
+  bf1[6] = HalfBtf(cospi[40], bf0[5], cospi[24], bf0[6], cos_bit);
+  bf1[7] = HalfBtf(cospi[8], bf0[4], cospi[56], bf0[7], cos_bit);
+  bf1[8] = ClampValue(bf0[8] + bf0[9], clamp_lo, clamp_hi);
+  bf1[9] = ClampValue(bf0[8] - bf0[9], clamp_lo, clamp_hi);
+  bf1[10] = ClampValue(bf0[11] - bf0[10], clamp_lo, clamp_hi);
+  bf1[11] = ClampValue(bf0[10] + bf0[11], clamp_lo, clamp_hi);
+  bf1[12] = ClampValue(bf0[12] + bf0[13], clamp_lo, clamp_hi);
+  bf1[13] = ClampValue(bf0[12] - bf0[13], clamp_lo, clamp_hi);
+  bf1[14] = ClampValue(bf0[15] - bf0[14], clamp_lo, clamp_hi);
+  bf1[15] = ClampValue(bf0[14] + bf0[15], clamp_lo, clamp_hi);
+  bf1[16] = bf0[16];
+  bf1[17] = HalfBtf(-cospi[8], bf0[17], cospi[56], bf0[30], cos_bit);
+  bf1[18] = HalfBtf(-cospi[56], bf0[18], -cospi[8], bf0[29], cos_bit);
+  bf1[19] = bf0[19];
+  bf1[20] = bf0[20];
+  bf1[21] = HalfBtf(-cospi[40], bf0[21], cospi[24], bf0[26], cos_bit);
+  bf1[22] = HalfBtf(-cospi[24], bf0[22], -cospi[40], bf0[25], cos_bit);
+  bf1[23] = bf0[23];
+  bf1[24] = bf0[24];
+  bf1[25] = HalfBtf(-cospi[40], bf0[22], cospi[24], bf0[25], cos_bit);
+  bf1[26] = HalfBtf(cospi[24], bf0[21], cospi[40], bf0[26], cos_bit);
+  bf1[27] = bf0[27];
+  bf1[28] = bf0[28];
+  bf1[29] = HalfBtf(-cospi[8], bf0[18], cospi[56], bf0[29], cos_bit);
+  bf1[30] = HalfBtf(cospi[56], bf0[17], cospi[8], bf0[30], cos_bit);
+  bf1[31] = bf0[31];
+
+  // stage 5
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = HalfBtf(cospi[32], bf0[0], cospi[32], bf0[1], cos_bit);
+  bf1[1] = HalfBtf(cospi[32], bf0[0], -cospi[32], bf0[1], cos_bit);
+  bf1[2] = HalfBtf(cospi[48], bf0[2], -cospi[16], bf0[3], cos_bit);
+  bf1[3] = HalfBtf(cospi[16], bf0[2], cospi[48], bf0[3], cos_bit);
+  bf1[4] = ClampValue(bf0[4] + bf0[5], clamp_lo, clamp_hi);
+  bf1[5] = ClampValue(bf0[4] - bf0[5], clamp_lo, clamp_hi);
+  bf1[6] = ClampValue(bf0[7] - bf0[6], clamp_lo, clamp_hi);
+  bf1[7] = ClampValue(bf0[6] + bf0[7], clamp_lo, clamp_hi);
+  bf1[8] = bf0[8];
+  bf1[9] = HalfBtf(-cospi[16], bf0[9], cospi[48], bf0[14], cos_bit);
+  bf1[10] = HalfBtf(-cospi[48], bf0[10], -cospi[16], bf0[13], cos_bit);
+  bf1[11] = bf0[11];
+  bf1[12] = bf0[12];
+  bf1[13] = HalfBtf(-cospi[16], bf0[10], cospi[48], bf0[13], cos_bit);
+  bf1[14] = HalfBtf(cospi[48], bf0[9], cospi[16], bf0[14], cos_bit);
+  bf1[15] = bf0[15];
+  bf1[16] = ClampValue(bf0[16] + bf0[19], clamp_lo, clamp_hi);
+  bf1[17] = ClampValue(bf0[17] + bf0[18], clamp_lo, clamp_hi);
+  bf1[18] = ClampValue(bf0[17] - bf0[18], clamp_lo, clamp_hi);
+  bf1[19] = ClampValue(bf0[16] - bf0[19], clamp_lo, clamp_hi);
+  bf1[20] = ClampValue(bf0[23] - bf0[20], clamp_lo, clamp_hi);
+  bf1[21] = ClampValue(bf0[22] - bf0[21], clamp_lo, clamp_hi);
+  bf1[22] = ClampValue(bf0[21] + bf0[22], clamp_lo, clamp_hi);
+  bf1[23] = ClampValue(bf0[20] + bf0[23], clamp_lo, clamp_hi);
+  bf1[24] = ClampValue(bf0[24] + bf0[27], clamp_lo, clamp_hi);
+  bf1[25] = ClampValue(bf0[25] + bf0[26], clamp_lo, clamp_hi);
+  bf1[26] = ClampValue(bf0[25] - bf0[26], clamp_lo, clamp_hi);
+  bf1[27] = ClampValue(bf0[24] - bf0[27], clamp_lo, clamp_hi);
+  bf1[28] = ClampValue(bf0[31] - bf0[28], clamp_lo, clamp_hi);
+  bf1[29] = ClampValue(bf0[30] - bf0[29], clamp_lo, clamp_hi);
+  bf1[30] = ClampValue(bf0[29] + bf0[30], clamp_lo, clamp_hi);
+  bf1[31] = ClampValue(bf0[28] + bf0[31], clamp_lo, clamp_hi);
+
+  // stage 6
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = ClampValue(bf0[0] + bf0[3], clamp_lo, clamp_hi);
+  bf1[1] = ClampValue(bf0[1] + bf0[2], clamp_lo, clamp_hi);
+  bf1[2] = ClampValue(bf0[1] - bf0[2], clamp_lo, clamp_hi);
+  bf1[3] = ClampValue(bf0[0] - bf0[3], clamp_lo, clamp_hi);
+  bf1[4] = bf0[4];
+  bf1[5] = HalfBtf(-cospi[32], bf0[5], cospi[32], bf0[6], cos_bit);
+  bf1[6] = HalfBtf(cospi[32], bf0[5], cospi[32], bf0[6], cos_bit);
+  bf1[7] = bf0[7];
+  bf1[8] = ClampValue(bf0[8] + bf0[11], clamp_lo, clamp_hi);
+  bf1[9] = ClampValue(bf0[9] + bf0[10], clamp_lo, clamp_hi);
+  bf1[10] = ClampValue(bf0[9] - bf0[10], clamp_lo, clamp_hi);
+  bf1[11] = ClampValue(bf0[8] - bf0[11], clamp_lo, clamp_hi);
+  bf1[12] = ClampValue(bf0[15] - bf0[12], clamp_lo, clamp_hi);
+  bf1[13] = ClampValue(bf0[14] - bf0[13], clamp_lo, clamp_hi);
+  bf1[14] = ClampValue(bf0[13] + bf0[14], clamp_lo, clamp_hi);
+  bf1[15] = ClampValue(bf0[12] + bf0[15], clamp_lo, clamp_hi);
+  bf1[16] = bf0[16];
+  bf1[17] = bf0[17];
+  bf1[18] = HalfBtf(-cospi[16], bf0[18], cospi[48], bf0[29], cos_bit);
+  bf1[19] = HalfBtf(-cospi[16], bf0[19], cospi[48], bf0[28], cos_bit);
+  bf1[20] = HalfBtf(-cospi[48], bf0[20], -cospi[16], bf0[27], cos_bit);
+  bf1[21] = HalfBtf(-cospi[48], bf0[21], -cospi[16], bf0[26], cos_bit);
+  bf1[22] = bf0[22];
+  bf1[23] = bf0[23];
+  bf1[24] = bf0[24];
+  bf1[25] = bf0[25];
+  bf1[26] = HalfBtf(-cospi[16], bf0[21], cospi[48], bf0[26], cos_bit);
+  bf1[27] = HalfBtf(-cospi[16], bf0[20], cospi[48], bf0[27], cos_bit);
+  bf1[28] = HalfBtf(cospi[48], bf0[19], cospi[16], bf0[28], cos_bit);
+  bf1[29] = HalfBtf(cospi[48], bf0[18], cospi[16], bf0[29], cos_bit);
+  bf1[30] = bf0[30];
+  bf1[31] = bf0[31];
+
+  // stage 7
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = ClampValue(bf0[0] + bf0[7], clamp_lo, clamp_hi);
+  bf1[1] = ClampValue(bf0[1] + bf0[6], clamp_lo, clamp_hi);
+  bf1[2] = ClampValue(bf0[2] + bf0[5], clamp_lo, clamp_hi);
+  bf1[3] = ClampValue(bf0[3] + bf0[4], clamp_lo, clamp_hi);
+  bf1[4] = ClampValue(bf0[3] - bf0[4], clamp_lo, clamp_hi);
+  bf1[5] = ClampValue(bf0[2] - bf0[5], clamp_lo, clamp_hi);
+  bf1[6] = ClampValue(bf0[1] - bf0[6], clamp_lo, clamp_hi);
+  bf1[7] = ClampValue(bf0[0] - bf0[7], clamp_lo, clamp_hi);
+  bf1[8] = bf0[8];
+  bf1[9] = bf0[9];
+  bf1[10] = HalfBtf(-cospi[32], bf0[10], cospi[32], bf0[13], cos_bit);
+  bf1[11] = HalfBtf(-cospi[32], bf0[11], cospi[32], bf0[12], cos_bit);
+  bf1[12] = HalfBtf(cospi[32], bf0[11], cospi[32], bf0[12], cos_bit);
+  bf1[13] = HalfBtf(cospi[32], bf0[10], cospi[32], bf0[13], cos_bit);
+  bf1[14] = bf0[14];
+  bf1[15] = bf0[15];
+  bf1[16] = ClampValue(bf0[16] + bf0[23], clamp_lo, clamp_hi);
+  bf1[17] = ClampValue(bf0[17] + bf0[22], clamp_lo, clamp_hi);
+  bf1[18] = ClampValue(bf0[18] + bf0[21], clamp_lo, clamp_hi);
+  bf1[19] = ClampValue(bf0[19] + bf0[20], clamp_lo, clamp_hi);
+  bf1[20] = ClampValue(bf0[19] - bf0[20], clamp_lo, clamp_hi);
+  bf1[21] = ClampValue(bf0[18] - bf0[21], clamp_lo, clamp_hi);
+  bf1[22] = ClampValue(bf0[17] - bf0[22], clamp_lo, clamp_hi);
+  bf1[23] = ClampValue(bf0[16] - bf0[23], clamp_lo, clamp_hi);
+  bf1[24] = ClampValue(bf0[31] - bf0[24], clamp_lo, clamp_hi);
+  bf1[25] = ClampValue(bf0[30] - bf0[25], clamp_lo, clamp_hi);
+  bf1[26] = ClampValue(bf0[29] - bf0[26], clamp_lo, clamp_hi);
+  bf1[27] = ClampValue(bf0[28] - bf0[27], clamp_lo, clamp_hi);
+  bf1[28] = ClampValue(bf0[27] + bf0[28], clamp_lo, clamp_hi);
+  bf1[29] = ClampValue(bf0[26] + bf0[29], clamp_lo, clamp_hi);
+  bf1[30] = ClampValue(bf0[25] + bf0[30], clamp_lo, clamp_hi);
+  bf1[31] = ClampValue(bf0[24] + bf0[31], clamp_lo, clamp_hi);
+
+  // stage 8
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = ClampValue(bf0[0] + bf0[15], clamp_lo, clamp_hi);
+  bf1[1] = ClampValue(bf0[1] + bf0[14], clamp_lo, clamp_hi);
+  bf1[2] = ClampValue(bf0[2] + bf0[13], clamp_lo, clamp_hi);
+  bf1[3] = ClampValue(bf0[3] + bf0[12], clamp_lo, clamp_hi);
+  bf1[4] = ClampValue(bf0[4] + bf0[11], clamp_lo, clamp_hi);
+  bf1[5] = ClampValue(bf0[5] + bf0[10], clamp_lo, clamp_hi);
+  bf1[6] = ClampValue(bf0[6] + bf0[9], clamp_lo, clamp_hi);
+  bf1[7] = ClampValue(bf0[7] + bf0[8], clamp_lo, clamp_hi);
+  bf1[8] = ClampValue(bf0[7] - bf0[8], clamp_lo, clamp_hi);
+  bf1[9] = ClampValue(bf0[6] - bf0[9], clamp_lo, clamp_hi);
+  bf1[10] = ClampValue(bf0[5] - bf0[10], clamp_lo, clamp_hi);
+  bf1[11] = ClampValue(bf0[4] - bf0[11], clamp_lo, clamp_hi);
+  bf1[12] = ClampValue(bf0[3] - bf0[12], clamp_lo, clamp_hi);
+  bf1[13] = ClampValue(bf0[2] - bf0[13], clamp_lo, clamp_hi);
+  bf1[14] = ClampValue(bf0[1] - bf0[14], clamp_lo, clamp_hi);
+  bf1[15] = ClampValue(bf0[0] - bf0[15], clamp_lo, clamp_hi);
+  bf1[16] = bf0[16];
+  bf1[17] = bf0[17];
+  bf1[18] = bf0[18];
+  bf1[19] = bf0[19];
+  bf1[20] = HalfBtf(-cospi[32], bf0[20], cospi[32], bf0[27], cos_bit);
+  bf1[21] = HalfBtf(-cospi[32], bf0[21], cospi[32], bf0[26], cos_bit);
+  bf1[22] = HalfBtf(-cospi[32], bf0[22], cospi[32], bf0[25], cos_bit);
+  bf1[23] = HalfBtf(-cospi[32], bf0[23], cospi[32], bf0[24], cos_bit);
+  bf1[24] = HalfBtf(cospi[32], bf0[23], cospi[32], bf0[24], cos_bit);
+  bf1[25] = HalfBtf(cospi[32], bf0[22], cospi[32], bf0[25], cos_bit);
+  bf1[26] = HalfBtf(cospi[32], bf0[21], cospi[32], bf0[26], cos_bit);
+  bf1[27] = HalfBtf(cospi[32], bf0[20], cospi[32], bf0[27], cos_bit);
+  bf1[28] = bf0[28];
+  bf1[29] = bf0[29];
+  bf1[30] = bf0[30];
+  bf1[31] = bf0[31];
+
+  // stage 9
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = ClampValue(bf0[0] + bf0[31], clamp_lo, clamp_hi);
+  bf1[1] = ClampValue(bf0[1] + bf0[30], clamp_lo, clamp_hi);
+  bf1[2] = ClampValue(bf0[2] + bf0[29], clamp_lo, clamp_hi);
+  bf1[3] = ClampValue(bf0[3] + bf0[28], clamp_lo, clamp_hi);
+  bf1[4] = ClampValue(bf0[4] + bf0[27], clamp_lo, clamp_hi);
+  bf1[5] = ClampValue(bf0[5] + bf0[26], clamp_lo, clamp_hi);
+  bf1[6] = ClampValue(bf0[6] + bf0[25], clamp_lo, clamp_hi);
+  bf1[7] = ClampValue(bf0[7] + bf0[24], clamp_lo, clamp_hi);
+  bf1[8] = ClampValue(bf0[8] + bf0[23], clamp_lo, clamp_hi);
+  bf1[9] = ClampValue(bf0[9] + bf0[22], clamp_lo, clamp_hi);
+  bf1[10] = ClampValue(bf0[10] + bf0[21], clamp_lo, clamp_hi);
+  bf1[11] = ClampValue(bf0[11] + bf0[20], clamp_lo, clamp_hi);
+  bf1[12] = ClampValue(bf0[12] + bf0[19], clamp_lo, clamp_hi);
+  bf1[13] = ClampValue(bf0[13] + bf0[18], clamp_lo, clamp_hi);
+  bf1[14] = ClampValue(bf0[14] + bf0[17], clamp_lo, clamp_hi);
+  bf1[15] = ClampValue(bf0[15] + bf0[16], clamp_lo, clamp_hi);
+  bf1[16] = ClampValue(bf0[15] - bf0[16], clamp_lo, clamp_hi);
+  bf1[17] = ClampValue(bf0[14] - bf0[17], clamp_lo, clamp_hi);
+  bf1[18] = ClampValue(bf0[13] - bf0[18], clamp_lo, clamp_hi);
+  bf1[19] = ClampValue(bf0[12] - bf0[19], clamp_lo, clamp_hi);
+  bf1[20] = ClampValue(bf0[11] - bf0[20], clamp_lo, clamp_hi);
+  bf1[21] = ClampValue(bf0[10] - bf0[21], clamp_lo, clamp_hi);
+  bf1[22] = ClampValue(bf0[9] - bf0[22], clamp_lo, clamp_hi);
+  bf1[23] = ClampValue(bf0[8] - bf0[23], clamp_lo, clamp_hi);
+  bf1[24] = ClampValue(bf0[7] - bf0[24], clamp_lo, clamp_hi);
+  bf1[25] = ClampValue(bf0[6] - bf0[25], clamp_lo, clamp_hi);
+  bf1[26] = ClampValue(bf0[5] - bf0[26], clamp_lo, clamp_hi);
+  bf1[27] = ClampValue(bf0[4] - bf0[27], clamp_lo, clamp_hi);
+  bf1[28] = ClampValue(bf0[3] - bf0[28], clamp_lo, clamp_hi);
+  bf1[29] = ClampValue(bf0[2] - bf0[29], clamp_lo, clamp_hi);
+  bf1[30] = ClampValue(bf0[1] - bf0[30], clamp_lo, clamp_hi);
+  bf1[31] = ClampValue(bf0[0] - bf0[31], clamp_lo, clamp_hi);
+}
+
+template <typename V>
+HWY_ATTR HWY_INLINE void Idct64(const V *input, V *output, int8_t cos_bit,
+                                V clamp_lo, V clamp_hi) {
+  const int32_t *cospi = cospi_arr(cos_bit);
+
+  V *bf0, *bf1;
+  V step[64];
+
+  // stage 1;
+  bf1 = output;
+  bf1[0] = input[0];
+  bf1[1] = input[32];
+  bf1[2] = input[16];
+  bf1[3] = input[48];
+  bf1[4] = input[8];
+  bf1[5] = input[40];
+  bf1[6] = input[24];
+  bf1[7] = input[56];
+  bf1[8] = input[4];
+  bf1[9] = input[36];
+  bf1[10] = input[20];
+  bf1[11] = input[52];
+  bf1[12] = input[12];
+  bf1[13] = input[44];
+  bf1[14] = input[28];
+  bf1[15] = input[60];
+  bf1[16] = input[2];
+  bf1[17] = input[34];
+  bf1[18] = input[18];
+  bf1[19] = input[50];
+  bf1[20] = input[10];
+  bf1[21] = input[42];
+  bf1[22] = input[26];
+  bf1[23] = input[58];
+  bf1[24] = input[6];
+  bf1[25] = input[38];
+  bf1[26] = input[22];
+  bf1[27] = input[54];
+  bf1[28] = input[14];
+  bf1[29] = input[46];
+  bf1[30] = input[30];
+  bf1[31] = input[62];
+  bf1[32] = input[1];
+  bf1[33] = input[33];
+  bf1[34] = input[17];
+  bf1[35] = input[49];
+  bf1[36] = input[9];
+  bf1[37] = input[41];
+  bf1[38] = input[25];
+  bf1[39] = input[57];
+  bf1[40] = input[5];
+  bf1[41] = input[37];
+  bf1[42] = input[21];
+  bf1[43] = input[53];
+  bf1[44] = input[13];
+  bf1[45] = input[45];
+  bf1[46] = input[29];
+  bf1[47] = input[61];
+  bf1[48] = input[3];
+  bf1[49] = input[35];
+  bf1[50] = input[19];
+  bf1[51] = input[51];
+  bf1[52] = input[11];
+  bf1[53] = input[43];
+  bf1[54] = input[27];
+  bf1[55] = input[59];
+  bf1[56] = input[7];
+  bf1[57] = input[39];
+  bf1[58] = input[23];
+  bf1[59] = input[55];
+  bf1[60] = input[15];
+  bf1[61] = input[47];
+  bf1[62] = input[31];
+  bf1[63] = input[63];
+
+  // stage 2
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = bf0[0];
+  bf1[1] = bf0[1];
+  bf1[2] = bf0[2];
+  bf1[3] = bf0[3];
+  bf1[4] = bf0[4];
+  bf1[5] = bf0[5];
+  bf1[6] = bf0[6];
+  bf1[7] = bf0[7];
+  bf1[8] = bf0[8];
+  bf1[9] = bf0[9];
+  bf1[10] = bf0[10];
+  bf1[11] = bf0[11];
+  bf1[12] = bf0[12];
+  bf1[13] = bf0[13];
+  bf1[14] = bf0[14];
+  bf1[15] = bf0[15];
+  bf1[16] = bf0[16];
+  bf1[17] = bf0[17];
+  bf1[18] = bf0[18];
+  bf1[19] = bf0[19];
+  bf1[20] = bf0[20];
+  bf1[21] = bf0[21];
+  bf1[22] = bf0[22];
+  bf1[23] = bf0[23];
+  bf1[24] = bf0[24];
+  bf1[25] = bf0[25];
+  bf1[26] = bf0[26];
+  bf1[27] = bf0[27];
+  bf1[28] = bf0[28];
+  bf1[29] = bf0[29];
+  bf1[30] = bf0[30];
+  bf1[31] = bf0[31];
+  bf1[32] = HalfBtf(cospi[63], bf0[32], -cospi[1], bf0[63], cos_bit);
+  bf1[33] = HalfBtf(cospi[31], bf0[33], -cospi[33], bf0[62], cos_bit);
+  bf1[34] = HalfBtf(cospi[47], bf0[34], -cospi[17], bf0[61], cos_bit);
+  bf1[35] = HalfBtf(cospi[15], bf0[35], -cospi[49], bf0[60], cos_bit);
+  bf1[36] = HalfBtf(cospi[55], bf0[36], -cospi[9], bf0[59], cos_bit);
+  bf1[37] = HalfBtf(cospi[23], bf0[37], -cospi[41], bf0[58], cos_bit);
+  bf1[38] = HalfBtf(cospi[39], bf0[38], -cospi[25], bf0[57], cos_bit);
+  bf1[39] = HalfBtf(cospi[7], bf0[39], -cospi[57], bf0[56], cos_bit);
+  bf1[40] = HalfBtf(cospi[59], bf0[40], -cospi[5], bf0[55], cos_bit);
+  bf1[41] = HalfBtf(cospi[27], bf0[41], -cospi[37], bf0[54], cos_bit);
+  bf1[42] = HalfBtf(cospi[43], bf0[42], -cospi[21], bf0[53], cos_bit);
+  bf1[43] = HalfBtf(cospi[11], bf0[43], -cospi[53], bf0[52], cos_bit);
+  bf1[44] = HalfBtf(cospi[51], bf0[44], -cospi[13], bf0[51], cos_bit);
+  bf1[45] = HalfBtf(cospi[19], bf0[45], -cospi[45], bf0[50], cos_bit);
+  bf1[46] = HalfBtf(cospi[35], bf0[46], -cospi[29], bf0[49], cos_bit);
+  bf1[47] = HalfBtf(cospi[3], bf0[47], -cospi[61], bf0[48], cos_bit);
+  bf1[48] = HalfBtf(cospi[61], bf0[47], cospi[3], bf0[48], cos_bit);
+  bf1[49] = HalfBtf(cospi[29], bf0[46], cospi[35], bf0[49], cos_bit);
+  bf1[50] = HalfBtf(cospi[45], bf0[45], cospi[19], bf0[50], cos_bit);
+  bf1[51] = HalfBtf(cospi[13], bf0[44], cospi[51], bf0[51], cos_bit);
+  bf1[52] = HalfBtf(cospi[53], bf0[43], cospi[11], bf0[52], cos_bit);
+  bf1[53] = HalfBtf(cospi[21], bf0[42], cospi[43], bf0[53], cos_bit);
+  bf1[54] = HalfBtf(cospi[37], bf0[41], cospi[27], bf0[54], cos_bit);
+  bf1[55] = HalfBtf(cospi[5], bf0[40], cospi[59], bf0[55], cos_bit);
+  bf1[56] = HalfBtf(cospi[57], bf0[39], cospi[7], bf0[56], cos_bit);
+  bf1[57] = HalfBtf(cospi[25], bf0[38], cospi[39], bf0[57], cos_bit);
+  bf1[58] = HalfBtf(cospi[41], bf0[37], cospi[23], bf0[58], cos_bit);
+  bf1[59] = HalfBtf(cospi[9], bf0[36], cospi[55], bf0[59], cos_bit);
+  bf1[60] = HalfBtf(cospi[49], bf0[35], cospi[15], bf0[60], cos_bit);
+  bf1[61] = HalfBtf(cospi[17], bf0[34], cospi[47], bf0[61], cos_bit);
+  bf1[62] = HalfBtf(cospi[33], bf0[33], cospi[31], bf0[62], cos_bit);
+  bf1[63] = HalfBtf(cospi[1], bf0[32], cospi[63], bf0[63], cos_bit);
+
+  // stage 3
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = bf0[0];
+  bf1[1] = bf0[1];
+  bf1[2] = bf0[2];
+  bf1[3] = bf0[3];
+  bf1[4] = bf0[4];
+  bf1[5] = bf0[5];
+  bf1[6] = bf0[6];
+  bf1[7] = bf0[7];
+  bf1[8] = bf0[8];
+  bf1[9] = bf0[9];
+  bf1[10] = bf0[10];
+  bf1[11] = bf0[11];
+  bf1[12] = bf0[12];
+  bf1[13] = bf0[13];
+  bf1[14] = bf0[14];
+  bf1[15] = bf0[15];
+  bf1[16] = HalfBtf(cospi[62], bf0[16], -cospi[2], bf0[31], cos_bit);
+  bf1[17] = HalfBtf(cospi[30], bf0[17], -cospi[34], bf0[30], cos_bit);
+  bf1[18] = HalfBtf(cospi[46], bf0[18], -cospi[18], bf0[29], cos_bit);
+  bf1[19] = HalfBtf(cospi[14], bf0[19], -cospi[50], bf0[28], cos_bit);
+  bf1[20] = HalfBtf(cospi[54], bf0[20], -cospi[10], bf0[27], cos_bit);
+  bf1[21] = HalfBtf(cospi[22], bf0[21], -cospi[42], bf0[26], cos_bit);
+  bf1[22] = HalfBtf(cospi[38], bf0[22], -cospi[26], bf0[25], cos_bit);
+  bf1[23] = HalfBtf(cospi[6], bf0[23], -cospi[58], bf0[24], cos_bit);
+  bf1[24] = HalfBtf(cospi[58], bf0[23], cospi[6], bf0[24], cos_bit);
+  bf1[25] = HalfBtf(cospi[26], bf0[22], cospi[38], bf0[25], cos_bit);
+  bf1[26] = HalfBtf(cospi[42], bf0[21], cospi[22], bf0[26], cos_bit);
+  bf1[27] = HalfBtf(cospi[10], bf0[20], cospi[54], bf0[27], cos_bit);
+  bf1[28] = HalfBtf(cospi[50], bf0[19], cospi[14], bf0[28], cos_bit);
+  bf1[29] = HalfBtf(cospi[18], bf0[18], cospi[46], bf0[29], cos_bit);
+  bf1[30] = HalfBtf(cospi[34], bf0[17], cospi[30], bf0[30], cos_bit);
+  bf1[31] = HalfBtf(cospi[2], bf0[16], cospi[62], bf0[31], cos_bit);
+  bf1[32] = ClampValue(bf0[32] + bf0[33], clamp_lo, clamp_hi);
+  bf1[33] = ClampValue(bf0[32] - bf0[33], clamp_lo, clamp_hi);
+  bf1[34] = ClampValue(bf0[35] - bf0[34], clamp_lo, clamp_hi);
+  bf1[35] = ClampValue(bf0[34] + bf0[35], clamp_lo, clamp_hi);
+  bf1[36] = ClampValue(bf0[36] + bf0[37], clamp_lo, clamp_hi);
+  bf1[37] = ClampValue(bf0[36] - bf0[37], clamp_lo, clamp_hi);
+  bf1[38] = ClampValue(bf0[39] - bf0[38], clamp_lo, clamp_hi);
+  bf1[39] = ClampValue(bf0[38] + bf0[39], clamp_lo, clamp_hi);
+  bf1[40] = ClampValue(bf0[40] + bf0[41], clamp_lo, clamp_hi);
+  bf1[41] = ClampValue(bf0[40] - bf0[41], clamp_lo, clamp_hi);
+  bf1[42] = ClampValue(bf0[43] - bf0[42], clamp_lo, clamp_hi);
+  bf1[43] = ClampValue(bf0[42] + bf0[43], clamp_lo, clamp_hi);
+  bf1[44] = ClampValue(bf0[44] + bf0[45], clamp_lo, clamp_hi);
+  bf1[45] = ClampValue(bf0[44] - bf0[45], clamp_lo, clamp_hi);
+  bf1[46] = ClampValue(bf0[47] - bf0[46], clamp_lo, clamp_hi);
+  bf1[47] = ClampValue(bf0[46] + bf0[47], clamp_lo, clamp_hi);
+  bf1[48] = ClampValue(bf0[48] + bf0[49], clamp_lo, clamp_hi);
+  bf1[49] = ClampValue(bf0[48] - bf0[49], clamp_lo, clamp_hi);
+  bf1[50] = ClampValue(bf0[51] - bf0[50], clamp_lo, clamp_hi);
+  bf1[51] = ClampValue(bf0[50] + bf0[51], clamp_lo, clamp_hi);
+  bf1[52] = ClampValue(bf0[52] + bf0[53], clamp_lo, clamp_hi);
+  bf1[53] = ClampValue(bf0[52] - bf0[53], clamp_lo, clamp_hi);
+  bf1[54] = ClampValue(bf0[55] - bf0[54], clamp_lo, clamp_hi);
+  bf1[55] = ClampValue(bf0[54] + bf0[55], clamp_lo, clamp_hi);
+  bf1[56] = ClampValue(bf0[56] + bf0[57], clamp_lo, clamp_hi);
+  bf1[57] = ClampValue(bf0[56] - bf0[57], clamp_lo, clamp_hi);
+  bf1[58] = ClampValue(bf0[59] - bf0[58], clamp_lo, clamp_hi);
+  bf1[59] = ClampValue(bf0[58] + bf0[59], clamp_lo, clamp_hi);
+  bf1[60] = ClampValue(bf0[60] + bf0[61], clamp_lo, clamp_hi);
+  bf1[61] = ClampValue(bf0[60] - bf0[61], clamp_lo, clamp_hi);
+  bf1[62] = ClampValue(bf0[63] - bf0[62], clamp_lo, clamp_hi);
+  bf1[63] = ClampValue(bf0[62] + bf0[63], clamp_lo, clamp_hi);
+
+  // stage 4
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = bf0[0];
+  bf1[1] = bf0[1];
+  bf1[2] = bf0[2];
+  bf1[3] = bf0[3];
+  bf1[4] = bf0[4];
+  bf1[5] = bf0[5];
+  bf1[6] = bf0[6];
+  bf1[7] = bf0[7];
+  bf1[8] = HalfBtf(cospi[60], bf0[8], -cospi[4], bf0[15], cos_bit);
+  bf1[9] = HalfBtf(cospi[28], bf0[9], -cospi[36], bf0[14], cos_bit);
+  bf1[10] = HalfBtf(cospi[44], bf0[10], -cospi[20], bf0[13], cos_bit);
+  bf1[11] = HalfBtf(cospi[12], bf0[11], -cospi[52], bf0[12], cos_bit);
+  bf1[12] = HalfBtf(cospi[52], bf0[11], cospi[12], bf0[12], cos_bit);
+  bf1[13] = HalfBtf(cospi[20], bf0[10], cospi[44], bf0[13], cos_bit);
+  bf1[14] = HalfBtf(cospi[36], bf0[9], cospi[28], bf0[14], cos_bit);
+  bf1[15] = HalfBtf(cospi[4], bf0[8], cospi[60], bf0[15], cos_bit);
+  bf1[16] = ClampValue(bf0[16] + bf0[17], clamp_lo, clamp_hi);
+  bf1[17] = ClampValue(bf0[16] - bf0[17], clamp_lo, clamp_hi);
+  bf1[18] = ClampValue(bf0[19] - bf0[18], clamp_lo, clamp_hi);
+  bf1[19] = ClampValue(bf0[18] + bf0[19], clamp_lo, clamp_hi);
+  bf1[20] = ClampValue(bf0[20] + bf0[21], clamp_lo, clamp_hi);
+  bf1[21] = ClampValue(bf0[20] - bf0[21], clamp_lo, clamp_hi);
+  bf1[22] = ClampValue(bf0[23] - bf0[22], clamp_lo, clamp_hi);
+  bf1[23] = ClampValue(bf0[22] + bf0[23], clamp_lo, clamp_hi);
+  bf1[24] = ClampValue(bf0[24] + bf0[25], clamp_lo, clamp_hi);
+  bf1[25] = ClampValue(bf0[24] - bf0[25], clamp_lo, clamp_hi);
+  bf1[26] = ClampValue(bf0[27] - bf0[26], clamp_lo, clamp_hi);
+  bf1[27] = ClampValue(bf0[26] + bf0[27], clamp_lo, clamp_hi);
+  bf1[28] = ClampValue(bf0[28] + bf0[29], clamp_lo, clamp_hi);
+  bf1[29] = ClampValue(bf0[28] - bf0[29], clamp_lo, clamp_hi);
+  bf1[30] = ClampValue(bf0[31] - bf0[30], clamp_lo, clamp_hi);
+  bf1[31] = ClampValue(bf0[30] + bf0[31], clamp_lo, clamp_hi);
+  bf1[32] = bf0[32];
+  bf1[33] = HalfBtf(-cospi[4], bf0[33], cospi[60], bf0[62], cos_bit);
+  bf1[34] = HalfBtf(-cospi[60], bf0[34], -cospi[4], bf0[61], cos_bit);
+  bf1[35] = bf0[35];
+  bf1[36] = bf0[36];
+  bf1[37] = HalfBtf(-cospi[36], bf0[37], cospi[28], bf0[58], cos_bit);
+  bf1[38] = HalfBtf(-cospi[28], bf0[38], -cospi[36], bf0[57], cos_bit);
+  bf1[39] = bf0[39];
+  bf1[40] = bf0[40];
+  bf1[41] = HalfBtf(-cospi[20], bf0[41], cospi[44], bf0[54], cos_bit);
+  bf1[42] = HalfBtf(-cospi[44], bf0[42], -cospi[20], bf0[53], cos_bit);
+  bf1[43] = bf0[43];
+  bf1[44] = bf0[44];
+  bf1[45] = HalfBtf(-cospi[52], bf0[45], cospi[12], bf0[50], cos_bit);
+  bf1[46] = HalfBtf(-cospi[12], bf0[46], -cospi[52], bf0[49], cos_bit);
+  bf1[47] = bf0[47];
+  bf1[48] = bf0[48];
+  bf1[49] = HalfBtf(-cospi[52], bf0[46], cospi[12], bf0[49], cos_bit);
+  bf1[50] = HalfBtf(cospi[12], bf0[45], cospi[52], bf0[50], cos_bit);
+  bf1[51] = bf0[51];
+  bf1[52] = bf0[52];
+  bf1[53] = HalfBtf(-cospi[20], bf0[42], cospi[44], bf0[53], cos_bit);
+  bf1[54] = HalfBtf(cospi[44], bf0[41], cospi[20], bf0[54], cos_bit);
+  bf1[55] = bf0[55];
+  bf1[56] = bf0[56];
+  bf1[57] = HalfBtf(-cospi[36], bf0[38], cospi[28], bf0[57], cos_bit);
+  bf1[58] = HalfBtf(cospi[28], bf0[37], cospi[36], bf0[58], cos_bit);
+  bf1[59] = bf0[59];
+  bf1[60] = bf0[60];
+  bf1[61] = HalfBtf(-cospi[4], bf0[34], cospi[60], bf0[61], cos_bit);
+  bf1[62] = HalfBtf(cospi[60], bf0[33], cospi[4], bf0[62], cos_bit);
+  bf1[63] = bf0[63];
+
+  // stage 5
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = bf0[0];
+  bf1[1] = bf0[1];
+  bf1[2] = bf0[2];
+  bf1[3] = bf0[3];
+  bf1[4] = HalfBtf(cospi[56], bf0[4], -cospi[8], bf0[7], cos_bit);
+  bf1[5] = HalfBtf(cospi[24], bf0[5], -cospi[40], bf0[6], cos_bit);
+  bf1[6] = HalfBtf(cospi[40], bf0[5], cospi[24], bf0[6], cos_bit);
+  bf1[7] = HalfBtf(cospi[8], bf0[4], cospi[56], bf0[7], cos_bit);
+  bf1[8] = ClampValue(bf0[8] + bf0[9], clamp_lo, clamp_hi);
+  bf1[9] = ClampValue(bf0[8] - bf0[9], clamp_lo, clamp_hi);
+  bf1[10] = ClampValue(bf0[11] - bf0[10], clamp_lo, clamp_hi);
+  bf1[11] = ClampValue(bf0[10] + bf0[11], clamp_lo, clamp_hi);
+  bf1[12] = ClampValue(bf0[12] + bf0[13], clamp_lo, clamp_hi);
+  bf1[13] = ClampValue(bf0[12] - bf0[13], clamp_lo, clamp_hi);
+  bf1[14] = ClampValue(bf0[15] - bf0[14], clamp_lo, clamp_hi);
+  bf1[15] = ClampValue(bf0[14] + bf0[15], clamp_lo, clamp_hi);
+  bf1[16] = bf0[16];
+  bf1[17] = HalfBtf(-cospi[8], bf0[17], cospi[56], bf0[30], cos_bit);
+  bf1[18] = HalfBtf(-cospi[56], bf0[18], -cospi[8], bf0[29], cos_bit);
+  bf1[19] = bf0[19];
+  bf1[20] = bf0[20];
+  bf1[21] = HalfBtf(-cospi[40], bf0[21], cospi[24], bf0[26], cos_bit);
+  bf1[22] = HalfBtf(-cospi[24], bf0[22], -cospi[40], bf0[25], cos_bit);
+  bf1[23] = bf0[23];
+  bf1[24] = bf0[24];
+  bf1[25] = HalfBtf(-cospi[40], bf0[22], cospi[24], bf0[25], cos_bit);
+  bf1[26] = HalfBtf(cospi[24], bf0[21], cospi[40], bf0[26], cos_bit);
+  bf1[27] = bf0[27];
+  bf1[28] = bf0[28];
+  bf1[29] = HalfBtf(-cospi[8], bf0[18], cospi[56], bf0[29], cos_bit);
+  bf1[30] = HalfBtf(cospi[56], bf0[17], cospi[8], bf0[30], cos_bit);
+  bf1[31] = bf0[31];
+  bf1[32] = ClampValue(bf0[32] + bf0[35], clamp_lo, clamp_hi);
+  bf1[33] = ClampValue(bf0[33] + bf0[34], clamp_lo, clamp_hi);
+  bf1[34] = ClampValue(bf0[33] - bf0[34], clamp_lo, clamp_hi);
+  bf1[35] = ClampValue(bf0[32] - bf0[35], clamp_lo, clamp_hi);
+  bf1[36] = ClampValue(bf0[39] - bf0[36], clamp_lo, clamp_hi);
+  bf1[37] = ClampValue(bf0[38] - bf0[37], clamp_lo, clamp_hi);
+  bf1[38] = ClampValue(bf0[37] + bf0[38], clamp_lo, clamp_hi);
+  bf1[39] = ClampValue(bf0[36] + bf0[39], clamp_lo, clamp_hi);
+  bf1[40] = ClampValue(bf0[40] + bf0[43], clamp_lo, clamp_hi);
+  bf1[41] = ClampValue(bf0[41] + bf0[42], clamp_lo, clamp_hi);
+  bf1[42] = ClampValue(bf0[41] - bf0[42], clamp_lo, clamp_hi);
+  bf1[43] = ClampValue(bf0[40] - bf0[43], clamp_lo, clamp_hi);
+  bf1[44] = ClampValue(bf0[47] - bf0[44], clamp_lo, clamp_hi);
+  bf1[45] = ClampValue(bf0[46] - bf0[45], clamp_lo, clamp_hi);
+  bf1[46] = ClampValue(bf0[45] + bf0[46], clamp_lo, clamp_hi);
+  bf1[47] = ClampValue(bf0[44] + bf0[47], clamp_lo, clamp_hi);
+  bf1[48] = ClampValue(bf0[48] + bf0[51], clamp_lo, clamp_hi);
+  bf1[49] = ClampValue(bf0[49] + bf0[50], clamp_lo, clamp_hi);
+  bf1[50] = ClampValue(bf0[49] - bf0[50], clamp_lo, clamp_hi);
+  bf1[51] = ClampValue(bf0[48] - bf0[51], clamp_lo, clamp_hi);
+  bf1[52] = ClampValue(bf0[55] - bf0[52], clamp_lo, clamp_hi);
+  bf1[53] = ClampValue(bf0[54] - bf0[53], clamp_lo, clamp_hi);
+  bf1[54] = ClampValue(bf0[53] + bf0[54], clamp_lo, clamp_hi);
+  bf1[55] = ClampValue(bf0[52] + bf0[55], clamp_lo, clamp_hi);
+  bf1[56] = ClampValue(bf0[56] + bf0[59], clamp_lo, clamp_hi);
+  bf1[57] = ClampValue(bf0[57] + bf0[58], clamp_lo, clamp_hi);
+  bf1[58] = ClampValue(bf0[57] - bf0[58], clamp_lo, clamp_hi);
+  bf1[59] = ClampValue(bf0[56] - bf0[59], clamp_lo, clamp_hi);
+  bf1[60] = ClampValue(bf0[63] - bf0[60], clamp_lo, clamp_hi);
+  bf1[61] = ClampValue(bf0[62] - bf0[61], clamp_lo, clamp_hi);
+  bf1[62] = ClampValue(bf0[61] + bf0[62], clamp_lo, clamp_hi);
+  bf1[63] = ClampValue(bf0[60] + bf0[63], clamp_lo, clamp_hi);
+
+  // stage 6
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = HalfBtf(cospi[32], bf0[0], cospi[32], bf0[1], cos_bit);
+  bf1[1] = HalfBtf(cospi[32], bf0[0], -cospi[32], bf0[1], cos_bit);
+  bf1[2] = HalfBtf(cospi[48], bf0[2], -cospi[16], bf0[3], cos_bit);
+  bf1[3] = HalfBtf(cospi[16], bf0[2], cospi[48], bf0[3], cos_bit);
+  bf1[4] = ClampValue(bf0[4] + bf0[5], clamp_lo, clamp_hi);
+  bf1[5] = ClampValue(bf0[4] - bf0[5], clamp_lo, clamp_hi);
+  bf1[6] = ClampValue(bf0[7] - bf0[6], clamp_lo, clamp_hi);
+  bf1[7] = ClampValue(bf0[6] + bf0[7], clamp_lo, clamp_hi);
+  bf1[8] = bf0[8];
+  bf1[9] = HalfBtf(-cospi[16], bf0[9], cospi[48], bf0[14], cos_bit);
+  bf1[10] = HalfBtf(-cospi[48], bf0[10], -cospi[16], bf0[13], cos_bit);
+  bf1[11] = bf0[11];
+  bf1[12] = bf0[12];
+  bf1[13] = HalfBtf(-cospi[16], bf0[10], cospi[48], bf0[13], cos_bit);
+  bf1[14] = HalfBtf(cospi[48], bf0[9], cospi[16], bf0[14], cos_bit);
+  bf1[15] = bf0[15];
+  bf1[16] = ClampValue(bf0[16] + bf0[19], clamp_lo, clamp_hi);
+  bf1[17] = ClampValue(bf0[17] + bf0[18], clamp_lo, clamp_hi);
+  bf1[18] = ClampValue(bf0[17] - bf0[18], clamp_lo, clamp_hi);
+  bf1[19] = ClampValue(bf0[16] - bf0[19], clamp_lo, clamp_hi);
+  bf1[20] = ClampValue(bf0[23] - bf0[20], clamp_lo, clamp_hi);
+  bf1[21] = ClampValue(bf0[22] - bf0[21], clamp_lo, clamp_hi);
+  bf1[22] = ClampValue(bf0[21] + bf0[22], clamp_lo, clamp_hi);
+  bf1[23] = ClampValue(bf0[20] + bf0[23], clamp_lo, clamp_hi);
+  bf1[24] = ClampValue(bf0[24] + bf0[27], clamp_lo, clamp_hi);
+  bf1[25] = ClampValue(bf0[25] + bf0[26], clamp_lo, clamp_hi);
+  bf1[26] = ClampValue(bf0[25] - bf0[26], clamp_lo, clamp_hi);
+  bf1[27] = ClampValue(bf0[24] - bf0[27], clamp_lo, clamp_hi);
+  bf1[28] = ClampValue(bf0[31] - bf0[28], clamp_lo, clamp_hi);
+  bf1[29] = ClampValue(bf0[30] - bf0[29], clamp_lo, clamp_hi);
+  bf1[30] = ClampValue(bf0[29] + bf0[30], clamp_lo, clamp_hi);
+  bf1[31] = ClampValue(bf0[28] + bf0[31], clamp_lo, clamp_hi);
+  bf1[32] = bf0[32];
+  bf1[33] = bf0[33];
+  bf1[34] = HalfBtf(-cospi[8], bf0[34], cospi[56], bf0[61], cos_bit);
+  bf1[35] = HalfBtf(-cospi[8], bf0[35], cospi[56], bf0[60], cos_bit);
+  bf1[36] = HalfBtf(-cospi[56], bf0[36], -cospi[8], bf0[59], cos_bit);
+  bf1[37] = HalfBtf(-cospi[56], bf0[37], -cospi[8], bf0[58], cos_bit);
+  bf1[38] = bf0[38];
+  bf1[39] = bf0[39];
+  bf1[40] = bf0[40];
+  bf1[41] = bf0[41];
+  bf1[42] = HalfBtf(-cospi[40], bf0[42], cospi[24], bf0[53], cos_bit);
+  bf1[43] = HalfBtf(-cospi[40], bf0[43], cospi[24], bf0[52], cos_bit);
+  bf1[44] = HalfBtf(-cospi[24], bf0[44], -cospi[40], bf0[51], cos_bit);
+  bf1[45] = HalfBtf(-cospi[24], bf0[45], -cospi[40], bf0[50], cos_bit);
+  bf1[46] = bf0[46];
+  bf1[47] = bf0[47];
+  bf1[48] = bf0[48];
+  bf1[49] = bf0[49];
+  bf1[50] = HalfBtf(-cospi[40], bf0[45], cospi[24], bf0[50], cos_bit);
+  bf1[51] = HalfBtf(-cospi[40], bf0[44], cospi[24], bf0[51], cos_bit);
+  bf1[52] = HalfBtf(cospi[24], bf0[43], cospi[40], bf0[52], cos_bit);
+  bf1[53] = HalfBtf(cospi[24], bf0[42], cospi[40], bf0[53], cos_bit);
+  bf1[54] = bf0[54];
+  bf1[55] = bf0[55];
+  bf1[56] = bf0[56];
+  bf1[57] = bf0[57];
+  bf1[58] = HalfBtf(-cospi[8], bf0[37], cospi[56], bf0[58], cos_bit);
+  bf1[59] = HalfBtf(-cospi[8], bf0[36], cospi[56], bf0[59], cos_bit);
+  bf1[60] = HalfBtf(cospi[56], bf0[35], cospi[8], bf0[60], cos_bit);
+  bf1[61] = HalfBtf(cospi[56], bf0[34], cospi[8], bf0[61], cos_bit);
+  bf1[62] = bf0[62];
+  bf1[63] = bf0[63];
+
+  // stage 7
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = ClampValue(bf0[0] + bf0[3], clamp_lo, clamp_hi);
+  bf1[1] = ClampValue(bf0[1] + bf0[2], clamp_lo, clamp_hi);
+  bf1[2] = ClampValue(bf0[1] - bf0[2], clamp_lo, clamp_hi);
+  bf1[3] = ClampValue(bf0[0] - bf0[3], clamp_lo, clamp_hi);
+  bf1[4] = bf0[4];
+  bf1[5] = HalfBtf(-cospi[32], bf0[5], cospi[32], bf0[6], cos_bit);
+  bf1[6] = HalfBtf(cospi[32], bf0[5], cospi[32], bf0[6], cos_bit);
+  bf1[7] = bf0[7];
+  bf1[8] = ClampValue(bf0[8] + bf0[11], clamp_lo, clamp_hi);
+  bf1[9] = ClampValue(bf0[9] + bf0[10], clamp_lo, clamp_hi);
+  bf1[10] = ClampValue(bf0[9] - bf0[10], clamp_lo, clamp_hi);
+  bf1[11] = ClampValue(bf0[8] - bf0[11], clamp_lo, clamp_hi);
+  bf1[12] = ClampValue(bf0[15] - bf0[12], clamp_lo, clamp_hi);
+  bf1[13] = ClampValue(bf0[14] - bf0[13], clamp_lo, clamp_hi);
+  bf1[14] = ClampValue(bf0[13] + bf0[14], clamp_lo, clamp_hi);
+  bf1[15] = ClampValue(bf0[12] + bf0[15], clamp_lo, clamp_hi);
+  bf1[16] = bf0[16];
+  bf1[17] = bf0[17];
+  bf1[18] = HalfBtf(-cospi[16], bf0[18], cospi[48], bf0[29], cos_bit);
+  bf1[19] = HalfBtf(-cospi[16], bf0[19], cospi[48], bf0[28], cos_bit);
+  bf1[20] = HalfBtf(-cospi[48], bf0[20], -cospi[16], bf0[27], cos_bit);
+  bf1[21] = HalfBtf(-cospi[48], bf0[21], -cospi[16], bf0[26], cos_bit);
+  bf1[22] = bf0[22];
+  bf1[23] = bf0[23];
+  bf1[24] = bf0[24];
+  bf1[25] = bf0[25];
+  bf1[26] = HalfBtf(-cospi[16], bf0[21], cospi[48], bf0[26], cos_bit);
+  bf1[27] = HalfBtf(-cospi[16], bf0[20], cospi[48], bf0[27], cos_bit);
+  bf1[28] = HalfBtf(cospi[48], bf0[19], cospi[16], bf0[28], cos_bit);
+  bf1[29] = HalfBtf(cospi[48], bf0[18], cospi[16], bf0[29], cos_bit);
+  bf1[30] = bf0[30];
+  bf1[31] = bf0[31];
+  bf1[32] = ClampValue(bf0[32] + bf0[39], clamp_lo, clamp_hi);
+  bf1[33] = ClampValue(bf0[33] + bf0[38], clamp_lo, clamp_hi);
+  bf1[34] = ClampValue(bf0[34] + bf0[37], clamp_lo, clamp_hi);
+  bf1[35] = ClampValue(bf0[35] + bf0[36], clamp_lo, clamp_hi);
+  bf1[36] = ClampValue(bf0[35] - bf0[36], clamp_lo, clamp_hi);
+  bf1[37] = ClampValue(bf0[34] - bf0[37], clamp_lo, clamp_hi);
+  bf1[38] = ClampValue(bf0[33] - bf0[38], clamp_lo, clamp_hi);
+  bf1[39] = ClampValue(bf0[32] - bf0[39], clamp_lo, clamp_hi);
+  bf1[40] = ClampValue(bf0[47] - bf0[40], clamp_lo, clamp_hi);
+  bf1[41] = ClampValue(bf0[46] - bf0[41], clamp_lo, clamp_hi);
+  bf1[42] = ClampValue(bf0[45] - bf0[42], clamp_lo, clamp_hi);
+  bf1[43] = ClampValue(bf0[44] - bf0[43], clamp_lo, clamp_hi);
+  bf1[44] = ClampValue(bf0[43] + bf0[44], clamp_lo, clamp_hi);
+  bf1[45] = ClampValue(bf0[42] + bf0[45], clamp_lo, clamp_hi);
+  bf1[46] = ClampValue(bf0[41] + bf0[46], clamp_lo, clamp_hi);
+  bf1[47] = ClampValue(bf0[40] + bf0[47], clamp_lo, clamp_hi);
+  bf1[48] = ClampValue(bf0[48] + bf0[55], clamp_lo, clamp_hi);
+  bf1[49] = ClampValue(bf0[49] + bf0[54], clamp_lo, clamp_hi);
+  bf1[50] = ClampValue(bf0[50] + bf0[53], clamp_lo, clamp_hi);
+  bf1[51] = ClampValue(bf0[51] + bf0[52], clamp_lo, clamp_hi);
+  bf1[52] = ClampValue(bf0[51] - bf0[52], clamp_lo, clamp_hi);
+  bf1[53] = ClampValue(bf0[50] - bf0[53], clamp_lo, clamp_hi);
+  bf1[54] = ClampValue(bf0[49] - bf0[54], clamp_lo, clamp_hi);
+  bf1[55] = ClampValue(bf0[48] - bf0[55], clamp_lo, clamp_hi);
+  bf1[56] = ClampValue(bf0[63] - bf0[56], clamp_lo, clamp_hi);
+  bf1[57] = ClampValue(bf0[62] - bf0[57], clamp_lo, clamp_hi);
+  bf1[58] = ClampValue(bf0[61] - bf0[58], clamp_lo, clamp_hi);
+  bf1[59] = ClampValue(bf0[60] - bf0[59], clamp_lo, clamp_hi);
+  bf1[60] = ClampValue(bf0[59] + bf0[60], clamp_lo, clamp_hi);
+  bf1[61] = ClampValue(bf0[58] + bf0[61], clamp_lo, clamp_hi);
+  bf1[62] = ClampValue(bf0[57] + bf0[62], clamp_lo, clamp_hi);
+  bf1[63] = ClampValue(bf0[56] + bf0[63], clamp_lo, clamp_hi);
+
+  // stage 8
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = ClampValue(bf0[0] + bf0[7], clamp_lo, clamp_hi);
+  bf1[1] = ClampValue(bf0[1] + bf0[6], clamp_lo, clamp_hi);
+  bf1[2] = ClampValue(bf0[2] + bf0[5], clamp_lo, clamp_hi);
+  bf1[3] = ClampValue(bf0[3] + bf0[4], clamp_lo, clamp_hi);
+  bf1[4] = ClampValue(bf0[3] - bf0[4], clamp_lo, clamp_hi);
+  bf1[5] = ClampValue(bf0[2] - bf0[5], clamp_lo, clamp_hi);
+  bf1[6] = ClampValue(bf0[1] - bf0[6], clamp_lo, clamp_hi);
+  bf1[7] = ClampValue(bf0[0] - bf0[7], clamp_lo, clamp_hi);
+  bf1[8] = bf0[8];
+  bf1[9] = bf0[9];
+  bf1[10] = HalfBtf(-cospi[32], bf0[10], cospi[32], bf0[13], cos_bit);
+  bf1[11] = HalfBtf(-cospi[32], bf0[11], cospi[32], bf0[12], cos_bit);
+  bf1[12] = HalfBtf(cospi[32], bf0[11], cospi[32], bf0[12], cos_bit);
+  bf1[13] = HalfBtf(cospi[32], bf0[10], cospi[32], bf0[13], cos_bit);
+  bf1[14] = bf0[14];
+  bf1[15] = bf0[15];
+  bf1[16] = ClampValue(bf0[16] + bf0[23], clamp_lo, clamp_hi);
+  bf1[17] = ClampValue(bf0[17] + bf0[22], clamp_lo, clamp_hi);
+  bf1[18] = ClampValue(bf0[18] + bf0[21], clamp_lo, clamp_hi);
+  bf1[19] = ClampValue(bf0[19] + bf0[20], clamp_lo, clamp_hi);
+  bf1[20] = ClampValue(bf0[19] - bf0[20], clamp_lo, clamp_hi);
+  bf1[21] = ClampValue(bf0[18] - bf0[21], clamp_lo, clamp_hi);
+  bf1[22] = ClampValue(bf0[17] - bf0[22], clamp_lo, clamp_hi);
+  bf1[23] = ClampValue(bf0[16] - bf0[23], clamp_lo, clamp_hi);
+  bf1[24] = ClampValue(bf0[31] - bf0[24], clamp_lo, clamp_hi);
+  bf1[25] = ClampValue(bf0[30] - bf0[25], clamp_lo, clamp_hi);
+  bf1[26] = ClampValue(bf0[29] - bf0[26], clamp_lo, clamp_hi);
+  bf1[27] = ClampValue(bf0[28] - bf0[27], clamp_lo, clamp_hi);
+  bf1[28] = ClampValue(bf0[27] + bf0[28], clamp_lo, clamp_hi);
+  bf1[29] = ClampValue(bf0[26] + bf0[29], clamp_lo, clamp_hi);
+  bf1[30] = ClampValue(bf0[25] + bf0[30], clamp_lo, clamp_hi);
+  bf1[31] = ClampValue(bf0[24] + bf0[31], clamp_lo, clamp_hi);
+  bf1[32] = bf0[32];
+  bf1[33] = bf0[33];
+  bf1[34] = bf0[34];
+  bf1[35] = bf0[35];
+  bf1[36] = HalfBtf(-cospi[16], bf0[36], cospi[48], bf0[59], cos_bit);
+  bf1[37] = HalfBtf(-cospi[16], bf0[37], cospi[48], bf0[58], cos_bit);
+  bf1[38] = HalfBtf(-cospi[16], bf0[38], cospi[48], bf0[57], cos_bit);
+  bf1[39] = HalfBtf(-cospi[16], bf0[39], cospi[48], bf0[56], cos_bit);
+  bf1[40] = HalfBtf(-cospi[48], bf0[40], -cospi[16], bf0[55], cos_bit);
+  bf1[41] = HalfBtf(-cospi[48], bf0[41], -cospi[16], bf0[54], cos_bit);
+  bf1[42] = HalfBtf(-cospi[48], bf0[42], -cospi[16], bf0[53], cos_bit);
+  bf1[43] = HalfBtf(-cospi[48], bf0[43], -cospi[16], bf0[52], cos_bit);
+  bf1[44] = bf0[44];
+  bf1[45] = bf0[45];
+  bf1[46] = bf0[46];
+  bf1[47] = bf0[47];
+  bf1[48] = bf0[48];
+  bf1[49] = bf0[49];
+  bf1[50] = bf0[50];
+  bf1[51] = bf0[51];
+  bf1[52] = HalfBtf(-cospi[16], bf0[43], cospi[48], bf0[52], cos_bit);
+  bf1[53] = HalfBtf(-cospi[16], bf0[42], cospi[48], bf0[53], cos_bit);
+  bf1[54] = HalfBtf(-cospi[16], bf0[41], cospi[48], bf0[54], cos_bit);
+  bf1[55] = HalfBtf(-cospi[16], bf0[40], cospi[48], bf0[55], cos_bit);
+  bf1[56] = HalfBtf(cospi[48], bf0[39], cospi[16], bf0[56], cos_bit);
+  bf1[57] = HalfBtf(cospi[48], bf0[38], cospi[16], bf0[57], cos_bit);
+  bf1[58] = HalfBtf(cospi[48], bf0[37], cospi[16], bf0[58], cos_bit);
+  bf1[59] = HalfBtf(cospi[48], bf0[36], cospi[16], bf0[59], cos_bit);
+  bf1[60] = bf0[60];
+  bf1[61] = bf0[61];
+  bf1[62] = bf0[62];
+  bf1[63] = bf0[63];
+
+  // stage 9
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = ClampValue(bf0[0] + bf0[15], clamp_lo, clamp_hi);
+  bf1[1] = ClampValue(bf0[1] + bf0[14], clamp_lo, clamp_hi);
+  bf1[2] = ClampValue(bf0[2] + bf0[13], clamp_lo, clamp_hi);
+  bf1[3] = ClampValue(bf0[3] + bf0[12], clamp_lo, clamp_hi);
+  bf1[4] = ClampValue(bf0[4] + bf0[11], clamp_lo, clamp_hi);
+  bf1[5] = ClampValue(bf0[5] + bf0[10], clamp_lo, clamp_hi);
+  bf1[6] = ClampValue(bf0[6] + bf0[9], clamp_lo, clamp_hi);
+  bf1[7] = ClampValue(bf0[7] + bf0[8], clamp_lo, clamp_hi);
+  bf1[8] = ClampValue(bf0[7] - bf0[8], clamp_lo, clamp_hi);
+  bf1[9] = ClampValue(bf0[6] - bf0[9], clamp_lo, clamp_hi);
+  bf1[10] = ClampValue(bf0[5] - bf0[10], clamp_lo, clamp_hi);
+  bf1[11] = ClampValue(bf0[4] - bf0[11], clamp_lo, clamp_hi);
+  bf1[12] = ClampValue(bf0[3] - bf0[12], clamp_lo, clamp_hi);
+  bf1[13] = ClampValue(bf0[2] - bf0[13], clamp_lo, clamp_hi);
+  bf1[14] = ClampValue(bf0[1] - bf0[14], clamp_lo, clamp_hi);
+  bf1[15] = ClampValue(bf0[0] - bf0[15], clamp_lo, clamp_hi);
+  bf1[16] = bf0[16];
+  bf1[17] = bf0[17];
+  bf1[18] = bf0[18];
+  bf1[19] = bf0[19];
+  bf1[20] = HalfBtf(-cospi[32], bf0[20], cospi[32], bf0[27], cos_bit);
+  bf1[21] = HalfBtf(-cospi[32], bf0[21], cospi[32], bf0[26], cos_bit);
+  bf1[22] = HalfBtf(-cospi[32], bf0[22], cospi[32], bf0[25], cos_bit);
+  bf1[23] = HalfBtf(-cospi[32], bf0[23], cospi[32], bf0[24], cos_bit);
+  bf1[24] = HalfBtf(cospi[32], bf0[23], cospi[32], bf0[24], cos_bit);
+  bf1[25] = HalfBtf(cospi[32], bf0[22], cospi[32], bf0[25], cos_bit);
+  bf1[26] = HalfBtf(cospi[32], bf0[21], cospi[32], bf0[26], cos_bit);
+  bf1[27] = HalfBtf(cospi[32], bf0[20], cospi[32], bf0[27], cos_bit);
+  bf1[28] = bf0[28];
+  bf1[29] = bf0[29];
+  bf1[30] = bf0[30];
+  bf1[31] = bf0[31];
+  bf1[32] = ClampValue(bf0[32] + bf0[47], clamp_lo, clamp_hi);
+  bf1[33] = ClampValue(bf0[33] + bf0[46], clamp_lo, clamp_hi);
+  bf1[34] = ClampValue(bf0[34] + bf0[45], clamp_lo, clamp_hi);
+  bf1[35] = ClampValue(bf0[35] + bf0[44], clamp_lo, clamp_hi);
+  bf1[36] = ClampValue(bf0[36] + bf0[43], clamp_lo, clamp_hi);
+  bf1[37] = ClampValue(bf0[37] + bf0[42], clamp_lo, clamp_hi);
+  bf1[38] = ClampValue(bf0[38] + bf0[41], clamp_lo, clamp_hi);
+  bf1[39] = ClampValue(bf0[39] + bf0[40], clamp_lo, clamp_hi);
+  bf1[40] = ClampValue(bf0[39] - bf0[40], clamp_lo, clamp_hi);
+  bf1[41] = ClampValue(bf0[38] - bf0[41], clamp_lo, clamp_hi);
+  bf1[42] = ClampValue(bf0[37] - bf0[42], clamp_lo, clamp_hi);
+  bf1[43] = ClampValue(bf0[36] - bf0[43], clamp_lo, clamp_hi);
+  bf1[44] = ClampValue(bf0[35] - bf0[44], clamp_lo, clamp_hi);
+  bf1[45] = ClampValue(bf0[34] - bf0[45], clamp_lo, clamp_hi);
+  bf1[46] = ClampValue(bf0[33] - bf0[46], clamp_lo, clamp_hi);
+  bf1[47] = ClampValue(bf0[32] - bf0[47], clamp_lo, clamp_hi);
+  bf1[48] = ClampValue(bf0[63] - bf0[48], clamp_lo, clamp_hi);
+  bf1[49] = ClampValue(bf0[62] - bf0[49], clamp_lo, clamp_hi);
+  bf1[50] = ClampValue(bf0[61] - bf0[50], clamp_lo, clamp_hi);
+  bf1[51] = ClampValue(bf0[60] - bf0[51], clamp_lo, clamp_hi);
+  bf1[52] = ClampValue(bf0[59] - bf0[52], clamp_lo, clamp_hi);
+  bf1[53] = ClampValue(bf0[58] - bf0[53], clamp_lo, clamp_hi);
+  bf1[54] = ClampValue(bf0[57] - bf0[54], clamp_lo, clamp_hi);
+  bf1[55] = ClampValue(bf0[56] - bf0[55], clamp_lo, clamp_hi);
+  bf1[56] = ClampValue(bf0[55] + bf0[56], clamp_lo, clamp_hi);
+  bf1[57] = ClampValue(bf0[54] + bf0[57], clamp_lo, clamp_hi);
+  bf1[58] = ClampValue(bf0[53] + bf0[58], clamp_lo, clamp_hi);
+  bf1[59] = ClampValue(bf0[52] + bf0[59], clamp_lo, clamp_hi);
+  bf1[60] = ClampValue(bf0[51] + bf0[60], clamp_lo, clamp_hi);
+  bf1[61] = ClampValue(bf0[50] + bf0[61], clamp_lo, clamp_hi);
+  bf1[62] = ClampValue(bf0[49] + bf0[62], clamp_lo, clamp_hi);
+  bf1[63] = ClampValue(bf0[48] + bf0[63], clamp_lo, clamp_hi);
+
+  // stage 10
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = ClampValue(bf0[0] + bf0[31], clamp_lo, clamp_hi);
+  bf1[1] = ClampValue(bf0[1] + bf0[30], clamp_lo, clamp_hi);
+  bf1[2] = ClampValue(bf0[2] + bf0[29], clamp_lo, clamp_hi);
+  bf1[3] = ClampValue(bf0[3] + bf0[28], clamp_lo, clamp_hi);
+  bf1[4] = ClampValue(bf0[4] + bf0[27], clamp_lo, clamp_hi);
+  bf1[5] = ClampValue(bf0[5] + bf0[26], clamp_lo, clamp_hi);
+  bf1[6] = ClampValue(bf0[6] + bf0[25], clamp_lo, clamp_hi);
+  bf1[7] = ClampValue(bf0[7] + bf0[24], clamp_lo, clamp_hi);
+  bf1[8] = ClampValue(bf0[8] + bf0[23], clamp_lo, clamp_hi);
+  bf1[9] = ClampValue(bf0[9] + bf0[22], clamp_lo, clamp_hi);
+  bf1[10] = ClampValue(bf0[10] + bf0[21], clamp_lo, clamp_hi);
+  bf1[11] = ClampValue(bf0[11] + bf0[20], clamp_lo, clamp_hi);
+  bf1[12] = ClampValue(bf0[12] + bf0[19], clamp_lo, clamp_hi);
+  bf1[13] = ClampValue(bf0[13] + bf0[18], clamp_lo, clamp_hi);
+  bf1[14] = ClampValue(bf0[14] + bf0[17], clamp_lo, clamp_hi);
+  bf1[15] = ClampValue(bf0[15] + bf0[16], clamp_lo, clamp_hi);
+  bf1[16] = ClampValue(bf0[15] - bf0[16], clamp_lo, clamp_hi);
+  bf1[17] = ClampValue(bf0[14] - bf0[17], clamp_lo, clamp_hi);
+  bf1[18] = ClampValue(bf0[13] - bf0[18], clamp_lo, clamp_hi);
+  bf1[19] = ClampValue(bf0[12] - bf0[19], clamp_lo, clamp_hi);
+  bf1[20] = ClampValue(bf0[11] - bf0[20], clamp_lo, clamp_hi);
+  bf1[21] = ClampValue(bf0[10] - bf0[21], clamp_lo, clamp_hi);
+  bf1[22] = ClampValue(bf0[9] - bf0[22], clamp_lo, clamp_hi);
+  bf1[23] = ClampValue(bf0[8] - bf0[23], clamp_lo, clamp_hi);
+  bf1[24] = ClampValue(bf0[7] - bf0[24], clamp_lo, clamp_hi);
+  bf1[25] = ClampValue(bf0[6] - bf0[25], clamp_lo, clamp_hi);
+  bf1[26] = ClampValue(bf0[5] - bf0[26], clamp_lo, clamp_hi);
+  bf1[27] = ClampValue(bf0[4] - bf0[27], clamp_lo, clamp_hi);
+  bf1[28] = ClampValue(bf0[3] - bf0[28], clamp_lo, clamp_hi);
+  bf1[29] = ClampValue(bf0[2] - bf0[29], clamp_lo, clamp_hi);
+  bf1[30] = ClampValue(bf0[1] - bf0[30], clamp_lo, clamp_hi);
+  bf1[31] = ClampValue(bf0[0] - bf0[31], clamp_lo, clamp_hi);
+  bf1[32] = bf0[32];
+  bf1[33] = bf0[33];
+  bf1[34] = bf0[34];
+  bf1[35] = bf0[35];
+  bf1[36] = bf0[36];
+  bf1[37] = bf0[37];
+  bf1[38] = bf0[38];
+  bf1[39] = bf0[39];
+  bf1[40] = HalfBtf(-cospi[32], bf0[40], cospi[32], bf0[55], cos_bit);
+  bf1[41] = HalfBtf(-cospi[32], bf0[41], cospi[32], bf0[54], cos_bit);
+  bf1[42] = HalfBtf(-cospi[32], bf0[42], cospi[32], bf0[53], cos_bit);
+  bf1[43] = HalfBtf(-cospi[32], bf0[43], cospi[32], bf0[52], cos_bit);
+  bf1[44] = HalfBtf(-cospi[32], bf0[44], cospi[32], bf0[51], cos_bit);
+  bf1[45] = HalfBtf(-cospi[32], bf0[45], cospi[32], bf0[50], cos_bit);
+  bf1[46] = HalfBtf(-cospi[32], bf0[46], cospi[32], bf0[49], cos_bit);
+  bf1[47] = HalfBtf(-cospi[32], bf0[47], cospi[32], bf0[48], cos_bit);
+  bf1[48] = HalfBtf(cospi[32], bf0[47], cospi[32], bf0[48], cos_bit);
+  bf1[49] = HalfBtf(cospi[32], bf0[46], cospi[32], bf0[49], cos_bit);
+  bf1[50] = HalfBtf(cospi[32], bf0[45], cospi[32], bf0[50], cos_bit);
+  bf1[51] = HalfBtf(cospi[32], bf0[44], cospi[32], bf0[51], cos_bit);
+  bf1[52] = HalfBtf(cospi[32], bf0[43], cospi[32], bf0[52], cos_bit);
+  bf1[53] = HalfBtf(cospi[32], bf0[42], cospi[32], bf0[53], cos_bit);
+  bf1[54] = HalfBtf(cospi[32], bf0[41], cospi[32], bf0[54], cos_bit);
+  bf1[55] = HalfBtf(cospi[32], bf0[40], cospi[32], bf0[55], cos_bit);
+  bf1[56] = bf0[56];
+  bf1[57] = bf0[57];
+  bf1[58] = bf0[58];
+  bf1[59] = bf0[59];
+  bf1[60] = bf0[60];
+  bf1[61] = bf0[61];
+  bf1[62] = bf0[62];
+  bf1[63] = bf0[63];
+
+  // stage 11
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = ClampValue(bf0[0] + bf0[63], clamp_lo, clamp_hi);
+  bf1[1] = ClampValue(bf0[1] + bf0[62], clamp_lo, clamp_hi);
+  bf1[2] = ClampValue(bf0[2] + bf0[61], clamp_lo, clamp_hi);
+  bf1[3] = ClampValue(bf0[3] + bf0[60], clamp_lo, clamp_hi);
+  bf1[4] = ClampValue(bf0[4] + bf0[59], clamp_lo, clamp_hi);
+  bf1[5] = ClampValue(bf0[5] + bf0[58], clamp_lo, clamp_hi);
+  bf1[6] = ClampValue(bf0[6] + bf0[57], clamp_lo, clamp_hi);
+  bf1[7] = ClampValue(bf0[7] + bf0[56], clamp_lo, clamp_hi);
+  bf1[8] = ClampValue(bf0[8] + bf0[55], clamp_lo, clamp_hi);
+  bf1[9] = ClampValue(bf0[9] + bf0[54], clamp_lo, clamp_hi);
+  bf1[10] = ClampValue(bf0[10] + bf0[53], clamp_lo, clamp_hi);
+  bf1[11] = ClampValue(bf0[11] + bf0[52], clamp_lo, clamp_hi);
+  bf1[12] = ClampValue(bf0[12] + bf0[51], clamp_lo, clamp_hi);
+  bf1[13] = ClampValue(bf0[13] + bf0[50], clamp_lo, clamp_hi);
+  bf1[14] = ClampValue(bf0[14] + bf0[49], clamp_lo, clamp_hi);
+  bf1[15] = ClampValue(bf0[15] + bf0[48], clamp_lo, clamp_hi);
+  bf1[16] = ClampValue(bf0[16] + bf0[47], clamp_lo, clamp_hi);
+  bf1[17] = ClampValue(bf0[17] + bf0[46], clamp_lo, clamp_hi);
+  bf1[18] = ClampValue(bf0[18] + bf0[45], clamp_lo, clamp_hi);
+  bf1[19] = ClampValue(bf0[19] + bf0[44], clamp_lo, clamp_hi);
+  bf1[20] = ClampValue(bf0[20] + bf0[43], clamp_lo, clamp_hi);
+  bf1[21] = ClampValue(bf0[21] + bf0[42], clamp_lo, clamp_hi);
+  bf1[22] = ClampValue(bf0[22] + bf0[41], clamp_lo, clamp_hi);
+  bf1[23] = ClampValue(bf0[23] + bf0[40], clamp_lo, clamp_hi);
+  bf1[24] = ClampValue(bf0[24] + bf0[39], clamp_lo, clamp_hi);
+  bf1[25] = ClampValue(bf0[25] + bf0[38], clamp_lo, clamp_hi);
+  bf1[26] = ClampValue(bf0[26] + bf0[37], clamp_lo, clamp_hi);
+  bf1[27] = ClampValue(bf0[27] + bf0[36], clamp_lo, clamp_hi);
+  bf1[28] = ClampValue(bf0[28] + bf0[35], clamp_lo, clamp_hi);
+  bf1[29] = ClampValue(bf0[29] + bf0[34], clamp_lo, clamp_hi);
+  bf1[30] = ClampValue(bf0[30] + bf0[33], clamp_lo, clamp_hi);
+  bf1[31] = ClampValue(bf0[31] + bf0[32], clamp_lo, clamp_hi);
+  bf1[32] = ClampValue(bf0[31] - bf0[32], clamp_lo, clamp_hi);
+  bf1[33] = ClampValue(bf0[30] - bf0[33], clamp_lo, clamp_hi);
+  bf1[34] = ClampValue(bf0[29] - bf0[34], clamp_lo, clamp_hi);
+  bf1[35] = ClampValue(bf0[28] - bf0[35], clamp_lo, clamp_hi);
+  bf1[36] = ClampValue(bf0[27] - bf0[36], clamp_lo, clamp_hi);
+  bf1[37] = ClampValue(bf0[26] - bf0[37], clamp_lo, clamp_hi);
+  bf1[38] = ClampValue(bf0[25] - bf0[38], clamp_lo, clamp_hi);
+  bf1[39] = ClampValue(bf0[24] - bf0[39], clamp_lo, clamp_hi);
+  bf1[40] = ClampValue(bf0[23] - bf0[40], clamp_lo, clamp_hi);
+  bf1[41] = ClampValue(bf0[22] - bf0[41], clamp_lo, clamp_hi);
+  bf1[42] = ClampValue(bf0[21] - bf0[42], clamp_lo, clamp_hi);
+  bf1[43] = ClampValue(bf0[20] - bf0[43], clamp_lo, clamp_hi);
+  bf1[44] = ClampValue(bf0[19] - bf0[44], clamp_lo, clamp_hi);
+  bf1[45] = ClampValue(bf0[18] - bf0[45], clamp_lo, clamp_hi);
+  bf1[46] = ClampValue(bf0[17] - bf0[46], clamp_lo, clamp_hi);
+  bf1[47] = ClampValue(bf0[16] - bf0[47], clamp_lo, clamp_hi);
+  bf1[48] = ClampValue(bf0[15] - bf0[48], clamp_lo, clamp_hi);
+  bf1[49] = ClampValue(bf0[14] - bf0[49], clamp_lo, clamp_hi);
+  bf1[50] = ClampValue(bf0[13] - bf0[50], clamp_lo, clamp_hi);
+  bf1[51] = ClampValue(bf0[12] - bf0[51], clamp_lo, clamp_hi);
+  bf1[52] = ClampValue(bf0[11] - bf0[52], clamp_lo, clamp_hi);
+  bf1[53] = ClampValue(bf0[10] - bf0[53], clamp_lo, clamp_hi);
+  bf1[54] = ClampValue(bf0[9] - bf0[54], clamp_lo, clamp_hi);
+  bf1[55] = ClampValue(bf0[8] - bf0[55], clamp_lo, clamp_hi);
+  bf1[56] = ClampValue(bf0[7] - bf0[56], clamp_lo, clamp_hi);
+  bf1[57] = ClampValue(bf0[6] - bf0[57], clamp_lo, clamp_hi);
+  bf1[58] = ClampValue(bf0[5] - bf0[58], clamp_lo, clamp_hi);
+  bf1[59] = ClampValue(bf0[4] - bf0[59], clamp_lo, clamp_hi);
+  bf1[60] = ClampValue(bf0[3] - bf0[60], clamp_lo, clamp_hi);
+  bf1[61] = ClampValue(bf0[2] - bf0[61], clamp_lo, clamp_hi);
+  bf1[62] = ClampValue(bf0[1] - bf0[62], clamp_lo, clamp_hi);
+  bf1[63] = ClampValue(bf0[0] - bf0[63], clamp_lo, clamp_hi);
+}
+
+template <typename V>
+HWY_ATTR HWY_INLINE void Iadst8(const V *input, V *output, int8_t cos_bit,
+                                V clamp_lo, V clamp_hi) {
+  const int32_t *cospi = cospi_arr(cos_bit);
+
+  V *bf0, *bf1;
+  V step[8];
+
+  // stage 1;
+  bf1 = output;
+  bf1[0] = input[7];
+  bf1[1] = input[0];
+  bf1[2] = input[5];
+  bf1[3] = input[2];
+  bf1[4] = input[3];
+  bf1[5] = input[4];
+  bf1[6] = input[1];
+  bf1[7] = input[6];
+
+  // stage 2
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = HalfBtf(cospi[4], bf0[0], cospi[60], bf0[1], cos_bit);
+  bf1[1] = HalfBtf(cospi[60], bf0[0], -cospi[4], bf0[1], cos_bit);
+  bf1[2] = HalfBtf(cospi[20], bf0[2], cospi[44], bf0[3], cos_bit);
+  bf1[3] = HalfBtf(cospi[44], bf0[2], -cospi[20], bf0[3], cos_bit);
+  bf1[4] = HalfBtf(cospi[36], bf0[4], cospi[28], bf0[5], cos_bit);
+  bf1[5] = HalfBtf(cospi[28], bf0[4], -cospi[36], bf0[5], cos_bit);
+  bf1[6] = HalfBtf(cospi[52], bf0[6], cospi[12], bf0[7], cos_bit);
+  bf1[7] = HalfBtf(cospi[12], bf0[6], -cospi[52], bf0[7], cos_bit);
+
+  // stage 3
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = ClampValue(bf0[0] + bf0[4], clamp_lo, clamp_hi);
+  bf1[1] = ClampValue(bf0[1] + bf0[5], clamp_lo, clamp_hi);
+  bf1[2] = ClampValue(bf0[2] + bf0[6], clamp_lo, clamp_hi);
+  bf1[3] = ClampValue(bf0[3] + bf0[7], clamp_lo, clamp_hi);
+  bf1[4] = ClampValue(bf0[0] - bf0[4], clamp_lo, clamp_hi);
+  bf1[5] = ClampValue(bf0[1] - bf0[5], clamp_lo, clamp_hi);
+  bf1[6] = ClampValue(bf0[2] - bf0[6], clamp_lo, clamp_hi);
+  bf1[7] = ClampValue(bf0[3] - bf0[7], clamp_lo, clamp_hi);
+
+  // stage 4
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = bf0[0];
+  bf1[1] = bf0[1];
+  bf1[2] = bf0[2];
+  bf1[3] = bf0[3];
+  bf1[4] = HalfBtf(cospi[16], bf0[4], cospi[48], bf0[5], cos_bit);
+  bf1[5] = HalfBtf(cospi[48], bf0[4], -cospi[16], bf0[5], cos_bit);
+  bf1[6] = HalfBtf(-cospi[48], bf0[6], cospi[16], bf0[7], cos_bit);
+  bf1[7] = HalfBtf(cospi[16], bf0[6], cospi[48], bf0[7], cos_bit);
+
+  // stage 5
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = ClampValue(bf0[0] + bf0[2], clamp_lo, clamp_hi);
+  bf1[1] = ClampValue(bf0[1] + bf0[3], clamp_lo, clamp_hi);
+  bf1[2] = ClampValue(bf0[0] - bf0[2], clamp_lo, clamp_hi);
+  bf1[3] = ClampValue(bf0[1] - bf0[3], clamp_lo, clamp_hi);
+  bf1[4] = ClampValue(bf0[4] + bf0[6], clamp_lo, clamp_hi);
+  bf1[5] = ClampValue(bf0[5] + bf0[7], clamp_lo, clamp_hi);
+  bf1[6] = ClampValue(bf0[4] - bf0[6], clamp_lo, clamp_hi);
+  bf1[7] = ClampValue(bf0[5] - bf0[7], clamp_lo, clamp_hi);
+
+  // stage 6
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = bf0[0];
+  bf1[1] = bf0[1];
+  bf1[2] = HalfBtf(cospi[32], bf0[2], cospi[32], bf0[3], cos_bit);
+  bf1[3] = HalfBtf(cospi[32], bf0[2], -cospi[32], bf0[3], cos_bit);
+  bf1[4] = bf0[4];
+  bf1[5] = bf0[5];
+  bf1[6] = HalfBtf(cospi[32], bf0[6], cospi[32], bf0[7], cos_bit);
+  bf1[7] = HalfBtf(cospi[32], bf0[6], -cospi[32], bf0[7], cos_bit);
+
+  // stage 7
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = bf0[0];
+  bf1[1] = hn::Neg(bf0[4]);
+  bf1[2] = bf0[6];
+  bf1[3] = hn::Neg(bf0[2]);
+  bf1[4] = bf0[3];
+  bf1[5] = hn::Neg(bf0[7]);
+  bf1[6] = bf0[5];
+  bf1[7] = hn::Neg(bf0[1]);
+}
+
+template <typename V>
+HWY_ATTR HWY_INLINE void Iadst16(const V *input, V *output, int8_t cos_bit,
+                                 V clamp_lo, V clamp_hi) {
+  const int32_t *cospi = cospi_arr(cos_bit);
+
+  V *bf0, *bf1;
+  V step[16];
+
+  // stage 1;
+  bf1 = output;
+  bf1[0] = input[15];
+  bf1[1] = input[0];
+  bf1[2] = input[13];
+  bf1[3] = input[2];
+  bf1[4] = input[11];
+  bf1[5] = input[4];
+  bf1[6] = input[9];
+  bf1[7] = input[6];
+  bf1[8] = input[7];
+  bf1[9] = input[8];
+  bf1[10] = input[5];
+  bf1[11] = input[10];
+  bf1[12] = input[3];
+  bf1[13] = input[12];
+  bf1[14] = input[1];
+  bf1[15] = input[14];
+
+  // stage 2
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = HalfBtf(cospi[2], bf0[0], cospi[62], bf0[1], cos_bit);
+  bf1[1] = HalfBtf(cospi[62], bf0[0], -cospi[2], bf0[1], cos_bit);
+  bf1[2] = HalfBtf(cospi[10], bf0[2], cospi[54], bf0[3], cos_bit);
+  bf1[3] = HalfBtf(cospi[54], bf0[2], -cospi[10], bf0[3], cos_bit);
+  bf1[4] = HalfBtf(cospi[18], bf0[4], cospi[46], bf0[5], cos_bit);
+  bf1[5] = HalfBtf(cospi[46], bf0[4], -cospi[18], bf0[5], cos_bit);
+  bf1[6] = HalfBtf(cospi[26], bf0[6], cospi[38], bf0[7], cos_bit);
+  bf1[7] = HalfBtf(cospi[38], bf0[6], -cospi[26], bf0[7], cos_bit);
+  bf1[8] = HalfBtf(cospi[34], bf0[8], cospi[30], bf0[9], cos_bit);
+  bf1[9] = HalfBtf(cospi[30], bf0[8], -cospi[34], bf0[9], cos_bit);
+  bf1[10] = HalfBtf(cospi[42], bf0[10], cospi[22], bf0[11], cos_bit);
+  bf1[11] = HalfBtf(cospi[22], bf0[10], -cospi[42], bf0[11], cos_bit);
+  bf1[12] = HalfBtf(cospi[50], bf0[12], cospi[14], bf0[13], cos_bit);
+  bf1[13] = HalfBtf(cospi[14], bf0[12], -cospi[50], bf0[13], cos_bit);
+  bf1[14] = HalfBtf(cospi[58], bf0[14], cospi[6], bf0[15], cos_bit);
+  bf1[15] = HalfBtf(cospi[6], bf0[14], -cospi[58], bf0[15], cos_bit);
+
+  // stage 3
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = ClampValue(bf0[0] + bf0[8], clamp_lo, clamp_hi);
+  bf1[1] = ClampValue(bf0[1] + bf0[9], clamp_lo, clamp_hi);
+  bf1[2] = ClampValue(bf0[2] + bf0[10], clamp_lo, clamp_hi);
+  bf1[3] = ClampValue(bf0[3] + bf0[11], clamp_lo, clamp_hi);
+  bf1[4] = ClampValue(bf0[4] + bf0[12], clamp_lo, clamp_hi);
+  bf1[5] = ClampValue(bf0[5] + bf0[13], clamp_lo, clamp_hi);
+  bf1[6] = ClampValue(bf0[6] + bf0[14], clamp_lo, clamp_hi);
+  bf1[7] = ClampValue(bf0[7] + bf0[15], clamp_lo, clamp_hi);
+  bf1[8] = ClampValue(bf0[0] - bf0[8], clamp_lo, clamp_hi);
+  bf1[9] = ClampValue(bf0[1] - bf0[9], clamp_lo, clamp_hi);
+  bf1[10] = ClampValue(bf0[2] - bf0[10], clamp_lo, clamp_hi);
+  bf1[11] = ClampValue(bf0[3] - bf0[11], clamp_lo, clamp_hi);
+  bf1[12] = ClampValue(bf0[4] - bf0[12], clamp_lo, clamp_hi);
+  bf1[13] = ClampValue(bf0[5] - bf0[13], clamp_lo, clamp_hi);
+  bf1[14] = ClampValue(bf0[6] - bf0[14], clamp_lo, clamp_hi);
+  bf1[15] = ClampValue(bf0[7] - bf0[15], clamp_lo, clamp_hi);
+
+  // stage 4
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = bf0[0];
+  bf1[1] = bf0[1];
+  bf1[2] = bf0[2];
+  bf1[3] = bf0[3];
+  bf1[4] = bf0[4];
+  bf1[5] = bf0[5];
+  bf1[6] = bf0[6];
+  bf1[7] = bf0[7];
+  bf1[8] = HalfBtf(cospi[8], bf0[8], cospi[56], bf0[9], cos_bit);
+  bf1[9] = HalfBtf(cospi[56], bf0[8], -cospi[8], bf0[9], cos_bit);
+  bf1[10] = HalfBtf(cospi[40], bf0[10], cospi[24], bf0[11], cos_bit);
+  bf1[11] = HalfBtf(cospi[24], bf0[10], -cospi[40], bf0[11], cos_bit);
+  bf1[12] = HalfBtf(-cospi[56], bf0[12], cospi[8], bf0[13], cos_bit);
+  bf1[13] = HalfBtf(cospi[8], bf0[12], cospi[56], bf0[13], cos_bit);
+  bf1[14] = HalfBtf(-cospi[24], bf0[14], cospi[40], bf0[15], cos_bit);
+  bf1[15] = HalfBtf(cospi[40], bf0[14], cospi[24], bf0[15], cos_bit);
+
+  // stage 5
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = ClampValue(bf0[0] + bf0[4], clamp_lo, clamp_hi);
+  bf1[1] = ClampValue(bf0[1] + bf0[5], clamp_lo, clamp_hi);
+  bf1[2] = ClampValue(bf0[2] + bf0[6], clamp_lo, clamp_hi);
+  bf1[3] = ClampValue(bf0[3] + bf0[7], clamp_lo, clamp_hi);
+  bf1[4] = ClampValue(bf0[0] - bf0[4], clamp_lo, clamp_hi);
+  bf1[5] = ClampValue(bf0[1] - bf0[5], clamp_lo, clamp_hi);
+  bf1[6] = ClampValue(bf0[2] - bf0[6], clamp_lo, clamp_hi);
+  bf1[7] = ClampValue(bf0[3] - bf0[7], clamp_lo, clamp_hi);
+  bf1[8] = ClampValue(bf0[8] + bf0[12], clamp_lo, clamp_hi);
+  bf1[9] = ClampValue(bf0[9] + bf0[13], clamp_lo, clamp_hi);
+  bf1[10] = ClampValue(bf0[10] + bf0[14], clamp_lo, clamp_hi);
+  bf1[11] = ClampValue(bf0[11] + bf0[15], clamp_lo, clamp_hi);
+  bf1[12] = ClampValue(bf0[8] - bf0[12], clamp_lo, clamp_hi);
+  bf1[13] = ClampValue(bf0[9] - bf0[13], clamp_lo, clamp_hi);
+  bf1[14] = ClampValue(bf0[10] - bf0[14], clamp_lo, clamp_hi);
+  bf1[15] = ClampValue(bf0[11] - bf0[15], clamp_lo, clamp_hi);
+
+  // stage 6
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = bf0[0];
+  bf1[1] = bf0[1];
+  bf1[2] = bf0[2];
+  bf1[3] = bf0[3];
+  bf1[4] = HalfBtf(cospi[16], bf0[4], cospi[48], bf0[5], cos_bit);
+  bf1[5] = HalfBtf(cospi[48], bf0[4], -cospi[16], bf0[5], cos_bit);
+  bf1[6] = HalfBtf(-cospi[48], bf0[6], cospi[16], bf0[7], cos_bit);
+  bf1[7] = HalfBtf(cospi[16], bf0[6], cospi[48], bf0[7], cos_bit);
+  bf1[8] = bf0[8];
+  bf1[9] = bf0[9];
+  bf1[10] = bf0[10];
+  bf1[11] = bf0[11];
+  bf1[12] = HalfBtf(cospi[16], bf0[12], cospi[48], bf0[13], cos_bit);
+  bf1[13] = HalfBtf(cospi[48], bf0[12], -cospi[16], bf0[13], cos_bit);
+  bf1[14] = HalfBtf(-cospi[48], bf0[14], cospi[16], bf0[15], cos_bit);
+  bf1[15] = HalfBtf(cospi[16], bf0[14], cospi[48], bf0[15], cos_bit);
+
+  // stage 7
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = ClampValue(bf0[0] + bf0[2], clamp_lo, clamp_hi);
+  bf1[1] = ClampValue(bf0[1] + bf0[3], clamp_lo, clamp_hi);
+  bf1[2] = ClampValue(bf0[0] - bf0[2], clamp_lo, clamp_hi);
+  bf1[3] = ClampValue(bf0[1] - bf0[3], clamp_lo, clamp_hi);
+  bf1[4] = ClampValue(bf0[4] + bf0[6], clamp_lo, clamp_hi);
+  bf1[5] = ClampValue(bf0[5] + bf0[7], clamp_lo, clamp_hi);
+  bf1[6] = ClampValue(bf0[4] - bf0[6], clamp_lo, clamp_hi);
+  bf1[7] = ClampValue(bf0[5] - bf0[7], clamp_lo, clamp_hi);
+  bf1[8] = ClampValue(bf0[8] + bf0[10], clamp_lo, clamp_hi);
+  bf1[9] = ClampValue(bf0[9] + bf0[11], clamp_lo, clamp_hi);
+  bf1[10] = ClampValue(bf0[8] - bf0[10], clamp_lo, clamp_hi);
+  bf1[11] = ClampValue(bf0[9] - bf0[11], clamp_lo, clamp_hi);
+  bf1[12] = ClampValue(bf0[12] + bf0[14], clamp_lo, clamp_hi);
+  bf1[13] = ClampValue(bf0[13] + bf0[15], clamp_lo, clamp_hi);
+  bf1[14] = ClampValue(bf0[12] - bf0[14], clamp_lo, clamp_hi);
+  bf1[15] = ClampValue(bf0[13] - bf0[15], clamp_lo, clamp_hi);
+
+  // stage 8
+  bf0 = output;
+  bf1 = step;
+  bf1[0] = bf0[0];
+  bf1[1] = bf0[1];
+  bf1[2] = HalfBtf(cospi[32], bf0[2], cospi[32], bf0[3], cos_bit);
+  bf1[3] = HalfBtf(cospi[32], bf0[2], -cospi[32], bf0[3], cos_bit);
+  bf1[4] = bf0[4];
+  bf1[5] = bf0[5];
+  bf1[6] = HalfBtf(cospi[32], bf0[6], cospi[32], bf0[7], cos_bit);
+  bf1[7] = HalfBtf(cospi[32], bf0[6], -cospi[32], bf0[7], cos_bit);
+  bf1[8] = bf0[8];
+  bf1[9] = bf0[9];
+  bf1[10] = HalfBtf(cospi[32], bf0[10], cospi[32], bf0[11], cos_bit);
+  bf1[11] = HalfBtf(cospi[32], bf0[10], -cospi[32], bf0[11], cos_bit);
+  bf1[12] = bf0[12];
+  bf1[13] = bf0[13];
+  bf1[14] = HalfBtf(cospi[32], bf0[14], cospi[32], bf0[15], cos_bit);
+  bf1[15] = HalfBtf(cospi[32], bf0[14], -cospi[32], bf0[15], cos_bit);
+
+  // stage 9
+  bf0 = step;
+  bf1 = output;
+  bf1[0] = bf0[0];
+  bf1[1] = hn::Neg(bf0[8]);
+  bf1[2] = bf0[12];
+  bf1[3] = hn::Neg(bf0[4]);
+  bf1[4] = bf0[6];
+  bf1[5] = hn::Neg(bf0[14]);
+  bf1[6] = bf0[10];
+  bf1[7] = hn::Neg(bf0[2]);
+  bf1[8] = bf0[3];
+  bf1[9] = hn::Neg(bf0[11]);
+  bf1[10] = bf0[15];
+  bf1[11] = hn::Neg(bf0[7]);
+  bf1[12] = bf0[5];
+  bf1[13] = hn::Neg(bf0[13]);
+  bf1[14] = bf0[9];
+  bf1[15] = hn::Neg(bf0[1]);
+}
+
+template <typename V>
+HWY_ATTR HWY_INLINE void Iadst4(const V *input, V *output, int8_t cos_bit) {
+  const hn::DFromV<V> d;
+  const int32_t *sinpi = sinpi_arr(cos_bit);
+  const V sinpi1 = hn::Set(d, sinpi[1]);
+  const V sinpi2 = hn::Set(d, sinpi[2]);
+  const V sinpi3 = hn::Set(d, sinpi[3]);
+  const V sinpi4 = hn::Set(d, sinpi[4]);
+  const V x0 = input[0];
+  const V x1 = input[1];
+  const V x2 = input[2];
+  const V x3 = input[3];
+
+  // stage 1
+  V s0 = hn::Mul(sinpi1, x0);
+  V s1 = hn::Mul(sinpi2, x0);
+  V s2 = hn::Mul(sinpi3, x1);
+  V s3 = hn::Mul(sinpi4, x2);
+  const V s4 = hn::Mul(sinpi1, x2);
+  const V s5 = hn::Mul(sinpi2, x3);
+  const V s6 = hn::Mul(sinpi4, x3);
+
+  // stage 2
+  const V s7 = hn::Add(hn::Sub(x0, x2), x3);
+
+  // stage 3
+  s0 = hn::Add(s0, s3);
+  s1 = hn::Sub(s1, s4);
+  s3 = s2;
+  s2 = hn::Mul(sinpi3, s7);
+
+  // stage 4
+  s0 = hn::Add(s0, s5);
+  s1 = hn::Sub(s1, s6);
+
+  // stage 5 and 6
+  output[0] = RoundShift(hn::Add(s0, s3), cos_bit);
+  output[1] = RoundShift(hn::Add(s1, s3), cos_bit);
+  output[2] = RoundShift(s2, cos_bit);
+  output[3] = RoundShift(hn::Sub(hn::Add(s0, s1), s3), cos_bit);
+}
+
+// NewSqrt2 is 4096 + 1697, so x * NewSqrt2 rounded by NewSqrt2Bits is
+// x + round(x * 1697). The products stay within 32 bits for the clamped
+// inputs of either pass.
+template <typename V>
+HWY_ATTR HWY_INLINE void Iidentity4(const V *input, V *output) {
+  const hn::DFromV<V> d;
+  const V k = hn::Set(d, NewSqrt2 - (1 << NewSqrt2Bits));
+  for (int i = 0; i < 4; ++i) {
+    output[i] =
+        hn::Add(input[i], RoundShift(hn::Mul(input[i], k), NewSqrt2Bits));
+  }
+}
+
+template <typename V>
+HWY_ATTR HWY_INLINE void Iidentity8(const V *input, V *output) {
+  for (int i = 0; i < 8; ++i) output[i] = hn::Add(input[i], input[i]);
+}
+
+template <typename V>
+HWY_ATTR HWY_INLINE void Iidentity16(const V *input, V *output) {
+  const hn::DFromV<V> d;
+  const V k = hn::Set(d, 2 * (NewSqrt2 - (1 << NewSqrt2Bits)));
+  for (int i = 0; i < 16; ++i) {
+    output[i] = hn::Add(hn::Add(input[i], input[i]),
+                        RoundShift(hn::Mul(input[i], k), NewSqrt2Bits));
+  }
+}
+
+template <typename V>
+HWY_ATTR HWY_INLINE void Iidentity32(const V *input, V *output) {
+  for (int i = 0; i < 32; ++i) output[i] = hn::ShiftLeft<2>(input[i]);
+}
+
+// Runs the 1D transform of type txfm_type and length Length.
+template <int Length>
+struct InverseTransform1D {};
+
+template <>
+struct InverseTransform1D<4> {
+  template <typename V>
+  HWY_ATTR HWY_INLINE static void Run(int txfm_type, const V *in, V *out,
+                                      int8_t cos_bit, V lo, V hi) {
+    switch (txfm_type) {
+      case TXFM_TYPE_DCT4: Idct4(in, out, cos_bit, lo, hi); break;
+      case TXFM_TYPE_ADST4: Iadst4(in, out, cos_bit); break;
+      default:
+        assert(txfm_type == TXFM_TYPE_IDENTITY4);
+        Iidentity4(in, out);
+        break;
+    }
+  }
+};
+
+template <>
+struct InverseTransform1D<8> {
+  template <typename V>
+  HWY_ATTR HWY_INLINE static void Run(int txfm_type, const V *in, V *out,
+                                      int8_t cos_bit, V lo, V hi) {
+    switch (txfm_type) {
+      case TXFM_TYPE_DCT8: Idct8(in, out, cos_bit, lo, hi); break;
+      case TXFM_TYPE_ADST8: Iadst8(in, out, cos_bit, lo, hi); break;
+      default:
+        assert(txfm_type == TXFM_TYPE_IDENTITY8);
+        Iidentity8(in, out);
+        break;
+    }
+  }
+};
+
+template <>
+struct InverseTransform1D<16> {
+  template <typename V>
+  HWY_ATTR HWY_INLINE static void Run(int txfm_type, const V *in, V *out,
+                                      int8_t cos_bit, V lo, V hi) {
+    switch (txfm_type) {
+      case TXFM_TYPE_DCT16: Idct16(in, out, cos_bit, lo, hi); break;
+      case TXFM_TYPE_ADST16: Iadst16(in, out, cos_bit, lo, hi); break;
+      default:
+        assert(txfm_type == TXFM_TYPE_IDENTITY16);
+        Iidentity16(in, out);
+        break;
+    }
+  }
+};
+
+template <>
+struct InverseTransform1D<32> {
+  template <typename V>
+  HWY_ATTR HWY_INLINE static void Run(int txfm_type, const V *in, V *out,
+                                      int8_t cos_bit, V lo, V hi) {
+    if (txfm_type == TXFM_TYPE_DCT32) {
+      Idct32(in, out, cos_bit, lo, hi);
+    } else {
+      assert(txfm_type == TXFM_TYPE_IDENTITY32);
+      Iidentity32(in, out);
+    }
+  }
+};
+
+template <>
+struct InverseTransform1D<64> {
+  template <typename V>
+  HWY_ATTR HWY_INLINE static void Run(int txfm_type, const V *in, V *out,
+                                      int8_t cos_bit, V lo, V hi) {
+    assert(txfm_type == TXFM_TYPE_DCT64);
+    (void)txfm_type;
+    Idct64(in, out, cos_bit, lo, hi);
+  }
+};
+
+// Adds v to Lanes(d) pixels of out and clips the sums to [0, max].
+template <typename D, typename TOut>
+HWY_ATTR HWY_INLINE void ClipAddStore(D d, hn::VFromD<D> v, hn::VFromD<D> max,
+                                      TOut *HWY_RESTRICT out) {
+  const hn::Rebind<TOut, D> pixel_tag;
+  const auto pixels = hn::PromoteTo(d, hn::LoadU(pixel_tag, out));
+  const auto sum = ClampValue(hn::Add(pixels, v), hn::Zero(d), max);
+  hn::StoreU(hn::DemoteTo(pixel_tag, sum), pixel_tag, out);
+}
+
+// Same as inv_txfm2d_add_c(). The row transforms run with one row per lane
+// straight from the (transposed) coefficients, the column transforms with one
+// column per lane by gathering from the intermediate buffer.
+template <TX_SIZE TxSize, int kWidth, int kHeight, typename TOut>
+HWY_ATTR void InverseTransform2D(const int32_t *HWY_RESTRICT input,
+                                 TOut *HWY_RESTRICT output, int stride,
+                                 TX_TYPE tx_type, int bd) {
+  // Only the top-left 32x32 coefficients of 64-point transforms are coded.
+  constexpr int kInputWidth = kWidth < 32 ? kWidth : 32;
+  constexpr int kInputHeight = kHeight < 32 ? kHeight : 32;
+  constexpr bool kApplyRectScale =
+      kWidth == 2 * kHeight || kHeight == 2 * kWidth;
+  constexpr hn::CappedTag<int32_t, kHeight> row_tag;
+  constexpr hn::CappedTag<int32_t, kWidth> col_tag;
+  using RowVec = hn::VFromD<decltype(row_tag)>;
+  using ColVec = hn::VFromD<decltype(col_tag)>;
+
+  TXFM_2D_FLIP_CFG cfg;
+  av1_get_inv_txfm_cfg(tx_type, TxSize, &cfg);
+  const int row_shift = -cfg.shift[0];
+  const int col_shift = -cfg.shift[1];
+  const int row_range = bd + 8;
+  const int col_range = AOMMAX(bd + 6, 16);
+
+  HWY_ALIGN int32_t buf[kWidth * kHeight];
+  {
+    const RowVec row_lo = hn::Set(row_tag, -(1 << (row_range - 1)));
+    const RowVec row_hi = hn::Set(row_tag, (1 << (row_range - 1)) - 1);
+    const RowVec col_lo = hn::Set(row_tag, -(1 << (col_range - 1)));
+    const RowVec col_hi = hn::Set(row_tag, (1 << (col_range - 1)) - 1);
+    const RowVec zero = hn::Zero(row_tag);
+    RowVec in[kWidth];
+    RowVec out[kWidth];
+    for (int r = 0; r < kHeight; r += static_cast<int>(hn::Lanes(row_tag))) {
+      RowVec any_nonzero = zero;
+      for (int c = 0; c < kWidth; ++c) {
+        if (c < kInputWidth && r < kInputHeight) {
+          in[c] = hn::LoadU(row_tag, input + c * kInputHeight + r);
+          any_nonzero = hn::Or(any_nonzero, in[c]);
+        } else {
+          in[c] = zero;
+        }
+      }
+      if (hn::AllTrue(row_tag, hn::Eq(any_nonzero, zero))) {
+        // The transform of an all-zero row is zero.
+        for (int c = 0; c < kWidth; ++c) out[c] = zero;
+      } else {
+        for (int c = 0; c < kInputWidth; ++c) {
+          if CONSTEXPR_IF (kApplyRectScale) {
+            // NewInvSqrt2 is 181 << 4, which keeps the product in 32 bits.
+            in[c] = hn::ShiftRight<NewSqrt2Bits - 4>(
+                hn::MulAdd(in[c], hn::Set(row_tag, NewInvSqrt2 >> 4),
+                           hn::Set(row_tag, 1 << (NewSqrt2Bits - 5))));
+          }
+          in[c] = ClampValue(in[c], row_lo, row_hi);
+        }
+        InverseTransform1D<kWidth>::Run(cfg.txfm_type_row, in, out,
+                                        cfg.cos_bit_row, row_lo, row_hi);
+        for (int c = 0; c < kWidth; ++c) {
+          if (row_shift > 0) out[c] = RoundShift(out[c], row_shift);
+          out[c] = ClampValue(out[c], col_lo, col_hi);
+        }
+      }
+      for (int c = 0; c < kWidth; ++c) {
+        const int col = cfg.lr_flip ? kWidth - 1 - c : c;
+        hn::Store(out[c], row_tag, buf + col * kHeight + r);
+      }
+    }
+  }
+
+  const ColVec col_lo = hn::Set(col_tag, -(1 << (col_range - 1)));
+  const ColVec col_hi = hn::Set(col_tag, (1 << (col_range - 1)) - 1);
+  const ColVec max_pixel = hn::Set(col_tag, (1 << bd) - 1);
+  const auto gather_index =
+      hn::Mul(hn::Iota(col_tag, 0), hn::Set(col_tag, kHeight));
+  ColVec in[kHeight];
+  ColVec out[kHeight];
+  for (int c = 0; c < kWidth; c += static_cast<int>(hn::Lanes(col_tag))) {
+    for (int r = 0; r < kHeight; ++r) {
+      in[r] = hn::GatherIndex(col_tag, buf + c * kHeight + r, gather_index);
+    }
+    InverseTransform1D<kHeight>::Run(cfg.txfm_type_col, in, out,
+                                     cfg.cos_bit_col, col_lo, col_hi);
+    for (int r = 0; r < kHeight; ++r) {
+      const ColVec v = out[cfg.ud_flip ? kHeight - 1 - r : r];
+      ClipAddStore(col_tag, RoundShift(v, col_shift), max_pixel,
+                   output + r * stride + c);
+    }
+  }
+}
+
+template <typename TOut>
+using InverseTransform2DFunction = void (*)(const int32_t *input, TOut *output,
+                                            int stride, TX_TYPE tx_type,
+                                            int bd);
+
+template <typename TOut>
+HWY_ATTR HWY_INLINE InverseTransform2DFunction<TOut> GetInverseTransform2D(
+    TX_SIZE tx_size) {
+  constexpr InverseTransform2DFunction<TOut> kTable[] = {
+#define POINTER(w, h, _) &InverseTransform2D<TX_##w##X##h, w, h, TOut>,
+    FOR_EACH_INV_TXFM2D(POINTER, _)
+#undef POINTER
+  };
+  return kTable[tx_size];
+}
+
+HWY_MAYBE_UNUSED void HighBitdepthInverseTransform(
+    const tran_low_t *input, uint8_t *dest, int stride,
+    const TxfmParam *txfm_param) {
+  assert(av1_ext_tx_used[txfm_param->tx_set_type][txfm_param->tx_type]);
+  if (txfm_param->lossless) {
+    assert(txfm_param->tx_size == TX_4X4 && txfm_param->tx_type == DCT_DCT);
+    av1_highbd_iwht4x4_add(input, dest, stride, txfm_param->eob,
+                           txfm_param->bd);
+    return;
+  }
+  GetInverseTransform2D<uint16_t>(txfm_param->tx_size)(
+      input, CONVERT_TO_SHORTPTR(dest), stride, txfm_param->tx_type,
+      txfm_param->bd);
+}
+
+HWY_MAYBE_UNUSED void LowBitdepthInverseTransform(const int32_t *input,
+                                                  uint8_t *output, int stride,
+                                                  TX_TYPE tx_type,
+                                                  TX_SIZE tx_size) {
+  GetInverseTransform2D<uint8_t>(tx_size)(input, output, stride, tx_type, 8);
+}
+
+}  // namespace HWY_NAMESPACE
+}  // namespace
+
+HWY_AFTER_NAMESPACE();
+
+#define MAKE_HIGHBD_INV_TXFM2D(w, h, suffix)                                  \
+  extern "C" void av1_inv_txfm2d_add_##w##x##h##_##suffix(                    \
+      const int32_t *input, uint16_t *output, int stride, TX_TYPE tx_type,    \
+      int bd);                                                                \
+  HWY_ATTR void av1_inv_txfm2d_add_##w##x##h##_##suffix(                      \
+      const int32_t *input, uint16_t *output, int stride, TX_TYPE tx_type,    \
+      int bd) {                                                               \
+    HWY_NAMESPACE::InverseTransform2D<TX_##w##X##h, w, h, uint16_t>(          \
+        input, output, stride, tx_type, bd);                                  \
+  }
+
+#define MAKE_INV_TXFM_ADD(suffix)                                             \
+  extern "C" void av1_highbd_inv_txfm_add_##suffix(                           \
+      const tran_low_t *input, uint8_t *dest, int stride,                     \
+      const TxfmParam *txfm_param);                                           \
+  HWY_ATTR void av1_highbd_inv_txfm_add_##suffix(                             \
+      const tran_low_t *input, uint8_t *dest, int stride,                     \
+      const TxfmParam *txfm_param) {                                          \
+    HWY_NAMESPACE::HighBitdepthInverseTransform(input, dest, stride,          \
+                                                txfm_param);                  \
+  }                                                                           \
+  extern "C" void av1_lowbd_inv_txfm2d_add_##suffix(                          \
+      const int32_t *input, uint8_t *output, int stride, TX_TYPE tx_type,     \
+      TX_SIZE tx_size, int eob);                                              \
+  HWY_ATTR void av1_lowbd_inv_txfm2d_add_##suffix(                            \
+      const int32_t *input, uint8_t *output, int stride, TX_TYPE tx_type,     \
+      TX_SIZE tx_size, int eob) {                                             \
+    (void)eob;                                                                \
+    HWY_NAMESPACE::LowBitdepthInverseTransform(input, output, stride,         \
+                                               tx_type, tx_size);             \
+  }                                                                           \
+  extern "C" void av1_inv_txfm_add_##suffix(const tran_low_t *dqcoeff,        \
+                                            uint8_t *dst, int stride,         \
+                                            const TxfmParam *txfm_param);     \
+  HWY_ATTR void av1_inv_txfm_add_##suffix(const tran_low_t *dqcoeff,          \
+                                          uint8_t *dst, int stride,           \
+                                          const TxfmParam *txfm_param) {      \
+    if (txfm_param->lossless) {                                               \
+      av1_inv_txfm_add_c(dqcoeff, dst, stride, txfm_param);                   \
+      return;                                                                 \
+    }                                                                         \
+    HWY_NAMESPACE::LowBitdepthInverseTransform(                               \
+        dqcoeff, dst, stride, txfm_param->tx_type, txfm_param->tx_size);      \
+  }
+
+#endif  // AOM_AV1_COMMON_AV1_INV_TXFM2D_HWY_H_
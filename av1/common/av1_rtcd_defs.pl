@@ -126,7 +126,7 @@ specialize qw/av1_dr_prediction_z3 sse4_1 avx2 neon/;
 
 # FILTER_INTRA predictor functions
 add_proto qw/void av1_filter_intra_predictor/, "uint8_t *dst, ptrdiff_t stride, TX_SIZE tx_size, const uint8_t *above, const uint8_t *left, int mode";
-specialize qw/av1_filter_intra_predictor sse4_1 neon neon_i8mm/;
+specialize qw/av1_filter_intra_predictor sse4_1 avx2 neon neon_i8mm/;
 
 # High bitdepth functions
 
@@ -220,6 +220,30 @@ add_proto qw/void av1_inv_txfm2d_add_16x4/, "const int32_t *input, uint16_t *out
 add_proto qw/void av1_inv_txfm2d_add_8x32/, "const int32_t *input, uint16_t *output, int stride, TX_TYPE tx_type, int bd";
 add_proto qw/void av1_inv_txfm2d_add_32x8/, "const int32_t *input, uint16_t *output, int stride, TX_TYPE tx_type, int bd";
 
+if (aom_config("CONFIG_HIGHWAY") eq "yes") {
+  specialize qw/av1_inv_txfm_add avx512/;
+  specialize qw/av1_highbd_inv_txfm_add avx512/;
+  specialize qw/av1_inv_txfm2d_add_4x4 avx512/;
+  specialize qw/av1_inv_txfm2d_add_8x8 avx512/;
+  specialize qw/av1_inv_txfm2d_add_16x16 avx512/;
+  specialize qw/av1_inv_txfm2d_add_32x32 avx512/;
+  specialize qw/av1_inv_txfm2d_add_64x64 avx512/;
+  specialize qw/av1_inv_txfm2d_add_4x8 avx512/;
+  specialize qw/av1_inv_txfm2d_add_8x4 avx512/;
+  specialize qw/av1_inv_txfm2d_add_8x16 avx512/;
+  specialize qw/av1_inv_txfm2d_add_16x8 avx512/;
+  specialize qw/av1_inv_txfm2d_add_16x32 avx512/;
+  specialize qw/av1_inv_txfm2d_add_32x16 avx512/;
+  specialize qw/av1_inv_txfm2d_add_32x64 avx512/;
+  specialize qw/av1_inv_txfm2d_add_64x32 avx512/;
+  specialize qw/av1_inv_txfm2d_add_4x16 avx512/;
+  specialize qw/av1_inv_txfm2d_add_16x4 avx512/;
+  specialize qw/av1_inv_txfm2d_add_8x32 avx512/;
+  specialize qw/av1_inv_txfm2d_add_32x8 avx512/;
+  specialize qw/av1_inv_txfm2d_add_16x64 avx512/;
+  specialize qw/av1_inv_txfm2d_add_64x16 avx512/;
+}
+
 if (aom_config("CONFIG_AV1_HIGHBITDEPTH") eq "yes") {
   # directional intra predictor functions
   add_proto qw/void av1_highbd_dr_prediction_z1/, "uint16_t *dst, ptrdiff_t stride, int bw, int bh, const uint16_t *above, const uint16_t *left, int upsample_above, int dx, int dy, int bd";
@@ -255,12 +279,16 @@ specialize qw/av1_resize_and_extend_frame ssse3 neon neon_dotprod neon_i8mm/;
 #
 if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
   add_proto qw/void av1_fdwt8x8_uint8_input/, "const uint8_t *input, tran_low_t *output, int stride, int hbd";
+  specialize qw/av1_fdwt8x8_uint8_input sse2 avx2/;
+
+  add_proto qw/int av1_haar_ac_sad_8x8_uint8_input/, "const uint8_t *input, int stride, int hbd";
+  specialize qw/av1_haar_ac_sad_8x8_uint8_input sse2 avx2/;
 
   # ENCODEMB INVOKE
   add_proto qw/void aom_upsampled_pred/, "MACROBLOCKD *xd, const struct AV1Common *const cm, int mi_row, int mi_col,
                                           const MV *const mv, uint8_t *comp_pred, int width, int height, int subpel_x_q3,
                                           int subpel_y_q3, const uint8_t *ref, int ref_stride, int subpel_search";
-  specialize qw/aom_upsampled_pred neon sse2/;
+  specialize qw/aom_upsampled_pred neon sse2 avx2/;
   #
   #
   #
@@ -268,18 +296,18 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
                                                    const MV *const mv, uint8_t *comp_pred, const uint8_t *pred, int width,
                                                    int height, int subpel_x_q3, int subpel_y_q3, const uint8_t *ref,
                                                    int ref_stride, int subpel_search";
-  specialize qw/aom_comp_avg_upsampled_pred sse2 neon/;
+  specialize qw/aom_comp_avg_upsampled_pred sse2 avx2 neon/;
 
   if (aom_config("CONFIG_AV1_HIGHBITDEPTH") eq "yes") {
     add_proto qw/void aom_highbd_upsampled_pred/, "MACROBLOCKD *xd, const struct AV1Common *const cm, int mi_row, int mi_col,
                                                    const MV *const mv, uint8_t *comp_pred8, int width, int height, int subpel_x_q3,
                                                    int subpel_y_q3, const uint8_t *ref8, int ref_stride, int bd, int subpel_search";
-    specialize qw/aom_highbd_upsampled_pred sse2 neon/;
+    specialize qw/aom_highbd_upsampled_pred sse2 avx2 neon/;
 
     add_proto qw/void aom_highbd_comp_avg_upsampled_pred/, "MACROBLOCKD *xd, const struct AV1Common *const cm, int mi_row, int mi_col,
                                                             const MV *const mv, uint8_t *comp_pred8, const uint8_t *pred8, int width,
                                                             int height, int subpel_x_q3, int subpel_y_q3, const uint8_t *ref8, int ref_stride, int bd, int subpel_search";
-    specialize qw/aom_highbd_comp_avg_upsampled_pred sse2 neon/;
+    specialize qw/aom_highbd_comp_avg_upsampled_pred sse2 avx2 neon/;
   }
 
   # the transform coefficients are held in 32-bit
@@ -397,7 +425,7 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
       specialize qw/av1_highbd_apply_temporal_filter sse2 avx2 neon/;
 
       add_proto qw/double av1_highbd_estimate_noise_from_single_plane/, "const uint16_t *src, int height, int width, int stride, int bit_depth, int edge_thresh";
-      specialize qw/av1_highbd_estimate_noise_from_single_plane neon/;
+      specialize qw/av1_highbd_estimate_noise_from_single_plane avx2 neon/;
     }
   }
 
@@ -409,6 +437,12 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
   add_proto qw/void av1_calc_indices_dim2/, "const int16_t *data, const int16_t *centroids, uint8_t *indices, int64_t *total_dist, int n, int k";
   specialize qw/av1_calc_indices_dim2 sse2 avx2 neon/;
 
+  add_proto qw/int av1_count_colors_row/, "const uint8_t *src, int width, int *val_count";
+  specialize qw/av1_count_colors_row sse2 avx2/;
+
+  add_proto qw/int av1_count_colors_row_highbd/, "const uint16_t *src, int width, int bit_depth, int *val_count, int *bin_val_count";
+  specialize qw/av1_count_colors_row_highbd sse2 avx2/;
+
   # ENCODEMB INVOKE
   if (aom_config("CONFIG_AV1_HIGHBITDEPTH") eq "yes") {
     add_proto qw/int64_t av1_highbd_block_error/, "const tran_low_t *coeff, const tran_low_t *dqcoeff, intptr_t block_size, int64_t *ssz, int bd";
@@ -424,7 +458,7 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
 
   # txb
   add_proto qw/void av1_get_nz_map_contexts/, "const uint8_t *const levels, const int16_t *const scan, const int eob, const TX_SIZE tx_size, const TX_CLASS tx_class, int8_t *const coeff_contexts";
-  specialize qw/av1_get_nz_map_contexts sse2 neon/;
+  specialize qw/av1_get_nz_map_contexts sse2 avx2 neon/;
   add_proto qw/void av1_txb_init_levels/, "const tran_low_t *const coeff, const int width, const int height, uint8_t *const levels";
   specialize qw/av1_txb_init_levels sse4_1 avx2 neon/;
 
@@ -471,21 +505,30 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
   # CNN functions
   if (aom_config("CONFIG_REALTIME_ONLY") ne "yes") {
     add_proto qw/void av1_cnn_activate/, "float **input, int channels, int width, int height, int stride, ACTIVATION layer_activation";
+    specialize qw/av1_cnn_activate avx2/;
     add_proto qw/void av1_cnn_add/, "float **input, int channels, int width, int height, int stride, const float **add";
+    specialize qw/av1_cnn_add avx2/;
     add_proto qw/bool av1_cnn_predict/, "const float **input, int in_width, int in_height, int in_stride, const CNN_CONFIG *cnn_config, const CNN_THREAD_DATA *thread_data, CNN_MULTI_OUT *output_struct";
+    add_proto qw/void av1_cnn_convolve/, "const float **input, int in_width, int in_height, int in_stride, const CNN_LAYER_CONFIG *layer_config, float **output, int out_stride, int start_idx, int step";
+    specialize qw/av1_cnn_convolve avx2/;
     add_proto qw/void av1_cnn_convolve_no_maxpool_padding_valid/, "const float **input, int in_width, int in_height, int in_stride, const CNN_LAYER_CONFIG *layer_config, float **output, int out_stride, int start_idx, int cstep, int channel_step";
     if (aom_config("CONFIG_EXCLUDE_SIMD_MISMATCH") ne "yes") {
       specialize qw/av1_cnn_convolve_no_maxpool_padding_valid avx2/;
     }
     specialize qw/av1_cnn_convolve_no_maxpool_padding_valid neon/;
     add_proto qw/void av1_cnn_deconvolve/, "const float **input, int in_width, int in_height, int in_stride, const CNN_LAYER_CONFIG *layer_config, float **output, int out_stride";
+    specialize qw/av1_cnn_deconvolve avx2/;
     add_proto qw/void av1_cnn_batchnorm/, "float **image, int channels, int width, int height, int stride, const float *gamma, const float *beta, const float *mean, const float *std";
+    specialize qw/av1_cnn_batchnorm avx2/;
   }
 
   # Temporal Denoiser
   if (aom_config("CONFIG_AV1_TEMPORAL_DENOISING") eq "yes") {
     add_proto qw/int av1_denoiser_filter/, "const uint8_t *sig, int sig_stride, const uint8_t *mc_avg, int mc_avg_stride, uint8_t *avg, int avg_stride, int increase_denoising, BLOCK_SIZE bs, int motion_magnitude";
-    specialize qw/av1_denoiser_filter neon sse2/;
+    specialize qw/av1_denoiser_filter neon sse2 avx2/;
+    if (aom_config("CONFIG_AV1_HIGHBITDEPTH") eq "yes") {
+      add_proto qw/int av1_highbd_denoiser_filter/, "const uint16_t *sig, int sig_stride, const uint16_t *mc_avg, int mc_avg_stride, uint16_t *avg, int avg_stride, int increase_denoising, BLOCK_SIZE bs, int motion_magnitude, int bd";
+    }
   }
 }
 # end encoder functions
@@ -495,6 +538,7 @@ if (aom_config("CONFIG_AV1_ENCODER") eq "yes") {
 
 add_proto qw/int cdef_find_dir/, "const uint16_t *img, int stride, int32_t *var, int coeff_shift";
 add_proto qw/void cdef_find_dir_dual/, "const uint16_t *img1, const uint16_t *img2, int stride, int32_t *var1, int32_t *var2, int coeff_shift, int *out1, int *out2";
+add_proto qw/void cdef_find_dir_quad/, "const uint16_t *const img[4], int stride, int32_t *const var[4], int coeff_shift, int *const dir[4]";
 
 # 8 bit dst
 add_proto qw/void cdef_filter_8_0/, "void *dst8, int dstride, const uint16_t *in, int pri_strength, int sec_strength, int dir, int pri_damping, int sec_damping, int coeff_shift, int block_width, int block_height";
@@ -518,6 +562,7 @@ if (aom_config("CONFIG_AV1_HIGHBITDEPTH") eq "yes") {
 if ($opts{config} !~ /libs-x86-win32-vs.*/) {
   specialize qw/cdef_find_dir sse4_1 avx2 neon rvv/, "$ssse3_x86";
   specialize qw/cdef_find_dir_dual sse4_1 avx2 neon/, "$ssse3_x86";
+  specialize qw/cdef_find_dir_quad sse4_1 avx2 neon/, "$ssse3_x86";
 
   specialize qw/cdef_filter_8_0 sse4_1 avx2 neon rvv/, "$ssse3_x86";
   specialize qw/cdef_filter_8_1 sse4_1 avx2 neon rvv/, "$ssse3_x86";
@@ -533,6 +578,19 @@ if ($opts{config} !~ /libs-x86-win32-vs.*/) {
   if (aom_config("CONFIG_AV1_HIGHBITDEPTH") eq "yes") {
     specialize qw/cdef_copy_rect8_16bit_to_16bit sse4_1 avx2 neon rvv/, "$ssse3_x86";
   }
+  if (aom_config("CONFIG_HIGHWAY") eq "yes") {
+    specialize qw/cdef_find_dir_quad avx512/;
+
+    specialize qw/cdef_filter_8_0 avx512/;
+    specialize qw/cdef_filter_8_1 avx512/;
+    specialize qw/cdef_filter_8_2 avx512/;
+    specialize qw/cdef_filter_8_3 avx512/;
+
+    specialize qw/cdef_filter_16_0 avx512/;
+    specialize qw/cdef_filter_16_1 avx512/;
+    specialize qw/cdef_filter_16_2 avx512/;
+    specialize qw/cdef_filter_16_3 avx512/;
+  }
 }
 
 # WARPED_MOTION / GLOBAL_MOTION functions
@@ -625,18 +683,36 @@ if(aom_config("CONFIG_AV1_HIGHBITDEPTH") eq "yes") {
     specialize qw/av1_highbd_convolve_y_sr_intrabc neon rvv/;
     specialize qw/av1_highbd_convolve_2d_scale sse4_1 neon/;
   }
+  if (aom_config("CONFIG_HIGHWAY") eq "yes") {
+    specialize qw/av1_convolve_2d_sr avx512/;
+    specialize qw/av1_convolve_x_sr avx512/;
+    specialize qw/av1_convolve_y_sr avx512/;
+    specialize qw/av1_dist_wtd_convolve_2d avx512/;
+    specialize qw/av1_dist_wtd_convolve_2d_copy avx512/;
+    specialize qw/av1_dist_wtd_convolve_x avx512/;
+    specialize qw/av1_dist_wtd_convolve_y avx512/;
+    if (aom_config("CONFIG_AV1_HIGHBITDEPTH") eq "yes") {
+      specialize qw/av1_highbd_dist_wtd_convolve_2d avx512/;
+      specialize qw/av1_highbd_dist_wtd_convolve_x avx512/;
+      specialize qw/av1_highbd_dist_wtd_convolve_y avx512/;
+      specialize qw/av1_highbd_dist_wtd_convolve_2d_copy avx512/;
+      specialize qw/av1_highbd_convolve_2d_sr avx512/;
+      specialize qw/av1_highbd_convolve_x_sr avx512/;
+      specialize qw/av1_highbd_convolve_y_sr avx512/;
+    }
+  }
 
 # INTRA_EDGE functions
 add_proto qw/void av1_filter_intra_edge/, "uint8_t *p, int sz, int strength";
-specialize qw/av1_filter_intra_edge sse4_1 neon/;
+specialize qw/av1_filter_intra_edge sse4_1 avx2 neon/;
 add_proto qw/void av1_upsample_intra_edge/, "uint8_t *p, int sz";
-specialize qw/av1_upsample_intra_edge sse4_1 neon/;
+specialize qw/av1_upsample_intra_edge sse4_1 avx2 neon/;
 
 if (aom_config("CONFIG_AV1_HIGHBITDEPTH") eq "yes") {
   add_proto qw/void av1_highbd_filter_intra_edge/, "uint16_t *p, int sz, int strength";
-  specialize qw/av1_highbd_filter_intra_edge sse4_1 neon/;
+  specialize qw/av1_highbd_filter_intra_edge sse4_1 avx2 neon/;
   add_proto qw/void av1_highbd_upsample_intra_edge/, "uint16_t *p, int sz, int bd";
-  specialize qw/av1_highbd_upsample_intra_edge sse4_1 neon/;
+  specialize qw/av1_highbd_upsample_intra_edge sse4_1 avx2 neon/;
 }
 
 # CFL
@@ -132,6 +132,14 @@ void cdef_find_dir_dual_c(const uint16_t *img1, const uint16_t *img2,
   *out2 = cdef_find_dir_c(img2, stride, var2, coeff_shift);
 }
 
+void cdef_find_dir_quad_c(const uint16_t *const img[4], int stride,
+                          int32_t *const var[4], int coeff_shift,
+                          int *const dir[4]) {
+  for (int i = 0; i < 4; i++) {
+    *dir[i] = cdef_find_dir_c(img[i], stride, var[i], coeff_shift);
+  }
+}
+
 const int cdef_pri_taps[2][2] = { { 4, 2 }, { 3, 3 } };
 const int cdef_sec_taps[2] = { 2, 1 };
 
@@ -296,10 +304,25 @@ static inline void aom_cdef_find_dir(const uint16_t *in, cdef_list *dlist,
                                      int var[CDEF_NBLOCKS][CDEF_NBLOCKS],
                                      int cdef_count, int coeff_shift,
                                      int dir[CDEF_NBLOCKS][CDEF_NBLOCKS]) {
-  int bi;
+  int bi = 0;
+
+  // Find direction of four 8x8 blocks together.
+  for (; bi < cdef_count - 3; bi += 4) {
+    const uint16_t *img[4];
+    int32_t *var_out[4];
+    int *dir_out[4];
+    for (int i = 0; i < 4; i++) {
+      const int by = dlist[bi + i].by;
+      const int bx = dlist[bi + i].bx;
+      img[i] = &in[8 * by * CDEF_BSTRIDE + 8 * bx];
+      var_out[i] = &var[by][bx];
+      dir_out[i] = &dir[by][bx];
+    }
+    cdef_find_dir_quad(img, CDEF_BSTRIDE, var_out, coeff_shift, dir_out);
+  }
 
   // Find direction of two 8x8 blocks together.
-  for (bi = 0; bi < cdef_count - 1; bi += 2) {
+  for (; bi < cdef_count - 1; bi += 2) {
     const int by = dlist[bi].by;
     const int bx = dlist[bi].bx;
     const int by2 = dlist[bi + 1].by;
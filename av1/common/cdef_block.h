@@ -31,6 +31,10 @@
 #define CDEF_INBUF_SIZE \
   (CDEF_BSTRIDE * ((1 << MAX_SB_SIZE_LOG2) + 2 * CDEF_VBORDER))
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 extern const int cdef_pri_taps[2][2];
 extern const int cdef_sec_taps[2];
 extern const int (*const cdef_directions)[2];
@@ -62,4 +66,8 @@ static inline void fill_rect(uint16_t *dst, int dstride, int v, int h,
     }
   }
 }
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
 #endif  // AOM_AV1_COMMON_CDEF_BLOCK_H_
@@ -0,0 +1,449 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#ifndef AOM_AV1_COMMON_CDEF_BLOCK_HWY_H_
+#define AOM_AV1_COMMON_CDEF_BLOCK_HWY_H_
+
+#include <string.h>
+
+#include "config/aom_config.h"
+#include "config/av1_rtcd.h"
+#include "third_party/highway/hwy/highway.h"
+#include "aom_ports/bitops.h"
+#include "av1/common/cdef_block.h"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace {
+namespace HWY_NAMESPACE {
+
+namespace hn = hwy::HWY_NAMESPACE;
+
+// Every 128-bit block of a vector holds one row of 8 pixels: a row of an 8x8
+// block in the filter, and a row of a different 8x8 block in the direction
+// search. The direction search only moves data within blocks, so it handles
+// as many 8x8 blocks at once as the vector has blocks.
+constexpr hn::CappedTag<int16_t, 32> int16xN_tag;
+constexpr hn::Full128<int16_t> int16x8_tag;
+
+// Loads 8 pixels from each of src[0], src[1], ... into consecutive blocks.
+template <class D>
+HWY_ATTR HWY_INLINE hn::VFromD<D> LoadBlocks(D d,
+                                             const uint16_t *const src[],
+                                             ptrdiff_t offset) {
+  hn::VFromD<D> v = hn::ResizeBitCast(
+      d, hn::LoadU(int16x8_tag, (const int16_t *)src[0] + offset));
+  if constexpr (d.MaxBlocks() >= 2) {
+    v = hn::InsertBlock<1>(
+        v, hn::LoadU(int16x8_tag, (const int16_t *)src[1] + offset));
+  }
+  if constexpr (d.MaxBlocks() >= 4) {
+    v = hn::InsertBlock<2>(
+        v, hn::LoadU(int16x8_tag, (const int16_t *)src[2] + offset));
+    v = hn::InsertBlock<3>(
+        v, hn::LoadU(int16x8_tag, (const int16_t *)src[3] + offset));
+  }
+  return v;
+}
+
+// Loads rows of 8 pixels, one per block.
+template <class D>
+HWY_ATTR HWY_INLINE hn::VFromD<D> LoadRows(D d, const uint16_t *src,
+                                           int stride) {
+  const uint16_t *const rows[4] = { src, src + stride, src + 2 * stride,
+                                    src + 3 * stride };
+  return LoadBlocks(d, rows, 0);
+}
+
+/* partial A is a 16-bit vector of the form:
+   [x8 x7 x6 x5 x4 x3 x2 x1] and partial B has the form:
+   [0  y1 y2 y3 y4 y5 y6 y7].
+   This function computes (x1^2+y1^2)*C1 + (x2^2+y2^2)*C2 + ...
+   (x7^2+y2^7)*C7 + (x8^2+0^2)*C8 in every block, where the C1..C8 constants
+   are in const1 and const2. */
+template <class D>
+HWY_ATTR HWY_INLINE hn::VFromD<hn::Repartition<int32_t, D>> FoldMulAndSum(
+    D d, hn::VFromD<D> partiala, hn::VFromD<D> partialb,
+    hn::VFromD<hn::Repartition<int32_t, D>> const1,
+    hn::VFromD<hn::Repartition<int32_t, D>> const2) {
+  const hn::Repartition<int32_t, D> d32;
+  const hn::Repartition<uint8_t, D> d8;
+  alignas(16) static constexpr uint8_t kReverse[16] = {
+    12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1, 14, 15
+  };
+  /* Reverse partial B. */
+  partialb = hn::BitCast(
+      d, hn::TableLookupBytes(hn::BitCast(d8, partialb),
+                              hn::LoadDup128(d8, kReverse)));
+  /* Interleave the x and y values of identical indices and pair x8 with 0. */
+  const hn::VFromD<D> lo = hn::InterleaveLower(d, partiala, partialb);
+  const hn::VFromD<D> hi = hn::InterleaveUpper(d, partiala, partialb);
+  /* Square and add the corresponding x and y values, and multiply by the
+     constants. */
+  return hn::Add(hn::Mul(hn::WidenMulPairwiseAdd(d32, lo, lo), const1),
+                 hn::Mul(hn::WidenMulPairwiseAdd(d32, hi, hi), const2));
+}
+
+// Returns the sums of the lanes of x0, x1, x2 and x3 in lanes 0, 1, 2 and 3
+// of every block.
+template <class D32>
+HWY_ATTR HWY_INLINE hn::VFromD<D32> Hsum4(D32 d32, hn::VFromD<D32> x0,
+                                          hn::VFromD<D32> x1,
+                                          hn::VFromD<D32> x2,
+                                          hn::VFromD<D32> x3) {
+  const hn::Repartition<int64_t, D32> d64;
+  const auto t0 = hn::BitCast(d64, hn::InterleaveLower(d32, x0, x1));
+  const auto t1 = hn::BitCast(d64, hn::InterleaveLower(d32, x2, x3));
+  const auto t2 = hn::BitCast(d64, hn::InterleaveUpper(d32, x0, x1));
+  const auto t3 = hn::BitCast(d64, hn::InterleaveUpper(d32, x2, x3));
+  return hn::Add(hn::Add(hn::BitCast(d32, hn::InterleaveLower(d64, t0, t1)),
+                         hn::BitCast(d32, hn::InterleaveUpper(d64, t0, t1))),
+                 hn::Add(hn::BitCast(d32, hn::InterleaveLower(d64, t2, t3)),
+                         hn::BitCast(d32, hn::InterleaveUpper(d64, t2, t3))));
+}
+
+/* Computes cost for directions 4, 5, 6 and 7. We can call this function again
+   to compute the remaining directions. */
+template <class D>
+HWY_ATTR HWY_INLINE hn::VFromD<hn::Repartition<int32_t, D>> ComputeDirections(
+    D d, const hn::VFromD<D> lines[8]) {
+  const hn::Repartition<int32_t, D> d32;
+  hn::VFromD<D> partial4a, partial4b, partial5a, partial5b, partial7a,
+      partial7b, partial6, tmp;
+  /* Partial sums for lines 0 and 1. */
+  partial4a = hn::ShiftLeftBytes<14>(d, lines[0]);
+  partial4b = hn::ShiftRightBytes<2>(d, lines[0]);
+  partial4a = hn::Add(partial4a, hn::ShiftLeftBytes<12>(d, lines[1]));
+  partial4b = hn::Add(partial4b, hn::ShiftRightBytes<4>(d, lines[1]));
+  tmp = hn::Add(lines[0], lines[1]);
+  partial5a = hn::ShiftLeftBytes<10>(d, tmp);
+  partial5b = hn::ShiftRightBytes<6>(d, tmp);
+  partial7a = hn::ShiftLeftBytes<4>(d, tmp);
+  partial7b = hn::ShiftRightBytes<12>(d, tmp);
+  partial6 = tmp;
+
+  /* Partial sums for lines 2 and 3. */
+  partial4a = hn::Add(partial4a, hn::ShiftLeftBytes<10>(d, lines[2]));
+  partial4b = hn::Add(partial4b, hn::ShiftRightBytes<6>(d, lines[2]));
+  partial4a = hn::Add(partial4a, hn::ShiftLeftBytes<8>(d, lines[3]));
+  partial4b = hn::Add(partial4b, hn::ShiftRightBytes<8>(d, lines[3]));
+  tmp = hn::Add(lines[2], lines[3]);
+  partial5a = hn::Add(partial5a, hn::ShiftLeftBytes<8>(d, tmp));
+  partial5b = hn::Add(partial5b, hn::ShiftRightBytes<8>(d, tmp));
+  partial7a = hn::Add(partial7a, hn::ShiftLeftBytes<6>(d, tmp));
+  partial7b = hn::Add(partial7b, hn::ShiftRightBytes<10>(d, tmp));
+  partial6 = hn::Add(partial6, tmp);
+
+  /* Partial sums for lines 4 and 5. */
+  partial4a = hn::Add(partial4a, hn::ShiftLeftBytes<6>(d, lines[4]));
+  partial4b = hn::Add(partial4b, hn::ShiftRightBytes<10>(d, lines[4]));
+  partial4a = hn::Add(partial4a, hn::ShiftLeftBytes<4>(d, lines[5]));
+  partial4b = hn::Add(partial4b, hn::ShiftRightBytes<12>(d, lines[5]));
+  tmp = hn::Add(lines[4], lines[5]);
+  partial5a = hn::Add(partial5a, hn::ShiftLeftBytes<6>(d, tmp));
+  partial5b = hn::Add(partial5b, hn::ShiftRightBytes<10>(d, tmp));
+  partial7a = hn::Add(partial7a, hn::ShiftLeftBytes<8>(d, tmp));
+  partial7b = hn::Add(partial7b, hn::ShiftRightBytes<8>(d, tmp));
+  partial6 = hn::Add(partial6, tmp);
+
+  /* Partial sums for lines 6 and 7. */
+  partial4a = hn::Add(partial4a, hn::ShiftLeftBytes<2>(d, lines[6]));
+  partial4b = hn::Add(partial4b, hn::ShiftRightBytes<14>(d, lines[6]));
+  partial4a = hn::Add(partial4a, lines[7]);
+  tmp = hn::Add(lines[6], lines[7]);
+  partial5a = hn::Add(partial5a, hn::ShiftLeftBytes<4>(d, tmp));
+  partial5b = hn::Add(partial5b, hn::ShiftRightBytes<12>(d, tmp));
+  partial7a = hn::Add(partial7a, hn::ShiftLeftBytes<10>(d, tmp));
+  partial7b = hn::Add(partial7b, hn::ShiftRightBytes<6>(d, tmp));
+  partial6 = hn::Add(partial6, tmp);
+
+  alignas(16) static constexpr int32_t kConst1[4] = { 840, 420, 280, 210 };
+  alignas(16) static constexpr int32_t kConst2[4] = { 168, 140, 120, 105 };
+  alignas(16) static constexpr int32_t kConst3[4] = { 0, 0, 420, 210 };
+  alignas(16) static constexpr int32_t kConst4[4] = { 140, 105, 105, 105 };
+  const auto const1 = hn::LoadDup128(d32, kConst1);
+  const auto const2 = hn::LoadDup128(d32, kConst2);
+  const auto const3 = hn::LoadDup128(d32, kConst3);
+  const auto const4 = hn::LoadDup128(d32, kConst4);
+
+  /* Compute costs in terms of partial sums. */
+  const auto cost4 = FoldMulAndSum(d, partial4a, partial4b, const1, const2);
+  const auto cost7 = FoldMulAndSum(d, partial7a, partial7b, const3, const4);
+  const auto cost5 = FoldMulAndSum(d, partial5a, partial5b, const3, const4);
+  const auto cost6 = hn::Mul(hn::WidenMulPairwiseAdd(d32, partial6, partial6),
+                             hn::Set(d32, 105));
+  return Hsum4(d32, cost4, cost5, cost6, cost7);
+}
+
+/* Transpose and reverse the order of the lines -- equivalent to a 90-degree
+   counter-clockwise rotation of the pixels. */
+template <class D>
+HWY_ATTR HWY_INLINE void ReverseTranspose8x8(D d, hn::VFromD<D> lines[8]) {
+  const hn::Repartition<int32_t, D> d32;
+  const hn::Repartition<int64_t, D> d64;
+  const auto tr0_0 =
+      hn::BitCast(d32, hn::InterleaveLower(d, lines[0], lines[1]));
+  const auto tr0_1 =
+      hn::BitCast(d32, hn::InterleaveLower(d, lines[2], lines[3]));
+  const auto tr0_2 =
+      hn::BitCast(d32, hn::InterleaveUpper(d, lines[0], lines[1]));
+  const auto tr0_3 =
+      hn::BitCast(d32, hn::InterleaveUpper(d, lines[2], lines[3]));
+  const auto tr0_4 =
+      hn::BitCast(d32, hn::InterleaveLower(d, lines[4], lines[5]));
+  const auto tr0_5 =
+      hn::BitCast(d32, hn::InterleaveLower(d, lines[6], lines[7]));
+  const auto tr0_6 =
+      hn::BitCast(d32, hn::InterleaveUpper(d, lines[4], lines[5]));
+  const auto tr0_7 =
+      hn::BitCast(d32, hn::InterleaveUpper(d, lines[6], lines[7]));
+
+  const auto tr1_0 = hn::BitCast(d64, hn::InterleaveLower(d32, tr0_0, tr0_1));
+  const auto tr1_1 = hn::BitCast(d64, hn::InterleaveLower(d32, tr0_4, tr0_5));
+  const auto tr1_2 = hn::BitCast(d64, hn::InterleaveUpper(d32, tr0_0, tr0_1));
+  const auto tr1_3 = hn::BitCast(d64, hn::InterleaveUpper(d32, tr0_4, tr0_5));
+  const auto tr1_4 = hn::BitCast(d64, hn::InterleaveLower(d32, tr0_2, tr0_3));
+  const auto tr1_5 = hn::BitCast(d64, hn::InterleaveLower(d32, tr0_6, tr0_7));
+  const auto tr1_6 = hn::BitCast(d64, hn::InterleaveUpper(d32, tr0_2, tr0_3));
+  const auto tr1_7 = hn::BitCast(d64, hn::InterleaveUpper(d32, tr0_6, tr0_7));
+
+  lines[7] = hn::BitCast(d, hn::InterleaveLower(d64, tr1_0, tr1_1));
+  lines[6] = hn::BitCast(d, hn::InterleaveUpper(d64, tr1_0, tr1_1));
+  lines[5] = hn::BitCast(d, hn::InterleaveLower(d64, tr1_2, tr1_3));
+  lines[4] = hn::BitCast(d, hn::InterleaveUpper(d64, tr1_2, tr1_3));
+  lines[3] = hn::BitCast(d, hn::InterleaveLower(d64, tr1_4, tr1_5));
+  lines[2] = hn::BitCast(d, hn::InterleaveUpper(d64, tr1_4, tr1_5));
+  lines[1] = hn::BitCast(d, hn::InterleaveLower(d64, tr1_6, tr1_7));
+  lines[0] = hn::BitCast(d, hn::InterleaveUpper(d64, tr1_6, tr1_7));
+}
+
+// Finds the direction of the 8x8 blocks at img[0], img[1], ..., one per
+// 128-bit block of D.
+template <class D>
+HWY_ATTR HWY_INLINE void FindDirBlocks(D d, const uint16_t *const img[],
+                                       int stride, int32_t *const var[],
+                                       int coeff_shift, int *const dir[]) {
+  constexpr size_t kBlocks = d.MaxBlocks();
+  hn::VFromD<D> lines[8];
+  for (int i = 0; i < 8; i++) {
+    lines[i] = hn::Sub(
+        hn::ShiftRightSame(LoadBlocks(d, img, (ptrdiff_t)i * stride),
+                           coeff_shift),
+        hn::Set(d, 128));
+  }
+
+  const hn::Repartition<int32_t, D> d32;
+  alignas(64) int32_t cost47[4 * kBlocks];
+  alignas(64) int32_t cost03[4 * kBlocks];
+  /* Compute "mostly vertical" directions. */
+  hn::Store(ComputeDirections(d, lines), d32, cost47);
+
+  ReverseTranspose8x8(d, lines);
+
+  /* Compute "mostly horizontal" directions. */
+  hn::Store(ComputeDirections(d, lines), d32, cost03);
+
+  for (size_t b = 0; b < kBlocks; ++b) {
+    int32_t cost[8];
+    memcpy(cost, cost03 + 4 * b, 4 * sizeof(*cost));
+    memcpy(cost + 4, cost47 + 4 * b, 4 * sizeof(*cost));
+    int32_t best_cost = 0;
+    int best_dir = 0;
+    for (int i = 0; i < 8; i++) {
+      if (cost[i] > best_cost) {
+        best_cost = cost[i];
+        best_dir = i;
+      }
+    }
+    /* Difference between the optimal variance and the variance along the
+       orthogonal direction. Again, the sum(x^2) terms cancel out. We'd
+       normally divide by 840, but dividing by 1024 is close enough for what
+       we're going to do with this. */
+    *var[b] = (best_cost - cost[(best_dir + 4) & 7]) >> 10;
+    *dir[b] = best_dir;
+  }
+}
+
+HWY_ATTR HWY_INLINE void FindDirQuad(const uint16_t *const img[4], int stride,
+                                     int32_t *const var[4], int coeff_shift,
+                                     int *const dir[4]) {
+  constexpr hn::CappedTag<int16_t, 32> int16x32_tag;
+  static_assert(int16x32_tag.MaxBlocks() == 4, "one 8x8 block per block");
+  FindDirBlocks(int16x32_tag, img, stride, var, coeff_shift, dir);
+}
+
+// sign(a-b) * min(abs(a-b), max(0, threshold - (abs(a-b) >> adjdamp)))
+HWY_ATTR HWY_INLINE hn::VFromD<decltype(int16xN_tag)> Constrain(
+    hn::VFromD<decltype(int16xN_tag)> a, hn::VFromD<decltype(int16xN_tag)> b,
+    int threshold, int adjdamp) {
+  constexpr hn::RebindToUnsigned<decltype(int16xN_tag)> uint16xN_tag;
+  const auto diff = hn::Sub(a, b);
+  const auto sign = hn::ShiftRight<15>(diff);
+  const auto abs_diff = hn::Abs(diff);
+  const auto s = hn::BitCast(
+      int16xN_tag,
+      hn::SaturatedSub(hn::Set(uint16xN_tag, (uint16_t)threshold),
+                       hn::ShiftRightSame(hn::BitCast(uint16xN_tag, abs_diff),
+                                          adjdamp)));
+  return hn::Xor(hn::Add(sign, hn::Min(abs_diff, s)), sign);
+}
+
+// Filters an 8x4 or 8x8 block, as many rows at a time as a vector has blocks.
+template <bool kLowbd, bool kPrimary, bool kSecondary>
+HWY_ATTR HWY_INLINE void FilterBlock8(void *dest, int dstride,
+                                      const uint16_t *in, int pri_strength,
+                                      int sec_strength, int dir,
+                                      int pri_damping, int sec_damping,
+                                      int coeff_shift, int block_height) {
+  using V = hn::VFromD<decltype(int16xN_tag)>;
+  constexpr int kRows = (int)int16xN_tag.MaxBlocks();
+  constexpr bool kClip = kPrimary && kSecondary;
+  const int po1 = cdef_directions[dir][0];
+  const int po2 = cdef_directions[dir][1];
+  const int s1o1 = cdef_directions[dir + 2][0];
+  const int s1o2 = cdef_directions[dir + 2][1];
+  const int s2o1 = cdef_directions[dir - 2][0];
+  const int s2o2 = cdef_directions[dir - 2][1];
+  const int *pri_taps = cdef_pri_taps[(pri_strength >> coeff_shift) & 1];
+  const int *sec_taps = cdef_sec_taps;
+  const V large_value_mask = hn::Set(int16xN_tag, (int16_t)~CDEF_VERY_LARGE);
+
+  if (kPrimary && pri_strength)
+    pri_damping = AOMMAX(0, pri_damping - get_msb(pri_strength));
+  if (kSecondary && sec_strength)
+    sec_damping = AOMMAX(0, sec_damping - get_msb(sec_strength));
+
+  for (int i = 0; i < block_height; i += kRows) {
+    const uint16_t *const src = in + i * CDEF_BSTRIDE;
+    const V row = LoadRows(int16xN_tag, src, CDEF_BSTRIDE);
+    V sum = hn::Zero(int16xN_tag);
+    V max = row;
+    V min = row;
+    // Taps of the same weight are constrained and summed in pairs. For the
+    // maximum, CDEF_VERY_LARGE is masked to 0; 8-bit pixels only have a low
+    // byte, so a byte maximum of all taps masked once gives the same result.
+    V tap_max = hn::Zero(int16xN_tag);
+    auto add_taps = [&](const int *offsets, int count, int strength,
+                        int damping, int weight) HWY_ATTR {
+      V s = hn::Zero(int16xN_tag);
+      for (int k = 0; k < count; ++k) {
+        const V p0 = LoadRows(int16xN_tag, src + offsets[k], CDEF_BSTRIDE);
+        const V p1 = LoadRows(int16xN_tag, src - offsets[k], CDEF_BSTRIDE);
+        s = hn::Add(s, hn::Add(Constrain(p0, row, strength, damping),
+                               Constrain(p1, row, strength, damping)));
+        if (kClip) {
+          min = hn::Min(min, hn::Min(p0, p1));
+          if (kLowbd) {
+            const hn::Repartition<uint8_t, decltype(int16xN_tag)> d8;
+            tap_max = hn::BitCast(
+                int16xN_tag,
+                hn::Max(hn::BitCast(d8, tap_max),
+                        hn::Max(hn::BitCast(d8, p0), hn::BitCast(d8, p1))));
+          } else {
+            tap_max = hn::Max(tap_max,
+                              hn::Max(hn::And(p0, large_value_mask),
+                                      hn::And(p1, large_value_mask)));
+          }
+        }
+      }
+      sum = hn::Add(sum, hn::Mul(hn::Set(int16xN_tag, (int16_t)weight), s));
+    };
+
+    if (kPrimary) {
+      add_taps(&po1, 1, pri_strength, pri_damping, pri_taps[0]);
+      add_taps(&po2, 1, pri_strength, pri_damping, pri_taps[1]);
+    }
+    if (kSecondary) {
+      const int near_taps[2] = { s1o1, s2o1 };
+      const int far_taps[2] = { s1o2, s2o2 };
+      add_taps(near_taps, 2, sec_strength, sec_damping, sec_taps[0]);
+      add_taps(far_taps, 2, sec_strength, sec_damping, sec_taps[1]);
+    }
+
+    // res = row + ((sum - (sum < 0) + 8) >> 4)
+    sum = hn::Add(sum, hn::VecFromMask(int16xN_tag,
+                                       hn::Lt(sum, hn::Zero(int16xN_tag))));
+    V res = hn::Add(
+        row, hn::ShiftRight<4>(hn::Add(sum, hn::Set(int16xN_tag, 8))));
+    if (kClip) {
+      if (kLowbd) tap_max = hn::And(tap_max, large_value_mask);
+      max = hn::Max(max, tap_max);
+      res = hn::Min(hn::Max(res, min), max);
+    }
+
+    if (kLowbd) {
+      const hn::Rebind<uint8_t, decltype(int16xN_tag)> d8;
+      alignas(64) uint8_t out[8 * kRows];
+      hn::Store(hn::DemoteTo(d8, res), d8, out);
+      uint8_t *const dst8 = (uint8_t *)dest + i * dstride;
+      for (int r = 0; r < kRows; ++r) {
+        memcpy(dst8 + r * dstride, out + 8 * r, 8);
+      }
+    } else {
+      const hn::RebindToUnsigned<decltype(int16xN_tag)> d16;
+      alignas(64) uint16_t out[8 * kRows];
+      hn::Store(hn::BitCast(d16, res), d16, out);
+      uint16_t *const dst16 = (uint16_t *)dest + i * dstride;
+      for (int r = 0; r < kRows; ++r) {
+        memcpy(dst16 + r * dstride, out + 8 * r, 8 * sizeof(*dst16));
+      }
+    }
+  }
+}
+
+}  // namespace HWY_NAMESPACE
+}  // namespace
+
+HWY_AFTER_NAMESPACE();
+
+// 4-pixel wide blocks have fewer pixels than a vector and are left to the
+// fallback.
+#define MAKE_CDEF_FILTER(bits, index, lowbd, primary, secondary, suffix,      \
+                         fallback)                                            \
+  extern "C" void cdef_filter_##bits##_##index##_##suffix(                    \
+      void *dest, int dstride, const uint16_t *in, int pri_strength,          \
+      int sec_strength, int dir, int pri_damping, int sec_damping,            \
+      int coeff_shift, int block_width, int block_height);                    \
+  HWY_ATTR void cdef_filter_##bits##_##index##_##suffix(                      \
+      void *dest, int dstride, const uint16_t *in, int pri_strength,          \
+      int sec_strength, int dir, int pri_damping, int sec_damping,            \
+      int coeff_shift, int block_width, int block_height) {                   \
+    if (block_width != 8) {                                                   \
+      cdef_filter_##bits##_##index##_##fallback(                              \
+          dest, dstride, in, pri_strength, sec_strength, dir, pri_damping,    \
+          sec_damping, coeff_shift, block_width, block_height);               \
+      return;                                                                 \
+    }                                                                         \
+    HWY_NAMESPACE::FilterBlock8<lowbd, primary, secondary>(                   \
+        dest, dstride, in, pri_strength, sec_strength, dir, pri_damping,      \
+        sec_damping, coeff_shift, block_height);                              \
+  }
+
+#define MAKE_CDEF(suffix, fallback)                                           \
+  MAKE_CDEF_FILTER(8, 0, true, true, true, suffix, fallback)                  \
+  MAKE_CDEF_FILTER(8, 1, true, true, false, suffix, fallback)                 \
+  MAKE_CDEF_FILTER(8, 2, true, false, true, suffix, fallback)                 \
+  MAKE_CDEF_FILTER(8, 3, true, false, false, suffix, fallback)                \
+  MAKE_CDEF_FILTER(16, 0, false, true, true, suffix, fallback)                \
+  MAKE_CDEF_FILTER(16, 1, false, true, false, suffix, fallback)               \
+  MAKE_CDEF_FILTER(16, 2, false, false, true, suffix, fallback)               \
+  MAKE_CDEF_FILTER(16, 3, false, false, false, suffix, fallback)              \
+                                                                              \
+  extern "C" void cdef_find_dir_quad_##suffix(                                \
+      const uint16_t *const img[4], int stride, int32_t *const var[4],        \
+      int coeff_shift, int *const dir[4]);                                    \
+  HWY_ATTR void cdef_find_dir_quad_##suffix(                                  \
+      const uint16_t *const img[4], int stride, int32_t *const var[4],        \
+      int coeff_shift, int *const dir[4]) {                                   \
+    HWY_NAMESPACE::FindDirQuad(img, stride, var, coeff_shift, dir);           \
+  }
+
+#endif  // AOM_AV1_COMMON_CDEF_BLOCK_HWY_H_
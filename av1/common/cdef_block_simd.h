@@ -198,6 +198,15 @@ int SIMD_FUNC(cdef_find_dir)(const uint16_t *img, int stride, int32_t *var,
   return best_dir;
 }
 
+void SIMD_FUNC(cdef_find_dir_quad)(const uint16_t *const img[4], int stride,
+                                   int32_t *const var[4], int coeff_shift,
+                                   int *const dir[4]) {
+  SIMD_FUNC(cdef_find_dir_dual)(img[0], img[1], stride, var[0], var[1],
+                                coeff_shift, dir[0], dir[1]);
+  SIMD_FUNC(cdef_find_dir_dual)(img[2], img[3], stride, var[2], var[3],
+                                coeff_shift, dir[2], dir[3]);
+}
+
 // Work around compiler out of memory issues with Win32 builds. This issue has
 // been observed with Visual Studio 2017, 2019, and 2022 (version 17.10.3).
 #if defined(_MSC_VER) && defined(_M_IX86)
@@ -0,0 +1,1152 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#ifndef AOM_AV1_COMMON_CONVOLVE_HWY_H_
+#define AOM_AV1_COMMON_CONVOLVE_HWY_H_
+
+#include <assert.h>
+#include <stdint.h>
+
+#include "config/aom_config.h"
+#include "config/av1_rtcd.h"
+#include "third_party/highway/hwy/highway.h"
+#include "aom_ports/mem.h"
+#include "av1/common/convolve.h"
+#include "av1/common/filter.h"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace {
+namespace HWY_NAMESPACE {
+
+namespace hn = hwy::HWY_NAMESPACE;
+
+// Pixels are filtered as 16-bit lanes, so one vector covers 32 pixels and a
+// 64-pixel row takes two, except in the 8-bit single reference filters which
+// work on bytes. Narrower blocks do not fill a vector and are left to the AVX2
+// code, as are the 12-tap filters.
+constexpr hn::CappedTag<int16_t, 32> int16xN_tag;
+constexpr hn::Repartition<int32_t, decltype(int16xN_tag)> int32xN_tag;
+constexpr hn::RebindToUnsigned<decltype(int16xN_tag)> uint16xN_tag;
+constexpr hn::Rebind<uint8_t, decltype(int16xN_tag)> uint8xN_tag;
+
+using VecI16 = hn::VFromD<decltype(int16xN_tag)>;
+using VecI32 = hn::VFromD<decltype(int32xN_tag)>;
+
+constexpr int kMinConvolveWidth = 32;
+
+HWY_ATTR HWY_INLINE bool UseWideConvolve(
+    int w, const InterpFilterParams *filter_params) {
+  return w >= kMinConvolveWidth && filter_params->taps != 12;
+}
+
+HWY_ATTR HWY_INLINE VecI16 LoadPixels(const uint8_t *p) {
+  return hn::PromoteTo(int16xN_tag, hn::LoadU(uint8xN_tag, p));
+}
+
+HWY_ATTR HWY_INLINE VecI16 LoadPixels(const uint16_t *p) {
+  return hn::BitCast(int16xN_tag, hn::LoadU(uint16xN_tag, p));
+}
+
+HWY_ATTR HWY_INLINE VecI16 LoadPixels(const int16_t *p) {
+  return hn::LoadU(int16xN_tag, p);
+}
+
+// Clamps to [0, max] and stores. Saturating to 16 bits first does not change
+// the result since max fits in 15 bits.
+HWY_ATTR HWY_INLINE void StorePixels(VecI32 lo, VecI32 hi, int max,
+                                     uint8_t *p) {
+  (void)max;
+  assert(max == 255);
+  const VecI16 v = hn::ReorderDemote2To(int16xN_tag, lo, hi);
+  hn::StoreU(hn::DemoteTo(uint8xN_tag, v), uint8xN_tag, p);
+}
+
+HWY_ATTR HWY_INLINE void StorePixels(VecI32 lo, VecI32 hi, int max,
+                                     uint16_t *p) {
+  VecI16 v = hn::ReorderDemote2To(int16xN_tag, lo, hi);
+  v = hn::Min(hn::Max(v, hn::Zero(int16xN_tag)),
+              hn::Set(int16xN_tag, (int16_t)max));
+  hn::StoreU(hn::BitCast(uint16xN_tag, v), uint16xN_tag, p);
+}
+
+// Returns (v + add) >> shift.
+HWY_ATTR HWY_INLINE VecI32 AddShift(VecI32 v, int32_t add, int shift) {
+  return hn::ShiftRightSame(hn::Add(v, hn::Set(int32xN_tag, add)), shift);
+}
+
+HWY_ATTR HWY_INLINE VecI16 AddShift(VecI16 v, int32_t add, int shift) {
+  return hn::ShiftRightSame(hn::Add(v, hn::Set(int16xN_tag, (int16_t)add)),
+                            shift);
+}
+
+// The filters are applied with pairwise multiply-adds: two taps of 16-bit
+// data are interleaved and multiplied by the matching pair of coefficients.
+// The interleave works within 128-bit blocks, so 'lo' holds the sums of pixels
+// 0-3 of every block and 'hi' those of pixels 4-7. ReorderDemote2To() packs
+// within blocks as well, which puts the pixels back in order.
+template <int kPairs>
+HWY_ATTR HWY_INLINE void PrepareCoeffs(const int16_t *filter,
+                                       VecI16 coeffs[kPairs]) {
+  for (int k = 0; k < kPairs; ++k) {
+    const uint32_t pair = (uint32_t)(uint16_t)filter[2 * k] |
+                          ((uint32_t)(uint16_t)filter[2 * k + 1] << 16);
+    coeffs[k] =
+        hn::BitCast(int16xN_tag, hn::Set(int32xN_tag, (int32_t)pair));
+  }
+}
+
+HWY_ATTR HWY_INLINE void MultiplyAccumulate(VecI16 s0, VecI16 s1,
+                                            VecI16 coeffs, VecI32 &lo,
+                                            VecI32 &hi) {
+  lo = hn::Add(lo, hn::WidenMulPairwiseAdd(
+                       int32xN_tag, hn::InterleaveLower(int16xN_tag, s0, s1),
+                       coeffs));
+  hi = hn::Add(hi, hn::WidenMulPairwiseAdd(
+                       int32xN_tag, hn::InterleaveUpper(int16xN_tag, s0, s1),
+                       coeffs));
+}
+
+// Filters rows [0, h) of columns [x_start, x_end) and hands the 32-bit sums
+// of each vector of pixels to 'output'. src points to the first tap.
+template <int kPairs, typename T, class Output>
+HWY_ATTR HWY_INLINE void FilterHorizontal(const T *src, int src_stride,
+                                          int x_start, int x_end, int h,
+                                          const int16_t *filter,
+                                          const Output &output) {
+  VecI16 coeffs[kPairs];
+  PrepareCoeffs<kPairs>(filter, coeffs);
+  const int lanes = (int)hn::Lanes(int16xN_tag);
+  for (int y = 0; y < h; ++y) {
+    for (int x = x_start; x < x_end; x += lanes) {
+      VecI32 lo = hn::Zero(int32xN_tag);
+      VecI32 hi = hn::Zero(int32xN_tag);
+      for (int k = 0; k < kPairs; ++k) {
+        MultiplyAccumulate(LoadPixels(src + x + 2 * k),
+                           LoadPixels(src + x + 2 * k + 1), coeffs[k], lo, hi);
+      }
+      output(x, y, lo, hi);
+    }
+    src += src_stride;
+  }
+}
+
+// 8-bit rows are filtered on bytes instead: one table lookup across the whole
+// vector gathers the pixel pairs of a tap pair, in pixel order, and
+// SatWidenMulPairwiseAdd() multiplies them. As in the AVX2 code the
+// coefficients, which are all even, are halved so that the sums fit in 16
+// bits. 'output' takes these halved sums, in pixel order, as a VecI16.
+template <int kPairs, class Output>
+HWY_ATTR HWY_INLINE void FilterHorizontal(const uint8_t *src, int src_stride,
+                                          int x_start, int x_end, int h,
+                                          const int16_t *filter,
+                                          const Output &output) {
+  constexpr hn::Repartition<uint8_t, decltype(int16xN_tag)> d8;
+  constexpr hn::Repartition<int8_t, decltype(int16xN_tag)> di8;
+  using Indices = decltype(hn::IndicesFromVec(d8, hn::Zero(d8)));
+  const int lanes = (int)hn::Lanes(int16xN_tag);
+  // Pixel pairs (j, j + 1) for j = 0, 1, 2, ...
+  const auto iota = hn::Iota(d8, 0);
+  const auto pairs =
+      hn::Add(hn::ShiftRight<1>(iota), hn::And(iota, hn::Set(d8, 1)));
+  VecI16 coeffs[kPairs];
+  Indices indices[kPairs];
+  for (int k = 0; k < kPairs; ++k) {
+    assert(!(filter[2 * k] & 1) && !(filter[2 * k + 1] & 1));
+    const uint16_t pair = (uint16_t)((uint8_t)(filter[2 * k] >> 1) |
+                                     ((uint8_t)(filter[2 * k + 1] >> 1) << 8));
+    coeffs[k] = hn::Set(int16xN_tag, (int16_t)pair);
+    indices[k] = hn::IndicesFromVec(
+        d8, hn::Add(pairs, hn::Set(d8, (uint8_t)(2 * k))));
+  }
+  // Only load the bytes the filter reads.
+  const auto load_mask = hn::FirstN(d8, lanes + 2 * kPairs - 1);
+  for (int y = 0; y < h; ++y) {
+    for (int x = x_start; x < x_end; x += lanes) {
+      const auto s = hn::MaskedLoad(load_mask, d8, src + x);
+      VecI16 sum = hn::Zero(int16xN_tag);
+      for (int k = 0; k < kPairs; ++k) {
+        sum = hn::Add(sum, hn::SatWidenMulPairwiseAdd(
+                               int16xN_tag, hn::TableLookupLanes(s, indices[k]),
+                               hn::BitCast(di8, coeffs[k])));
+      }
+      output(x, y, sum);
+    }
+    src += src_stride;
+  }
+}
+
+// Widens halved sums from the 8-bit filters to the 32-bit sums, in the order
+// MultiplyAccumulate() produces them.
+HWY_ATTR HWY_INLINE void WidenHalfSums(VecI16 sum, VecI32 &lo, VecI32 &hi) {
+  const VecI16 zero = hn::Zero(int16xN_tag);
+  lo = hn::ShiftRight<15>(
+      hn::BitCast(int32xN_tag, hn::InterleaveLower(int16xN_tag, zero, sum)));
+  hi = hn::ShiftRight<15>(
+      hn::BitCast(int32xN_tag, hn::InterleaveUpper(int16xN_tag, zero, sum)));
+}
+
+// Vertical counterpart of FilterHorizontal(). Two output rows are produced per
+// iteration so that the interleaved row pairs can be reused: 'even' holds the
+// pairs starting on the first tap row of the upper output row and 'odd' those
+// of the lower one.
+template <int kPairs, typename T, class Output>
+HWY_ATTR HWY_INLINE void FilterVertical(const T *src, int src_stride,
+                                        int x_start, int x_end, int h,
+                                        const int16_t *filter,
+                                        const Output &output) {
+  assert(!(h & 1));
+  VecI16 coeffs[kPairs];
+  PrepareCoeffs<kPairs>(filter, coeffs);
+  const int lanes = (int)hn::Lanes(int16xN_tag);
+  for (int x = x_start; x < x_end; x += lanes) {
+    const T *s = src + x;
+    VecI16 even_lo[kPairs], even_hi[kPairs], odd_lo[kPairs], odd_hi[kPairs];
+    VecI16 rows[2 * kPairs - 1];
+    for (int r = 0; r < 2 * kPairs - 1; ++r) {
+      rows[r] = LoadPixels(s + r * src_stride);
+    }
+    for (int k = 0; k < kPairs - 1; ++k) {
+      even_lo[k] =
+          hn::InterleaveLower(int16xN_tag, rows[2 * k], rows[2 * k + 1]);
+      even_hi[k] =
+          hn::InterleaveUpper(int16xN_tag, rows[2 * k], rows[2 * k + 1]);
+      odd_lo[k] =
+          hn::InterleaveLower(int16xN_tag, rows[2 * k + 1], rows[2 * k + 2]);
+      odd_hi[k] =
+          hn::InterleaveUpper(int16xN_tag, rows[2 * k + 1], rows[2 * k + 2]);
+    }
+    VecI16 last = rows[2 * kPairs - 2];
+    s += (2 * kPairs - 1) * src_stride;
+
+    for (int y = 0; y < h; y += 2) {
+      const VecI16 r0 = LoadPixels(s);
+      const VecI16 r1 = LoadPixels(s + src_stride);
+      s += 2 * src_stride;
+      even_lo[kPairs - 1] = hn::InterleaveLower(int16xN_tag, last, r0);
+      even_hi[kPairs - 1] = hn::InterleaveUpper(int16xN_tag, last, r0);
+      odd_lo[kPairs - 1] = hn::InterleaveLower(int16xN_tag, r0, r1);
+      odd_hi[kPairs - 1] = hn::InterleaveUpper(int16xN_tag, r0, r1);
+      last = r1;
+
+      VecI32 lo0 = hn::Zero(int32xN_tag);
+      VecI32 hi0 = hn::Zero(int32xN_tag);
+      VecI32 lo1 = hn::Zero(int32xN_tag);
+      VecI32 hi1 = hn::Zero(int32xN_tag);
+      for (int k = 0; k < kPairs; ++k) {
+        lo0 = hn::Add(lo0, hn::WidenMulPairwiseAdd(int32xN_tag, even_lo[k],
+                                                   coeffs[k]));
+        hi0 = hn::Add(hi0, hn::WidenMulPairwiseAdd(int32xN_tag, even_hi[k],
+                                                   coeffs[k]));
+        lo1 = hn::Add(lo1, hn::WidenMulPairwiseAdd(int32xN_tag, odd_lo[k],
+                                                   coeffs[k]));
+        hi1 = hn::Add(hi1, hn::WidenMulPairwiseAdd(int32xN_tag, odd_hi[k],
+                                                   coeffs[k]));
+      }
+      output(x, y, lo0, hi0);
+      output(x, y + 1, lo1, hi1);
+
+      for (int k = 0; k < kPairs - 1; ++k) {
+        even_lo[k] = even_lo[k + 1];
+        even_hi[k] = even_hi[k + 1];
+        odd_lo[k] = odd_lo[k + 1];
+        odd_hi[k] = odd_hi[k + 1];
+      }
+    }
+  }
+}
+
+// Filters with the kPairs middle pairs of taps of an 8-tap kernel. src points
+// to the first tap of the kernel.
+template <int kPairs, bool kVertical, typename T, class Output>
+HWY_ATTR HWY_INLINE void FilterPairs(const T *src, int src_stride, int x_start,
+                                     int x_end, int h, const int16_t *filter,
+                                     const Output &output) {
+  const int skip = 4 - kPairs;
+  if (kVertical) {
+    FilterVertical<kPairs>(src + skip * src_stride, src_stride, x_start, x_end,
+                           h, filter + skip, output);
+  } else {
+    FilterHorizontal<kPairs>(src + skip, src_stride, x_start, x_end, h,
+                             filter + skip, output);
+  }
+}
+
+// Filters with the kernel for 'subpel_qn', skipping the outer taps when they
+// are zero. All the kernels handled here have 8 taps.
+template <bool kVertical, typename T, class Output>
+HWY_ATTR HWY_INLINE void Filter(const T *src, int src_stride, int x_start,
+                                int x_end, int h,
+                                const InterpFilterParams *filter_params,
+                                int subpel_qn, const Output &output) {
+  assert(filter_params->taps == 8);
+  const int16_t *filter = av1_get_interp_filter_subpel_kernel(
+      filter_params, subpel_qn & SUBPEL_MASK);
+  src -= (filter_params->taps / 2 - 1) * (kVertical ? src_stride : 1);
+  switch (get_filter_tap(filter_params, subpel_qn)) {
+    case 8:
+      FilterPairs<4, kVertical>(src, src_stride, x_start, x_end, h, filter,
+                                output);
+      break;
+    case 6:
+      FilterPairs<3, kVertical>(src, src_stride, x_start, x_end, h, filter,
+                                output);
+      break;
+    default:
+      FilterPairs<2, kVertical>(src, src_stride, x_start, x_end, h, filter,
+                                output);
+      break;
+  }
+}
+
+// Writes the horizontal pass of a 2D filter to the 16-bit intermediate
+// buffer.
+struct IntermediateOutput {
+  int16_t *im;
+  int im_stride;
+  int32_t add;
+  int shift;
+
+  HWY_ATTR HWY_INLINE void operator()(int x, int y, VecI32 lo,
+                                      VecI32 hi) const {
+    lo = AddShift(lo, add, shift);
+    hi = AddShift(hi, add, shift);
+    hn::StoreU(hn::ReorderDemote2To(int16xN_tag, lo, hi), int16xN_tag,
+               im + y * im_stride + x);
+  }
+
+  // Halving 'add' and 'shift' for the halved sums of the 8-bit filters keeps
+  // the same result within 16 bits.
+  HWY_ATTR HWY_INLINE void operator()(int x, int y, VecI16 half_sum) const {
+    assert(!(add & 1) && shift >= 1);
+    hn::StoreU(AddShift(half_sum, add >> 1, shift - 1), int16xN_tag,
+               im + y * im_stride + x);
+  }
+};
+
+// Single reference prediction: dst = clip(((sum + add0) >> shift0 + add1) >>
+// shift1).
+template <typename T>
+struct SingleRefOutput {
+  T *dst;
+  int dst_stride;
+  int32_t add0;
+  int shift0;
+  int32_t add1;
+  int shift1;
+  int max;
+
+  HWY_ATTR HWY_INLINE void operator()(int x, int y, VecI32 lo,
+                                      VecI32 hi) const {
+    lo = AddShift(AddShift(lo, add0, shift0), add1, shift1);
+    hi = AddShift(AddShift(hi, add0, shift0), add1, shift1);
+    StorePixels(lo, hi, max, dst + y * dst_stride + x);
+  }
+};
+
+// Compound prediction. The value stored in the CONV_BUF_TYPE buffer is
+// res = (((sum << pre_shift) + add0) >> shift0 << post_shift) + add1; the
+// second prediction averages it with the first one and writes pixels.
+template <typename T>
+struct CompoundOutput {
+  T *dst;
+  int dst_stride;
+  CONV_BUF_TYPE *dst16;
+  int dst16_stride;
+  int pre_shift;
+  int32_t add0;
+  int shift0;
+  int post_shift;
+  int32_t add1;
+  int do_average;
+  int use_dist_wtd_comp_avg;
+  int fwd_offset;
+  int bck_offset;
+  // ((1 << round_bits) >> 1) - round_offset.
+  int32_t round_add;
+  int round_bits;
+  int max;
+
+  HWY_ATTR HWY_INLINE VecI32 Average(VecI32 prev, VecI32 res) const {
+    VecI32 tmp;
+    if (use_dist_wtd_comp_avg) {
+      tmp = hn::Add(hn::Mul(prev, hn::Set(int32xN_tag, fwd_offset)),
+                    hn::Mul(res, hn::Set(int32xN_tag, bck_offset)));
+      tmp = hn::ShiftRight<DIST_PRECISION_BITS>(tmp);
+    } else {
+      tmp = hn::ShiftRight<1>(hn::Add(prev, res));
+    }
+    return AddShift(tmp, round_add, round_bits);
+  }
+
+  // 8-bit compound predictions fit in 15 bits, so they are averaged in 16-bit
+  // lanes, with a pairwise multiply-add for the distance weights.
+  HWY_ATTR HWY_INLINE void AverageLowbd(int x, int y, VecI16 res) const {
+    const VecI16 prev = hn::BitCast(
+        int16xN_tag, hn::LoadU(uint16xN_tag, dst16 + y * dst16_stride + x));
+    T *const p = dst + y * dst_stride + x;
+    if (use_dist_wtd_comp_avg) {
+      const VecI16 weights = hn::BitCast(
+          int16xN_tag, hn::Set(int32xN_tag, fwd_offset | (bck_offset << 16)));
+      VecI32 lo = hn::WidenMulPairwiseAdd(
+          int32xN_tag, hn::InterleaveLower(int16xN_tag, prev, res), weights);
+      VecI32 hi = hn::WidenMulPairwiseAdd(
+          int32xN_tag, hn::InterleaveUpper(int16xN_tag, prev, res), weights);
+      lo = AddShift(hn::ShiftRight<DIST_PRECISION_BITS>(lo), round_add,
+                    round_bits);
+      hi = AddShift(hn::ShiftRight<DIST_PRECISION_BITS>(hi), round_add,
+                    round_bits);
+      StorePixels(lo, hi, max, p);
+    } else {
+      const VecI16 avg = hn::ShiftRight<1>(hn::Add(prev, res));
+      const VecI16 v = AddShift(avg, round_add, round_bits);
+      hn::StoreU(hn::DemoteTo(uint8xN_tag, v), uint8xN_tag, p);
+    }
+  }
+
+  HWY_ATTR HWY_INLINE void operator()(int x, int y, VecI32 lo,
+                                      VecI32 hi) const {
+    lo = AddShift(hn::ShiftLeftSame(lo, pre_shift), add0, shift0);
+    hi = AddShift(hn::ShiftLeftSame(hi, pre_shift), add0, shift0);
+    lo = hn::Add(hn::ShiftLeftSame(lo, post_shift), hn::Set(int32xN_tag, add1));
+    hi = hn::Add(hn::ShiftLeftSame(hi, post_shift), hn::Set(int32xN_tag, add1));
+    CONV_BUF_TYPE *const p = dst16 + y * dst16_stride + x;
+    if constexpr (sizeof(T) == 1) {
+      if (do_average) {
+        AverageLowbd(x, y, hn::ReorderDemote2To(int16xN_tag, lo, hi));
+        return;
+      }
+    }
+    if (do_average) {
+      // Widen the first prediction in the same block-interleaved order.
+      const auto prev = hn::LoadU(uint16xN_tag, p);
+      const auto zero = hn::Zero(uint16xN_tag);
+      const VecI32 prev_lo = hn::BitCast(
+          int32xN_tag, hn::InterleaveLower(uint16xN_tag, prev, zero));
+      const VecI32 prev_hi = hn::BitCast(
+          int32xN_tag, hn::InterleaveUpper(uint16xN_tag, prev, zero));
+      StorePixels(Average(prev_lo, lo), Average(prev_hi, hi), max,
+                  dst + y * dst_stride + x);
+    } else {
+      hn::StoreU(hn::ReorderDemote2To(uint16xN_tag, lo, hi), uint16xN_tag, p);
+    }
+  }
+
+  HWY_ATTR HWY_INLINE void operator()(int x, int y, VecI16 half_sum) const {
+    VecI32 lo, hi;
+    WidenHalfSums(half_sum, lo, hi);
+    (*this)(x, y, lo, hi);
+  }
+};
+
+template <typename T>
+HWY_ATTR HWY_INLINE CompoundOutput<T> MakeCompoundOutput(
+    T *dst, int dst_stride, const ConvolveParams *conv_params, int bd,
+    int pre_shift, int32_t add0, int shift0, int post_shift, int32_t add1) {
+  const int offset_bits = bd + 2 * FILTER_BITS - conv_params->round_0;
+  const int round_offset = (1 << (offset_bits - conv_params->round_1)) +
+                           (1 << (offset_bits - conv_params->round_1 - 1));
+  const int round_bits =
+      2 * FILTER_BITS - conv_params->round_0 - conv_params->round_1;
+  assert(round_bits >= 0);
+  return { dst,
+           dst_stride,
+           conv_params->dst,
+           conv_params->dst_stride,
+           pre_shift,
+           add0,
+           shift0,
+           post_shift,
+           add1,
+           conv_params->do_average,
+           conv_params->use_dist_wtd_comp_avg,
+           conv_params->fwd_offset,
+           conv_params->bck_offset,
+           ((1 << round_bits) >> 1) - round_offset,
+           round_bits,
+           (1 << bd) - 1 };
+}
+
+// Runs the horizontal pass into an intermediate buffer one 32-pixel wide strip
+// at a time, so that the buffer stays in L1, then the vertical pass over it.
+template <typename T, class Output>
+HWY_ATTR HWY_INLINE void Convolve2D(const T *src, int src_stride, int w, int h,
+                                    const InterpFilterParams *filter_params_x,
+                                    const InterpFilterParams *filter_params_y,
+                                    int subpel_x_qn, int subpel_y_qn,
+                                    const ConvolveParams *conv_params, int bd,
+                                    const Output &output) {
+  const int lanes = (int)hn::Lanes(int16xN_tag);
+  DECLARE_ALIGNED(64, int16_t,
+                  im_block[(MAX_SB_SIZE + MAX_FILTER_TAP - 1) * 32]);
+  const int im_h = h + filter_params_y->taps - 1;
+  const int fo_vert = filter_params_y->taps / 2 - 1;
+  const int32_t im_add =
+      (1 << (bd + FILTER_BITS - 1)) + ((1 << conv_params->round_0) >> 1);
+  for (int x = 0; x < w; x += lanes) {
+    // Shift the buffer so that column x lands at its start.
+    const IntermediateOutput im_output = { im_block - x, lanes, im_add,
+                                           conv_params->round_0 };
+    Filter<false>(src - fo_vert * src_stride, src_stride, x, x + lanes, im_h,
+                  filter_params_x, subpel_x_qn, im_output);
+    Filter<true>(im_block - x + fo_vert * lanes, lanes, x, x + lanes, h,
+                 filter_params_y, subpel_y_qn, output);
+  }
+}
+
+// Coefficient pairs for SatWidenMulPairwiseAdd() on 8-bit pixels. As in the
+// AVX2 code the coefficients, which are all even, are halved so that the sums
+// fit in 16 bits.
+template <int kPairs, class D8>
+HWY_ATTR HWY_INLINE void PrepareHalvedCoeffs(
+    D8 d8, const int16_t *filter,
+    hn::VFromD<hn::Repartition<int8_t, D8>> coeffs[kPairs]) {
+  const hn::Repartition<int16_t, D8> d16;
+  const hn::Repartition<int8_t, D8> di8;
+  (void)d8;
+  for (int k = 0; k < kPairs; ++k) {
+    assert(!(filter[2 * k] & 1) && !(filter[2 * k + 1] & 1));
+    const uint16_t pair = (uint16_t)((uint8_t)(filter[2 * k] >> 1) |
+                                     ((uint8_t)(filter[2 * k + 1] >> 1) << 8));
+    coeffs[k] = hn::BitCast(di8, hn::Set(d16, (int16_t)pair));
+  }
+}
+
+// 8-bit vertical filter for single reference prediction. As in
+// FilterHorizontal() for 8-bit rows, byte pairs are multiplied by halved
+// coefficients; here they are the interleaved bytes of two rows, so a vector
+// covers 64 pixels. Interleaving works within 128-bit blocks: 'lo' holds the
+// sums of pixels 0-7 of every block and 'hi' those of pixels 8-15, and the
+// packing in ReorderDemote2To() puts them back in order.
+template <int kPairs, class D8>
+HWY_ATTR HWY_INLINE void FilterVerticalBytes(D8 d8, const uint8_t *src,
+                                             int src_stride, uint8_t *dst,
+                                             int dst_stride, int w, int h,
+                                             const int16_t *filter) {
+  assert(!(h & 1));
+  const hn::Repartition<int16_t, D8> d16;
+  using V8 = hn::VFromD<D8>;
+  using V16 = hn::VFromD<decltype(d16)>;
+  hn::VFromD<hn::Repartition<int8_t, D8>> coeffs[kPairs];
+  PrepareHalvedCoeffs<kPairs>(d8, filter, coeffs);
+  // ROUND_POWER_OF_TWO(2 * sum, FILTER_BITS).
+  const V16 round = hn::Set(d16, 1 << (FILTER_BITS - 2));
+  const int lanes = (int)hn::Lanes(d8);
+  for (int x = 0; x < w; x += lanes) {
+    const uint8_t *s = src + x;
+    V8 even_lo[kPairs], even_hi[kPairs], odd_lo[kPairs], odd_hi[kPairs];
+    V8 rows[2 * kPairs - 1];
+    for (int r = 0; r < 2 * kPairs - 1; ++r) {
+      rows[r] = hn::LoadU(d8, s + r * src_stride);
+    }
+    for (int k = 0; k < kPairs - 1; ++k) {
+      even_lo[k] = hn::InterleaveLower(d8, rows[2 * k], rows[2 * k + 1]);
+      even_hi[k] = hn::InterleaveUpper(d8, rows[2 * k], rows[2 * k + 1]);
+      odd_lo[k] = hn::InterleaveLower(d8, rows[2 * k + 1], rows[2 * k + 2]);
+      odd_hi[k] = hn::InterleaveUpper(d8, rows[2 * k + 1], rows[2 * k + 2]);
+    }
+    V8 last = rows[2 * kPairs - 2];
+    s += (2 * kPairs - 1) * src_stride;
+
+    for (int y = 0; y < h; y += 2) {
+      const V8 r0 = hn::LoadU(d8, s);
+      const V8 r1 = hn::LoadU(d8, s + src_stride);
+      s += 2 * src_stride;
+      even_lo[kPairs - 1] = hn::InterleaveLower(d8, last, r0);
+      even_hi[kPairs - 1] = hn::InterleaveUpper(d8, last, r0);
+      odd_lo[kPairs - 1] = hn::InterleaveLower(d8, r0, r1);
+      odd_hi[kPairs - 1] = hn::InterleaveUpper(d8, r0, r1);
+      last = r1;
+
+      V16 lo0 = round, hi0 = round, lo1 = round, hi1 = round;
+      for (int k = 0; k < kPairs; ++k) {
+        lo0 = hn::Add(lo0, hn::SatWidenMulPairwiseAdd(d16, even_lo[k],
+                                                      coeffs[k]));
+        hi0 = hn::Add(hi0, hn::SatWidenMulPairwiseAdd(d16, even_hi[k],
+                                                      coeffs[k]));
+        lo1 = hn::Add(lo1, hn::SatWidenMulPairwiseAdd(d16, odd_lo[k],
+                                                      coeffs[k]));
+        hi1 = hn::Add(hi1, hn::SatWidenMulPairwiseAdd(d16, odd_hi[k],
+                                                      coeffs[k]));
+      }
+      hn::StoreU(hn::ReorderDemote2To(
+                     d8, hn::ShiftRight<FILTER_BITS - 1>(lo0),
+                     hn::ShiftRight<FILTER_BITS - 1>(hi0)),
+                 d8, dst + y * dst_stride + x);
+      hn::StoreU(hn::ReorderDemote2To(
+                     d8, hn::ShiftRight<FILTER_BITS - 1>(lo1),
+                     hn::ShiftRight<FILTER_BITS - 1>(hi1)),
+                 d8, dst + (y + 1) * dst_stride + x);
+
+      for (int k = 0; k < kPairs - 1; ++k) {
+        even_lo[k] = even_lo[k + 1];
+        even_hi[k] = even_hi[k + 1];
+        odd_lo[k] = odd_lo[k + 1];
+        odd_hi[k] = odd_hi[k + 1];
+      }
+    }
+  }
+}
+
+// 8-bit horizontal filter for single reference prediction. A load starting
+// on the first tap of a pair holds the pixel pairs of the even pixels, as
+// 16-bit lanes, and a load one byte further those of the odd pixels, so no
+// shuffles are needed to multiply them. Packing the even and odd sums gives
+// the even then the odd pixels of every block, which one byte shuffle within
+// blocks interleaves.
+template <int kPairs, class D8>
+HWY_ATTR HWY_INLINE void FilterHorizontalBytes(D8 d8, const uint8_t *src,
+                                               int src_stride, uint8_t *dst,
+                                               int dst_stride, int w, int h,
+                                               const int16_t *filter,
+                                               int round_0) {
+  const hn::Repartition<int16_t, D8> d16;
+  using V16 = hn::VFromD<decltype(d16)>;
+  hn::VFromD<hn::Repartition<int8_t, D8>> coeffs[kPairs];
+  PrepareHalvedCoeffs<kPairs>(d8, filter, coeffs);
+  // ROUND_POWER_OF_TWO(ROUND_POWER_OF_TWO(2 * sum, round_0), bits) as a single
+  // rounding shift.
+  const int bits = FILTER_BITS - round_0;
+  assert(round_0 >= 2 && bits >= 0);
+  const V16 round = hn::Set(
+      d16, (int16_t)((1 << (round_0 - 2)) + (((1 << bits) >> 1)
+                                             << (round_0 - 1))));
+  const int shift = round_0 - 1 + bits;
+  alignas(16) static constexpr uint8_t kInterleave[16] = {
+    0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15
+  };
+  const auto interleave = hn::LoadDup128(d8, kInterleave);
+  const int lanes = (int)hn::Lanes(d8);
+  for (int y = 0; y < h; ++y) {
+    for (int x = 0; x < w; x += lanes) {
+      V16 even = round;
+      V16 odd = round;
+      for (int k = 0; k < kPairs; ++k) {
+        even = hn::Add(even, hn::SatWidenMulPairwiseAdd(
+                                 d16, hn::LoadU(d8, src + x + 2 * k),
+                                 coeffs[k]));
+        odd = hn::Add(odd, hn::SatWidenMulPairwiseAdd(
+                               d16, hn::LoadU(d8, src + x + 2 * k + 1),
+                               coeffs[k]));
+      }
+      const auto packed = hn::ReorderDemote2To(
+          d8, hn::ShiftRightSame(even, shift), hn::ShiftRightSame(odd, shift));
+      hn::StoreU(hn::TableLookupBytes(packed, interleave), d8, dst + x);
+    }
+    src += src_stride;
+    dst += dst_stride;
+  }
+}
+
+template <int kPairs, bool kVertical, class D8>
+HWY_ATTR HWY_INLINE void FilterBytesPairs(D8 d8, const uint8_t *src,
+                                          int src_stride, uint8_t *dst,
+                                          int dst_stride, int w, int h,
+                                          const int16_t *filter, int round_0) {
+  const int skip = 4 - kPairs;
+  if (kVertical) {
+    FilterVerticalBytes<kPairs>(d8, src + skip * src_stride, src_stride, dst,
+                                dst_stride, w, h, filter + skip);
+  } else {
+    FilterHorizontalBytes<kPairs>(d8, src + skip, src_stride, dst, dst_stride,
+                                  w, h, filter + skip, round_0);
+  }
+}
+
+template <bool kVertical, class D8>
+HWY_ATTR HWY_INLINE void FilterBytes(D8 d8, const uint8_t *src,
+                                     int src_stride, uint8_t *dst,
+                                     int dst_stride, int w, int h,
+                                     const InterpFilterParams *filter_params,
+                                     int subpel_qn, int round_0) {
+  assert(filter_params->taps == 8);
+  const int16_t *filter = av1_get_interp_filter_subpel_kernel(
+      filter_params, subpel_qn & SUBPEL_MASK);
+  src -= (filter_params->taps / 2 - 1) * (kVertical ? src_stride : 1);
+  switch (get_filter_tap(filter_params, subpel_qn)) {
+    case 8:
+      FilterBytesPairs<4, kVertical>(d8, src, src_stride, dst, dst_stride, w,
+                                     h, filter, round_0);
+      break;
+    case 6:
+      FilterBytesPairs<3, kVertical>(d8, src, src_stride, dst, dst_stride, w,
+                                     h, filter, round_0);
+      break;
+    default:
+      FilterBytesPairs<2, kVertical>(d8, src, src_stride, dst, dst_stride, w,
+                                     h, filter, round_0);
+      break;
+  }
+}
+
+// Single reference prediction of 8-bit pixels, a whole 64-pixel row per
+// vector. A 32-pixel wide block fills half a vector.
+template <bool kVertical>
+HWY_ATTR HWY_INLINE void ConvolveSrBytes(
+    const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride, int w,
+    int h, const InterpFilterParams *filter_params, int subpel_qn,
+    int round_0) {
+  constexpr hn::CappedTag<uint8_t, 64> uint8x64_tag;
+  constexpr hn::CappedTag<uint8_t, 32> uint8x32_tag;
+  if (w >= (int)hn::Lanes(uint8x64_tag)) {
+    FilterBytes<kVertical>(uint8x64_tag, src, src_stride, dst, dst_stride, w,
+                           h, filter_params, subpel_qn, round_0);
+  } else {
+    FilterBytes<kVertical>(uint8x32_tag, src, src_stride, dst, dst_stride, w,
+                           h, filter_params, subpel_qn, round_0);
+  }
+}
+
+template <typename T>
+HWY_ATTR void ConvolveXSr(const T *src, int src_stride, T *dst, int dst_stride,
+                          int w, int h,
+                          const InterpFilterParams *filter_params_x,
+                          int subpel_x_qn, const ConvolveParams *conv_params,
+                          int bd) {
+  const int bits = FILTER_BITS - conv_params->round_0;
+  assert(bits >= 0);
+  const SingleRefOutput<T> output = { dst,
+                                      dst_stride,
+                                      (1 << conv_params->round_0) >> 1,
+                                      conv_params->round_0,
+                                      (1 << bits) >> 1,
+                                      bits,
+                                      (1 << bd) - 1 };
+  Filter<false>(src, src_stride, 0, w, h, filter_params_x, subpel_x_qn,
+                output);
+}
+
+HWY_ATTR void ConvolveXSr(const uint8_t *src, int src_stride, uint8_t *dst,
+                          int dst_stride, int w, int h,
+                          const InterpFilterParams *filter_params_x,
+                          int subpel_x_qn, const ConvolveParams *conv_params,
+                          int bd) {
+  (void)bd;
+  assert(bd == 8);
+  ConvolveSrBytes<false>(src, src_stride, dst, dst_stride, w, h,
+                         filter_params_x, subpel_x_qn, conv_params->round_0);
+}
+
+template <typename T>
+HWY_ATTR void ConvolveYSr(const T *src, int src_stride, T *dst, int dst_stride,
+                          int w, int h,
+                          const InterpFilterParams *filter_params_y,
+                          int subpel_y_qn, int bd) {
+  const SingleRefOutput<T> output = {
+    dst, dst_stride, 1 << (FILTER_BITS - 1), FILTER_BITS, 0, 0, (1 << bd) - 1
+  };
+  Filter<true>(src, src_stride, 0, w, h, filter_params_y, subpel_y_qn, output);
+}
+
+HWY_ATTR void ConvolveYSr(const uint8_t *src, int src_stride, uint8_t *dst,
+                          int dst_stride, int w, int h,
+                          const InterpFilterParams *filter_params_y,
+                          int subpel_y_qn, int bd) {
+  (void)bd;
+  assert(bd == 8);
+  ConvolveSrBytes<true>(src, src_stride, dst, dst_stride, w, h,
+                        filter_params_y, subpel_y_qn, 0);
+}
+
+template <typename T>
+HWY_ATTR void Convolve2DSr(const T *src, int src_stride, T *dst,
+                           int dst_stride, int w, int h,
+                           const InterpFilterParams *filter_params_x,
+                           const InterpFilterParams *filter_params_y,
+                           int subpel_x_qn, int subpel_y_qn,
+                           const ConvolveParams *conv_params, int bd) {
+  const int offset_bits = bd + 2 * FILTER_BITS - conv_params->round_0;
+  const int round_offset = (1 << (offset_bits - conv_params->round_1)) +
+                           (1 << (offset_bits - conv_params->round_1 - 1));
+  const int bits =
+      2 * FILTER_BITS - conv_params->round_0 - conv_params->round_1;
+  assert(bits >= 0);
+  const SingleRefOutput<T> output = {
+    dst,
+    dst_stride,
+    (1 << offset_bits) + ((1 << conv_params->round_1) >> 1),
+    conv_params->round_1,
+    ((1 << bits) >> 1) - round_offset,
+    bits,
+    (1 << bd) - 1
+  };
+  Convolve2D(src, src_stride, w, h, filter_params_x, filter_params_y,
+             subpel_x_qn, subpel_y_qn, conv_params, bd, output);
+}
+
+template <typename T>
+HWY_ATTR void DistWtdConvolveX(const T *src, int src_stride, T *dst,
+                               int dst_stride, int w, int h,
+                               const InterpFilterParams *filter_params_x,
+                               int subpel_x_qn,
+                               const ConvolveParams *conv_params, int bd) {
+  const int offset_bits = bd + 2 * FILTER_BITS - conv_params->round_0;
+  const int round_offset = (1 << (offset_bits - conv_params->round_1)) +
+                           (1 << (offset_bits - conv_params->round_1 - 1));
+  const int bits = FILTER_BITS - conv_params->round_1;
+  assert(bits >= 0);
+  const CompoundOutput<T> output = MakeCompoundOutput(
+      dst, dst_stride, conv_params, bd, 0, (1 << conv_params->round_0) >> 1,
+      conv_params->round_0, bits, round_offset);
+  Filter<false>(src, src_stride, 0, w, h, filter_params_x, subpel_x_qn,
+                output);
+}
+
+template <typename T>
+HWY_ATTR void DistWtdConvolveY(const T *src, int src_stride, T *dst,
+                               int dst_stride, int w, int h,
+                               const InterpFilterParams *filter_params_y,
+                               int subpel_y_qn,
+                               const ConvolveParams *conv_params, int bd) {
+  const int offset_bits = bd + 2 * FILTER_BITS - conv_params->round_0;
+  const int round_offset = (1 << (offset_bits - conv_params->round_1)) +
+                           (1 << (offset_bits - conv_params->round_1 - 1));
+  const int bits = FILTER_BITS - conv_params->round_0;
+  assert(bits >= 0);
+  const CompoundOutput<T> output = MakeCompoundOutput(
+      dst, dst_stride, conv_params, bd, bits,
+      (1 << conv_params->round_1) >> 1, conv_params->round_1, 0, round_offset);
+  Filter<true>(src, src_stride, 0, w, h, filter_params_y, subpel_y_qn, output);
+}
+
+template <typename T>
+HWY_ATTR void DistWtdConvolve2D(const T *src, int src_stride, T *dst,
+                                int dst_stride, int w, int h,
+                                const InterpFilterParams *filter_params_x,
+                                const InterpFilterParams *filter_params_y,
+                                int subpel_x_qn, int subpel_y_qn,
+                                const ConvolveParams *conv_params, int bd) {
+  const int offset_bits = bd + 2 * FILTER_BITS - conv_params->round_0;
+  const CompoundOutput<T> output = MakeCompoundOutput(
+      dst, dst_stride, conv_params, bd, 0,
+      (1 << offset_bits) + ((1 << conv_params->round_1) >> 1),
+      conv_params->round_1, 0, 0);
+  Convolve2D(src, src_stride, w, h, filter_params_x, filter_params_y,
+             subpel_x_qn, subpel_y_qn, conv_params, bd, output);
+}
+
+template <typename T>
+HWY_ATTR HWY_INLINE void AverageCopy(const CompoundOutput<T> &output, int x,
+                                     int y, VecI16 s) {
+  const VecI16 zero = hn::Zero(int16xN_tag);
+  output(x, y,
+         hn::BitCast(int32xN_tag, hn::InterleaveLower(int16xN_tag, s, zero)),
+         hn::BitCast(int32xN_tag, hn::InterleaveUpper(int16xN_tag, s, zero)));
+}
+
+HWY_ATTR HWY_INLINE void AverageCopy(const CompoundOutput<uint8_t> &output,
+                                     int x, int y, VecI16 s) {
+  output.AverageLowbd(x, y,
+                      hn::Add(hn::ShiftLeftSame(s, output.pre_shift),
+                              hn::Set(int16xN_tag, (int16_t)output.add1)));
+}
+
+template <typename T>
+HWY_ATTR void DistWtdConvolve2DCopy(const T *src, int src_stride, T *dst,
+                                    int dst_stride, int w, int h,
+                                    const ConvolveParams *conv_params,
+                                    int bd) {
+  const int offset_bits = bd + 2 * FILTER_BITS - conv_params->round_0;
+  const int round_offset = (1 << (offset_bits - conv_params->round_1)) +
+                           (1 << (offset_bits - conv_params->round_1 - 1));
+  const int bits =
+      2 * FILTER_BITS - conv_params->round_0 - conv_params->round_1;
+  const int lanes = (int)hn::Lanes(int16xN_tag);
+  if (!conv_params->do_average) {
+    // The result fits in CONV_BUF_TYPE, so there is no need to widen.
+    const auto offset = hn::Set(uint16xN_tag, (uint16_t)round_offset);
+    CONV_BUF_TYPE *dst16 = conv_params->dst;
+    for (int y = 0; y < h; ++y) {
+      for (int x = 0; x < w; x += lanes) {
+        const auto s = hn::BitCast(uint16xN_tag, LoadPixels(src + x));
+        hn::StoreU(hn::Add(hn::ShiftLeftSame(s, bits), offset), uint16xN_tag,
+                   dst16 + x);
+      }
+      src += src_stride;
+      dst16 += conv_params->dst_stride;
+    }
+    return;
+  }
+  const CompoundOutput<T> output = MakeCompoundOutput(
+      dst, dst_stride, conv_params, bd, bits, 0, 0, 0, round_offset);
+  for (int y = 0; y < h; ++y) {
+    for (int x = 0; x < w; x += lanes) {
+      AverageCopy(output, x, y, LoadPixels(src + x));
+    }
+    src += src_stride;
+  }
+}
+
+}  // namespace HWY_NAMESPACE
+}  // namespace
+
+#define MAKE_CONVOLVE(suffix, fallback)                                       \
+  extern "C" void av1_convolve_x_sr_##suffix(                                 \
+      const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride,       \
+      int w, int h, const InterpFilterParams *filter_params_x,                \
+      const int subpel_x_qn, ConvolveParams *conv_params);                    \
+  HWY_ATTR void av1_convolve_x_sr_##suffix(                                   \
+      const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride,       \
+      int w, int h, const InterpFilterParams *filter_params_x,                \
+      const int subpel_x_qn, ConvolveParams *conv_params) {                   \
+    if (!HWY_NAMESPACE::UseWideConvolve(w, filter_params_x)) {                \
+      av1_convolve_x_sr_##fallback(src, src_stride, dst, dst_stride, w, h,    \
+                                   filter_params_x, subpel_x_qn,              \
+                                   conv_params);                              \
+      return;                                                                 \
+    }                                                                         \
+    HWY_NAMESPACE::ConvolveXSr(src, src_stride, dst, dst_stride, w, h,        \
+                               filter_params_x, subpel_x_qn, conv_params, 8); \
+  }                                                                           \
+  extern "C" void av1_convolve_y_sr_##suffix(                                 \
+      const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride,       \
+      int w, int h, const InterpFilterParams *filter_params_y,                \
+      const int subpel_y_qn);                                                 \
+  HWY_ATTR void av1_convolve_y_sr_##suffix(                                   \
+      const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride,       \
+      int w, int h, const InterpFilterParams *filter_params_y,                \
+      const int subpel_y_qn) {                                                \
+    if (!HWY_NAMESPACE::UseWideConvolve(w, filter_params_y)) {                \
+      av1_convolve_y_sr_##fallback(src, src_stride, dst, dst_stride, w, h,    \
+                                   filter_params_y, subpel_y_qn);             \
+      return;                                                                 \
+    }                                                                         \
+    HWY_NAMESPACE::ConvolveYSr(src, src_stride, dst, dst_stride, w, h,        \
+                               filter_params_y, subpel_y_qn, 8);              \
+  }                                                                           \
+  extern "C" void av1_convolve_2d_sr_##suffix(                                \
+      const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride,       \
+      int w, int h, const InterpFilterParams *filter_params_x,                \
+      const InterpFilterParams *filter_params_y, const int subpel_x_qn,       \
+      const int subpel_y_qn, ConvolveParams *conv_params);                    \
+  HWY_ATTR void av1_convolve_2d_sr_##suffix(                                  \
+      const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride,       \
+      int w, int h, const InterpFilterParams *filter_params_x,                \
+      const InterpFilterParams *filter_params_y, const int subpel_x_qn,       \
+      const int subpel_y_qn, ConvolveParams *conv_params) {                   \
+    if (!HWY_NAMESPACE::UseWideConvolve(w, filter_params_x) ||                \
+        !HWY_NAMESPACE::UseWideConvolve(w, filter_params_y)) {                \
+      av1_convolve_2d_sr_##fallback(src, src_stride, dst, dst_stride, w, h,   \
+                                    filter_params_x, filter_params_y,         \
+                                    subpel_x_qn, subpel_y_qn, conv_params);   \
+      return;                                                                 \
+    }                                                                         \
+    HWY_NAMESPACE::Convolve2DSr(src, src_stride, dst, dst_stride, w, h,       \
+                                filter_params_x, filter_params_y,             \
+                                subpel_x_qn, subpel_y_qn, conv_params, 8);    \
+  }                                                                           \
+  extern "C" void av1_dist_wtd_convolve_x_##suffix(                           \
+      const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride,       \
+      int w, int h, const InterpFilterParams *filter_params_x,                \
+      const int subpel_x_qn, ConvolveParams *conv_params);                    \
+  HWY_ATTR void av1_dist_wtd_convolve_x_##suffix(                             \
+      const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride,       \
+      int w, int h, const InterpFilterParams *filter_params_x,                \
+      const int subpel_x_qn, ConvolveParams *conv_params) {                   \
+    if (!HWY_NAMESPACE::UseWideConvolve(w, filter_params_x)) {                \
+      av1_dist_wtd_convolve_x_##fallback(src, src_stride, dst, dst_stride, w, \
+                                         h, filter_params_x, subpel_x_qn,     \
+                                         conv_params);                        \
+      return;                                                                 \
+    }                                                                         \
+    HWY_NAMESPACE::DistWtdConvolveX(src, src_stride, dst, dst_stride, w, h,   \
+                                    filter_params_x, subpel_x_qn,             \
+                                    conv_params, 8);                          \
+  }                                                                           \
+  extern "C" void av1_dist_wtd_convolve_y_##suffix(                           \
+      const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride,       \
+      int w, int h, const InterpFilterParams *filter_params_y,                \
+      const int subpel_y_qn, ConvolveParams *conv_params);                    \
+  HWY_ATTR void av1_dist_wtd_convolve_y_##suffix(                             \
+      const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride,       \
+      int w, int h, const InterpFilterParams *filter_params_y,                \
+      const int subpel_y_qn, ConvolveParams *conv_params) {                   \
+    if (!HWY_NAMESPACE::UseWideConvolve(w, filter_params_y)) {                \
+      av1_dist_wtd_convolve_y_##fallback(src, src_stride, dst, dst_stride, w, \
+                                         h, filter_params_y, subpel_y_qn,     \
+                                         conv_params);                        \
+      return;                                                                 \
+    }                                                                         \
+    HWY_NAMESPACE::DistWtdConvolveY(src, src_stride, dst, dst_stride, w, h,   \
+                                    filter_params_y, subpel_y_qn,             \
+                                    conv_params, 8);                          \
+  }                                                                           \
+  extern "C" void av1_dist_wtd_convolve_2d_##suffix(                          \
+      const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride,       \
+      int w, int h, const InterpFilterParams *filter_params_x,                \
+      const InterpFilterParams *filter_params_y, const int subpel_x_qn,       \
+      const int subpel_y_qn, ConvolveParams *conv_params);                    \
+  HWY_ATTR void av1_dist_wtd_convolve_2d_##suffix(                            \
+      const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride,       \
+      int w, int h, const InterpFilterParams *filter_params_x,                \
+      const InterpFilterParams *filter_params_y, const int subpel_x_qn,       \
+      const int subpel_y_qn, ConvolveParams *conv_params) {                   \
+    if (!HWY_NAMESPACE::UseWideConvolve(w, filter_params_x) ||                \
+        !HWY_NAMESPACE::UseWideConvolve(w, filter_params_y)) {                \
+      av1_dist_wtd_convolve_2d_##fallback(                                    \
+          src, src_stride, dst, dst_stride, w, h, filter_params_x,            \
+          filter_params_y, subpel_x_qn, subpel_y_qn, conv_params);            \
+      return;                                                                 \
+    }                                                                         \
+    HWY_NAMESPACE::DistWtdConvolve2D(src, src_stride, dst, dst_stride, w, h,  \
+                                     filter_params_x, filter_params_y,        \
+                                     subpel_x_qn, subpel_y_qn, conv_params,   \
+                                     8);                                      \
+  }                                                                           \
+  extern "C" void av1_dist_wtd_convolve_2d_copy_##suffix(                     \
+      const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride,       \
+      int w, int h, ConvolveParams *conv_params);                             \
+  HWY_ATTR void av1_dist_wtd_convolve_2d_copy_##suffix(                       \
+      const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride,       \
+      int w, int h, ConvolveParams *conv_params) {                            \
+    if (w < HWY_NAMESPACE::kMinConvolveWidth) {                               \
+      av1_dist_wtd_convolve_2d_copy_##fallback(src, src_stride, dst,          \
+                                               dst_stride, w, h,              \
+                                               conv_params);                  \
+      return;                                                                 \
+    }                                                                         \
+    HWY_NAMESPACE::DistWtdConvolve2DCopy(src, src_stride, dst, dst_stride, w, \
+                                         h, conv_params, 8);                  \
+  }
+
+#define MAKE_HIGHBD_CONVOLVE(suffix, fallback)                                \
+  extern "C" void av1_highbd_convolve_x_sr_##suffix(                          \
+      const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride,     \
+      int w, int h, const InterpFilterParams *filter_params_x,                \
+      const int subpel_x_qn, ConvolveParams *conv_params, int bd);            \
+  HWY_ATTR void av1_highbd_convolve_x_sr_##suffix(                            \
+      const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride,     \
+      int w, int h, const InterpFilterParams *filter_params_x,                \
+      const int subpel_x_qn, ConvolveParams *conv_params, int bd) {           \
+    if (!HWY_NAMESPACE::UseWideConvolve(w, filter_params_x)) {                \
+      av1_highbd_convolve_x_sr_##fallback(src, src_stride, dst, dst_stride,   \
+                                          w, h, filter_params_x,              \
+                                          subpel_x_qn, conv_params, bd);      \
+      return;                                                                 \
+    }                                                                         \
+    HWY_NAMESPACE::ConvolveXSr(src, src_stride, dst, dst_stride, w, h,        \
+                               filter_params_x, subpel_x_qn, conv_params,     \
+                               bd);                                           \
+  }                                                                           \
+  extern "C" void av1_highbd_convolve_y_sr_##suffix(                          \
+      const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride,     \
+      int w, int h, const InterpFilterParams *filter_params_y,                \
+      const int subpel_y_qn, int bd);                                         \
+  HWY_ATTR void av1_highbd_convolve_y_sr_##suffix(                            \
+      const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride,     \
+      int w, int h, const InterpFilterParams *filter_params_y,                \
+      const int subpel_y_qn, int bd) {                                        \
+    if (!HWY_NAMESPACE::UseWideConvolve(w, filter_params_y)) {                \
+      av1_highbd_convolve_y_sr_##fallback(src, src_stride, dst, dst_stride,   \
+                                          w, h, filter_params_y, subpel_y_qn, \
+                                          bd);                                \
+      return;                                                                 \
+    }                                                                         \
+    HWY_NAMESPACE::ConvolveYSr(src, src_stride, dst, dst_stride, w, h,        \
+                               filter_params_y, subpel_y_qn, bd);             \
+  }                                                                           \
+  extern "C" void av1_highbd_convolve_2d_sr_##suffix(                         \
+      const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride,     \
+      int w, int h, const InterpFilterParams *filter_params_x,                \
+      const InterpFilterParams *filter_params_y, const int subpel_x_qn,       \
+      const int subpel_y_qn, ConvolveParams *conv_params, int bd);            \
+  HWY_ATTR void av1_highbd_convolve_2d_sr_##suffix(                           \
+      const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride,     \
+      int w, int h, const InterpFilterParams *filter_params_x,                \
+      const InterpFilterParams *filter_params_y, const int subpel_x_qn,       \
+      const int subpel_y_qn, ConvolveParams *conv_params, int bd) {           \
+    if (!HWY_NAMESPACE::UseWideConvolve(w, filter_params_x) ||                \
+        !HWY_NAMESPACE::UseWideConvolve(w, filter_params_y)) {                \
+      av1_highbd_convolve_2d_sr_##fallback(                                   \
+          src, src_stride, dst, dst_stride, w, h, filter_params_x,            \
+          filter_params_y, subpel_x_qn, subpel_y_qn, conv_params, bd);        \
+      return;                                                                 \
+    }                                                                         \
+    HWY_NAMESPACE::Convolve2DSr(src, src_stride, dst, dst_stride, w, h,       \
+                                filter_params_x, filter_params_y,             \
+                                subpel_x_qn, subpel_y_qn, conv_params, bd);   \
+  }                                                                           \
+  extern "C" void av1_highbd_dist_wtd_convolve_x_##suffix(                    \
+      const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride,     \
+      int w, int h, const InterpFilterParams *filter_params_x,                \
+      const int subpel_x_qn, ConvolveParams *conv_params, int bd);            \
+  HWY_ATTR void av1_highbd_dist_wtd_convolve_x_##suffix(                      \
+      const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride,     \
+      int w, int h, const InterpFilterParams *filter_params_x,                \
+      const int subpel_x_qn, ConvolveParams *conv_params, int bd) {           \
+    if (!HWY_NAMESPACE::UseWideConvolve(w, filter_params_x)) {                \
+      av1_highbd_dist_wtd_convolve_x_##fallback(                              \
+          src, src_stride, dst, dst_stride, w, h, filter_params_x,            \
+          subpel_x_qn, conv_params, bd);                                      \
+      return;                                                                 \
+    }                                                                         \
+    HWY_NAMESPACE::DistWtdConvolveX(src, src_stride, dst, dst_stride, w, h,   \
+                                    filter_params_x, subpel_x_qn,             \
+                                    conv_params, bd);                         \
+  }                                                                           \
+  extern "C" void av1_highbd_dist_wtd_convolve_y_##suffix(                    \
+      const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride,     \
+      int w, int h, const InterpFilterParams *filter_params_y,                \
+      const int subpel_y_qn, ConvolveParams *conv_params, int bd);            \
+  HWY_ATTR void av1_highbd_dist_wtd_convolve_y_##suffix(                      \
+      const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride,     \
+      int w, int h, const InterpFilterParams *filter_params_y,                \
+      const int subpel_y_qn, ConvolveParams *conv_params, int bd) {           \
+    if (!HWY_NAMESPACE::UseWideConvolve(w, filter_params_y)) {                \
+      av1_highbd_dist_wtd_convolve_y_##fallback(                              \
+          src, src_stride, dst, dst_stride, w, h, filter_params_y,            \
+          subpel_y_qn, conv_params, bd);                                      \
+      return;                                                                 \
+    }                                                                         \
+    HWY_NAMESPACE::DistWtdConvolveY(src, src_stride, dst, dst_stride, w, h,   \
+                                    filter_params_y, subpel_y_qn,             \
+                                    conv_params, bd);                         \
+  }                                                                           \
+  extern "C" void av1_highbd_dist_wtd_convolve_2d_##suffix(                   \
+      const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride,     \
+      int w, int h, const InterpFilterParams *filter_params_x,                \
+      const InterpFilterParams *filter_params_y, const int subpel_x_qn,       \
+      const int subpel_y_qn, ConvolveParams *conv_params, int bd);            \
+  HWY_ATTR void av1_highbd_dist_wtd_convolve_2d_##suffix(                     \
+      const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride,     \
+      int w, int h, const InterpFilterParams *filter_params_x,                \
+      const InterpFilterParams *filter_params_y, const int subpel_x_qn,       \
+      const int subpel_y_qn, ConvolveParams *conv_params, int bd) {           \
+    if (!HWY_NAMESPACE::UseWideConvolve(w, filter_params_x) ||                \
+        !HWY_NAMESPACE::UseWideConvolve(w, filter_params_y)) {                \
+      av1_highbd_dist_wtd_convolve_2d_##fallback(                             \
+          src, src_stride, dst, dst_stride, w, h, filter_params_x,            \
+          filter_params_y, subpel_x_qn, subpel_y_qn, conv_params, bd);        \
+      return;                                                                 \
+    }                                                                         \
+    HWY_NAMESPACE::DistWtdConvolve2D(src, src_stride, dst, dst_stride, w, h,  \
+                                     filter_params_x, filter_params_y,        \
+                                     subpel_x_qn, subpel_y_qn, conv_params,   \
+                                     bd);                                     \
+  }                                                                           \
+  extern "C" void av1_highbd_dist_wtd_convolve_2d_copy_##suffix(              \
+      const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride,     \
+      int w, int h, ConvolveParams *conv_params, int bd);                     \
+  HWY_ATTR void av1_highbd_dist_wtd_convolve_2d_copy_##suffix(                \
+      const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride,     \
+      int w, int h, ConvolveParams *conv_params, int bd) {                    \
+    if (w < HWY_NAMESPACE::kMinConvolveWidth) {                               \
+      av1_highbd_dist_wtd_convolve_2d_copy_##fallback(                        \
+          src, src_stride, dst, dst_stride, w, h, conv_params, bd);           \
+      return;                                                                 \
+    }                                                                         \
+    HWY_NAMESPACE::DistWtdConvolve2DCopy(src, src_stride, dst, dst_stride, w, \
+                                         h, conv_params, bd);                 \
+  }
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // AOM_AV1_COMMON_CONVOLVE_HWY_H_
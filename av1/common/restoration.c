@@ -79,8 +79,9 @@ void av1_alloc_restoration_struct(AV1_COMMON *cm, RestorationInfo *rsi,
 
   aom_free(rsi->unit_info);
   CHECK_MEM_ERROR(cm, rsi->unit_info,
-                  (RestorationUnitInfo *)aom_memalign(
-                      16, sizeof(*rsi->unit_info) * rsi->num_rest_units));
+                  (RestorationUnitInfo *)aom_memalign_tagged(
+                      AOM_MEM_TAG_CDEF_LR, 16,
+                      sizeof(*rsi->unit_info) * rsi->num_rest_units));
 }
 
 void av1_free_restoration_struct(RestorationInfo *rst_info) {
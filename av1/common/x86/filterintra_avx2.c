@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <assert.h>
+#include <immintrin.h>
+#include <string.h>
+
+#include "config/av1_rtcd.h"
+
+#include "aom_dsp/x86/synonyms.h"
+#include "aom_dsp/x86/synonyms_avx2.h"
+#include "av1/common/enums.h"
+#include "av1/common/reconintra.h"
+
+// Computes one 4x2 block of the recursive filter from the 7 neighboring
+// pixels packed in the low 8 bytes of |pixels| (the 8th byte is multiplied by
+// a zero tap). The low 128-bit lane of |taps_a| holds the taps of outputs 0
+// and 1, the high lane those of outputs 4 and 5; |taps_b| holds outputs 2, 3
+// and 6, 7. After the horizontal adds the low lane then contains the first
+// output row and the high lane the second, so both rows are produced by a
+// single pass.
+static inline void filter_4x2_avx2(uint8_t *dst, ptrdiff_t stride,
+                                   uint64_t pixels, const __m256i *taps_a,
+                                   const __m256i *taps_b) {
+  const __m256i p = _mm256_set1_epi64x((int64_t)pixels);
+  const __m256i mul_a = _mm256_maddubs_epi16(p, *taps_a);
+  const __m256i mul_b = _mm256_maddubs_epi16(p, *taps_b);
+  __m256i sum = _mm256_hadd_epi16(mul_a, mul_b);
+  sum = _mm256_hadd_epi16(sum, sum);
+  // Round2() followed by clipping to [0, 255]. A negative sum is clipped to
+  // 0 by the saturating pack, as in the C code.
+  const __m256i round = _mm256_set1_epi16(1 << (FILTER_INTRA_SCALE_BITS - 1));
+  sum = _mm256_srai_epi16(_mm256_add_epi16(sum, round),
+                          FILTER_INTRA_SCALE_BITS);
+  const __m256i res = _mm256_packus_epi16(sum, sum);
+  xx_storel_32(dst, _mm256_castsi256_si128(res));
+  xx_storel_32(dst + stride, _mm256_extracti128_si256(res, 1));
+}
+
+// Packs p0 (top-left), p1..p4 (top) and p5, p6 (left) in that order.
+static inline uint64_t pack_neighbors(uint8_t top_left, const uint8_t *top,
+                                      uint8_t left0, uint8_t left1) {
+  uint32_t t;
+  memcpy(&t, top, sizeof(t));
+  return (uint64_t)top_left | ((uint64_t)t << 8) | ((uint64_t)left0 << 40) |
+         ((uint64_t)left1 << 48);
+}
+
+void av1_filter_intra_predictor_avx2(uint8_t *dst, ptrdiff_t stride,
+                                     TX_SIZE tx_size, const uint8_t *above,
+                                     const uint8_t *left, int mode) {
+  const int bw = tx_size_wide[tx_size];
+  const int bh = tx_size_high[tx_size];
+  assert(bw <= 32 && bh <= 32);
+
+  const int8_t(*taps)[8] = av1_filter_intra_taps[mode];
+  const __m256i taps_a = yy_loadu2_128(taps[4], taps[0]);
+  const __m256i taps_b = yy_loadu2_128(taps[6], taps[2]);
+
+  // First row of 4x2 blocks: the top neighbors come from |above|.
+  filter_4x2_avx2(dst, stride,
+                  pack_neighbors(above[-1], above, left[0], left[1]), &taps_a,
+                  &taps_b);
+  for (int c = 4; c < bw; c += 4) {
+    filter_4x2_avx2(dst + c, stride,
+                    pack_neighbors(above[c - 1], above + c, dst[c - 1],
+                                   dst[stride + c - 1]),
+                    &taps_a, &taps_b);
+  }
+
+  // Remaining rows: the top neighbors come from the previous output row.
+  for (int r = 2; r < bh; r += 2) {
+    uint8_t *const row = dst + r * stride;
+    const uint8_t *const top = row - stride;
+    filter_4x2_avx2(row, stride,
+                    pack_neighbors(left[r - 1], top, left[r], left[r + 1]),
+                    &taps_a, &taps_b);
+    for (int c = 4; c < bw; c += 4) {
+      filter_4x2_avx2(row + c, stride,
+                      pack_neighbors(top[c - 1], top + c, row[c - 1],
+                                     row[stride + c - 1]),
+                      &taps_a, &taps_b);
+    }
+  }
+}
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <assert.h>
+#include <immintrin.h>
+#include <string.h>
+
+#include "config/aom_config.h"
+#include "config/av1_rtcd.h"
+
+#include "aom_dsp/x86/synonyms.h"
+#include "aom_dsp/x86/synonyms_avx2.h"
+
+// The longest edge that is filtered is 2 * 64 pixels plus the top-left pixel.
+#define MAX_EDGE_SZ 129
+// The 5-tap filter starts one pixel before the edge and the last (partial)
+// block of 16 outputs reads up to 16 + 3 samples past its start, which is
+// covered by 32 samples of padding.
+#define EDGE_BUF_SZ (1 + MAX_EDGE_SZ + 32)
+#define MAX_UPSAMPLE_SZ 16
+
+// Filters 16 edge pixels per iteration. The edge is first copied into a
+// padded local buffer: the filter works in place, so reading the input back
+// from |p| would pick up already filtered values. The padding also replaces
+// the clamping of the filter support to [0, sz - 1] done by the C code.
+void av1_filter_intra_edge_avx2(uint8_t *p, int sz, int strength) {
+  if (!strength) return;
+  assert(sz <= MAX_EDGE_SZ);
+
+  DECLARE_ALIGNED(32, uint8_t, edge[EDGE_BUF_SZ]);
+  edge[0] = p[0];
+  memcpy(edge + 1, p, sz);
+  yy_storeu_256(edge + 1 + sz, _mm256_set1_epi8((char)p[sz - 1]));
+
+  // Output i is written to p[i + 1]. With the 3-tap filter it reads
+  // p[i .. i + 2], with the 5-tap filter p[i - 1 .. i + 3].
+  const uint8_t *in = (strength == 3) ? edge : edge + 1;
+  uint8_t *out = p + 1;
+  const int len = sz - 1;
+  const __m256i round = _mm256_set1_epi16(8);
+
+  if (strength < 3) {
+    const __m256i outer = _mm256_set1_epi16(strength == 1 ? 4 : 5);
+    const __m256i inner = _mm256_set1_epi16(strength == 1 ? 8 : 6);
+    for (int i = 0; i < len; i += 16) {
+      const __m256i e0 = _mm256_cvtepu8_epi16(xx_loadu_128(in + i));
+      const __m256i e1 = _mm256_cvtepu8_epi16(xx_loadu_128(in + i + 1));
+      const __m256i e2 = _mm256_cvtepu8_epi16(xx_loadu_128(in + i + 2));
+      __m256i sum = _mm256_mullo_epi16(_mm256_add_epi16(e0, e2), outer);
+      sum = _mm256_add_epi16(sum, _mm256_mullo_epi16(e1, inner));
+      sum = _mm256_srli_epi16(_mm256_add_epi16(sum, round), 4);
+      const __m128i res = _mm_packus_epi16(_mm256_castsi256_si128(sum),
+                                           _mm256_extracti128_si256(sum, 1));
+      if (len - i >= 16) {
+        xx_storeu_128(out + i, res);
+      } else {
+        DECLARE_ALIGNED(16, uint8_t, tmp[16]);
+        xx_store_128(tmp, res);
+        memcpy(out + i, tmp, len - i);
+      }
+    }
+  } else {  // 5-tap filter: 2, 4, 4, 4, 2
+    for (int i = 0; i < len; i += 16) {
+      const __m256i e0 = _mm256_cvtepu8_epi16(xx_loadu_128(in + i));
+      const __m256i e1 = _mm256_cvtepu8_epi16(xx_loadu_128(in + i + 1));
+      const __m256i e2 = _mm256_cvtepu8_epi16(xx_loadu_128(in + i + 2));
+      const __m256i e3 = _mm256_cvtepu8_epi16(xx_loadu_128(in + i + 3));
+      const __m256i e4 = _mm256_cvtepu8_epi16(xx_loadu_128(in + i + 4));
+      const __m256i outer = _mm256_add_epi16(e0, e4);
+      const __m256i inner = _mm256_add_epi16(_mm256_add_epi16(e1, e2), e3);
+      __m256i sum = _mm256_add_epi16(_mm256_slli_epi16(outer, 1),
+                                     _mm256_slli_epi16(inner, 2));
+      sum = _mm256_srli_epi16(_mm256_add_epi16(sum, round), 4);
+      const __m128i res = _mm_packus_epi16(_mm256_castsi256_si128(sum),
+                                           _mm256_extracti128_si256(sum, 1));
+      if (len - i >= 16) {
+        xx_storeu_128(out + i, res);
+      } else {
+        DECLARE_ALIGNED(16, uint8_t, tmp[16]);
+        xx_store_128(tmp, res);
+        memcpy(out + i, tmp, len - i);
+      }
+    }
+  }
+}
+
+// All 16 half-sample positions of the longest upsampled edge fit in a single
+// register, so the whole edge is interpolated at once.
+void av1_upsample_intra_edge_avx2(uint8_t *p, int sz) {
+  // interpolate half-sample positions
+  assert(sz <= MAX_UPSAMPLE_SZ);
+
+  // Extend first/last samples (upper-left p[-1], last p[sz-1])
+  // to support 4-tap filter
+  p[-2] = p[-1];
+  p[sz] = p[sz - 1];
+
+  const uint8_t *in = &p[-2];
+  const __m128i orig = xx_loadu_128(in + 2);
+  const __m256i e0 = _mm256_cvtepu8_epi16(xx_loadu_128(in));
+  const __m256i e1 = _mm256_cvtepu8_epi16(xx_loadu_128(in + 1));
+  const __m256i e2 = _mm256_cvtepu8_epi16(orig);
+  const __m256i e3 = _mm256_cvtepu8_epi16(xx_loadu_128(in + 3));
+  // -e0 + 9 * e1 + 9 * e2 - e3
+  __m256i sum =
+      _mm256_mullo_epi16(_mm256_add_epi16(e1, e2), _mm256_set1_epi16(9));
+  sum = _mm256_sub_epi16(sum, _mm256_add_epi16(e0, e3));
+  sum = _mm256_srai_epi16(_mm256_add_epi16(sum, _mm256_set1_epi16(8)), 4);
+  const __m128i filt = _mm_packus_epi16(_mm256_castsi256_si128(sum),
+                                        _mm256_extracti128_si256(sum, 1));
+
+  // Interleave as p[2 * i - 1] = filtered, p[2 * i] = original. Like the
+  // SSE4.1 version this may write past the last output sample.
+  xx_storeu_128(p - 1, _mm_unpacklo_epi8(filt, orig));
+  if (sz > 8) xx_storeu_128(p + 15, _mm_unpackhi_epi8(filt, orig));
+}
+
+#if CONFIG_AV1_HIGHBITDEPTH
+
+void av1_highbd_filter_intra_edge_avx2(uint16_t *p, int sz, int strength) {
+  if (!strength) return;
+  assert(sz <= MAX_EDGE_SZ);
+
+  DECLARE_ALIGNED(32, uint16_t, edge[EDGE_BUF_SZ]);
+  edge[0] = p[0];
+  memcpy(edge + 1, p, sz * sizeof(*p));
+  const __m256i last = _mm256_set1_epi16((short)p[sz - 1]);
+  yy_storeu_256(edge + 1 + sz, last);
+  yy_storeu_256(edge + 1 + sz + 16, last);
+
+  const uint16_t *in = (strength == 3) ? edge : edge + 1;
+  uint16_t *out = p + 1;
+  const int len = sz - 1;
+  const __m256i round = _mm256_set1_epi16(8);
+
+  // The sums fit in 16 bits for 12-bit input: 16 * 4095 + 8 < 65536, so they
+  // are computed modulo 2^16 and shifted as unsigned values.
+  if (strength < 3) {
+    const __m256i outer = _mm256_set1_epi16(strength == 1 ? 4 : 5);
+    const __m256i inner = _mm256_set1_epi16(strength == 1 ? 8 : 6);
+    for (int i = 0; i < len; i += 16) {
+      const __m256i e0 = yy_loadu_256(in + i);
+      const __m256i e1 = yy_loadu_256(in + i + 1);
+      const __m256i e2 = yy_loadu_256(in + i + 2);
+      __m256i sum = _mm256_mullo_epi16(_mm256_add_epi16(e0, e2), outer);
+      sum = _mm256_add_epi16(sum, _mm256_mullo_epi16(e1, inner));
+      sum = _mm256_srli_epi16(_mm256_add_epi16(sum, round), 4);
+      if (len - i >= 16) {
+        yy_storeu_256(out + i, sum);
+      } else {
+        DECLARE_ALIGNED(32, uint16_t, tmp[16]);
+        yy_store_256(tmp, sum);
+        memcpy(out + i, tmp, (len - i) * sizeof(*out));
+      }
+    }
+  } else {  // 5-tap filter: 2, 4, 4, 4, 2
+    for (int i = 0; i < len; i += 16) {
+      const __m256i e0 = yy_loadu_256(in + i);
+      const __m256i e1 = yy_loadu_256(in + i + 1);
+      const __m256i e2 = yy_loadu_256(in + i + 2);
+      const __m256i e3 = yy_loadu_256(in + i + 3);
+      const __m256i e4 = yy_loadu_256(in + i + 4);
+      const __m256i outer = _mm256_add_epi16(e0, e4);
+      const __m256i inner = _mm256_add_epi16(_mm256_add_epi16(e1, e2), e3);
+      __m256i sum = _mm256_add_epi16(_mm256_slli_epi16(outer, 1),
+                                     _mm256_slli_epi16(inner, 2));
+      sum = _mm256_srli_epi16(_mm256_add_epi16(sum, round), 4);
+      if (len - i >= 16) {
+        yy_storeu_256(out + i, sum);
+      } else {
+        DECLARE_ALIGNED(32, uint16_t, tmp[16]);
+        yy_store_256(tmp, sum);
+        memcpy(out + i, tmp, (len - i) * sizeof(*out));
+      }
+    }
+  }
+}
+
+void av1_highbd_upsample_intra_edge_avx2(uint16_t *p, int sz, int bd) {
+  // interpolate half-sample positions
+  assert(sz <= MAX_UPSAMPLE_SZ);
+
+  // Extend first/last samples (upper-left p[-1], last p[sz-1])
+  // to support 4-tap filter
+  p[-2] = p[-1];
+  p[sz] = p[sz - 1];
+
+  const uint16_t *in = &p[-2];
+  const __m256i e0 = yy_loadu_256(in);
+  const __m256i e1 = yy_loadu_256(in + 1);
+  const __m256i e2 = yy_loadu_256(in + 2);
+  const __m256i e3 = yy_loadu_256(in + 3);
+  // 9 * (e1 + e2) overflows 16 bits for 12-bit input, so the taps are applied
+  // with 32-bit precision on interleaved (e0 + e3, e1 + e2) pairs.
+  const __m256i sum03 = _mm256_add_epi16(e0, e3);
+  const __m256i sum12 = _mm256_add_epi16(e1, e2);
+  const __m256i coef = yy_set2_epi16(-1, 9);
+  const __m256i round = _mm256_set1_epi32(8);
+  __m256i d0 = _mm256_madd_epi16(_mm256_unpacklo_epi16(sum03, sum12), coef);
+  __m256i d1 = _mm256_madd_epi16(_mm256_unpackhi_epi16(sum03, sum12), coef);
+  d0 = _mm256_srai_epi32(_mm256_add_epi32(d0, round), 4);
+  d1 = _mm256_srai_epi32(_mm256_add_epi32(d1, round), 4);
+  // The in-lane pack undoes the in-lane unpack above.
+  __m256i filt = _mm256_packus_epi32(d0, d1);
+  filt = _mm256_min_epi16(filt, _mm256_set1_epi16((1 << bd) - 1));
+
+  // Interleave as p[2 * i - 1] = filtered, p[2 * i] = original.
+  const __m256i lo = _mm256_unpacklo_epi16(filt, e2);
+  const __m256i hi = _mm256_unpackhi_epi16(filt, e2);
+  yy_storeu_256(p - 1, _mm256_permute2x128_si256(lo, hi, 0x20));
+  if (sz > 8) yy_storeu_256(p + 15, _mm256_permute2x128_si256(lo, hi, 0x31));
+}
+
+#endif  // CONFIG_AV1_HIGHBITDEPTH
@@ -88,6 +88,19 @@ static void copy_frame(YV12_BUFFER_CONFIG *const dest,
   assert(dest->y_width == src->y_width);
   assert(dest->y_height == src->y_height);
 
+#if CONFIG_AV1_HIGHBITDEPTH
+  if (dest->flags & YV12_FLAG_HIGHBITDEPTH) {
+    const uint16_t *srcbuf16 = CONVERT_TO_SHORTPTR(srcbuf);
+    uint16_t *destbuf16 = CONVERT_TO_SHORTPTR(destbuf);
+    for (int r = 0; r < dest->y_height; ++r) {
+      memcpy(destbuf16, srcbuf16, dest->y_width * sizeof(*destbuf16));
+      destbuf16 += dest->y_stride;
+      srcbuf16 += src->y_stride;
+    }
+    return;
+  }
+#endif  // CONFIG_AV1_HIGHBITDEPTH
+
   for (int r = 0; r < dest->y_height; ++r) {
     memcpy(destbuf, srcbuf, dest->y_width);
     destbuf += dest->y_stride;
@@ -181,6 +181,111 @@ int av1_denoiser_filter_c(const uint8_t *sig, int sig_stride,
   return COPY_BLOCK;
 }
 
+#if CONFIG_AV1_HIGHBITDEPTH
+// High bitdepth version of av1_denoiser_filter_c(). The pixel difference
+// thresholds and the adjustments are scaled by the extra bits of precision,
+// so a bit depth of 8 gives the same result as the low bitdepth filter.
+int av1_highbd_denoiser_filter_c(const uint16_t *sig, int sig_stride,
+                                 const uint16_t *mc_avg, int mc_avg_stride,
+                                 uint16_t *avg, int avg_stride,
+                                 int increase_denoising, BLOCK_SIZE bs,
+                                 int motion_magnitude, int bd) {
+  const int shift = bd - 8;
+  const int pixel_max = (1 << bd) - 1;
+  const uint16_t *sig_start = sig;
+  const uint16_t *mc_avg_start = mc_avg;
+  uint16_t *avg_start = avg;
+  int adj_val[] = { 3, 4, 6 };
+  int total_adj = 0;
+  int shift_inc = 1;
+
+  if (motion_magnitude <= MOTION_MAGNITUDE_THRESHOLD) {
+    if (increase_denoising) {
+      shift_inc = 2;
+    }
+    adj_val[0] += shift_inc;
+    adj_val[1] += shift_inc;
+    adj_val[2] += shift_inc;
+  }
+
+  // First attempt to apply a strong temporal denoising filter.
+  const int thresh = absdiff_thresh(bs, increase_denoising) << shift;
+  for (int r = 0; r < block_size_high[bs]; ++r) {
+    for (int c = 0; c < block_size_wide[bs]; ++c) {
+      const int diff = mc_avg[c] - sig[c];
+      const int absdiff = abs(diff);
+
+      if (absdiff <= thresh) {
+        avg[c] = mc_avg[c];
+        total_adj += diff;
+      } else {
+        int adj;
+        if (absdiff < (8 << shift))
+          adj = adj_val[0] << shift;
+        else if (absdiff < (16 << shift))
+          adj = adj_val[1] << shift;
+        else
+          adj = adj_val[2] << shift;
+        if (diff > 0) {
+          avg[c] = AOMMIN(pixel_max, sig[c] + adj);
+          total_adj += adj;
+        } else {
+          avg[c] = AOMMAX(0, sig[c] - adj);
+          total_adj -= adj;
+        }
+      }
+    }
+    sig += sig_stride;
+    avg += avg_stride;
+    mc_avg += mc_avg_stride;
+  }
+
+  // If the strong filter did not modify the signal too much, we're all set.
+  const int strong_thresh = total_adj_strong_thresh(bs, increase_denoising)
+                            << shift;
+  if (abs(total_adj) <= strong_thresh) {
+    return FILTER_BLOCK;
+  }
+
+  // Otherwise, we try to dampen the filter if the delta is not too high.
+  const int delta =
+      ((abs(total_adj) - strong_thresh) >> (num_pels_log2_lookup[bs] + shift)) +
+      1;
+
+  if (delta >= delta_thresh(bs, increase_denoising)) {
+    return COPY_BLOCK;
+  }
+
+  const int max_adj = delta << shift;
+  mc_avg = mc_avg_start;
+  avg = avg_start;
+  sig = sig_start;
+  for (int r = 0; r < block_size_high[bs]; ++r) {
+    for (int c = 0; c < block_size_wide[bs]; ++c) {
+      const int diff = mc_avg[c] - sig[c];
+      const int adj = AOMMIN(abs(diff), max_adj);
+      if (diff > 0) {
+        avg[c] = AOMMAX(0, avg[c] - adj);
+        total_adj -= adj;
+      } else {
+        avg[c] = AOMMIN(pixel_max, avg[c] + adj);
+        total_adj += adj;
+      }
+    }
+    sig += sig_stride;
+    avg += avg_stride;
+    mc_avg += mc_avg_stride;
+  }
+
+  // We can use the filter if it has been sufficiently dampened
+  if (abs(total_adj) <=
+      total_adj_weak_thresh(bs, increase_denoising) << shift) {
+    return FILTER_BLOCK;
+  }
+  return COPY_BLOCK;
+}
+#endif  // CONFIG_AV1_HIGHBITDEPTH
+
 static uint8_t *block_start(uint8_t *framebuf, int stride, int mi_row,
                             int mi_col) {
   return framebuf + (stride * mi_row << 2) + (mi_col << 2);
@@ -352,19 +457,42 @@ void av1_denoiser_denoise(AV1_COMP *cpi, MACROBLOCK *mb, int mi_row, int mi_col,
         cpi->ppi->rtc_ref.ref_idx[3], cpi->ppi->use_svc,
         cpi->svc.spatial_layer_id, use_gf_temporal_ref);
 
-  if (decision == FILTER_BLOCK) {
-    decision = av1_denoiser_filter(src.buf, src.stride, mc_avg_start,
-                                   mc_avg.y_stride, avg_start, avg.y_stride,
-                                   increase_denoising, bs, motion_magnitude);
-  }
+#if CONFIG_AV1_HIGHBITDEPTH
+  if (cpi->common.seq_params->use_highbitdepth) {
+    uint16_t *const src16 = CONVERT_TO_SHORTPTR(src.buf);
+    uint16_t *const avg16 = CONVERT_TO_SHORTPTR(avg_start);
+    if (decision == FILTER_BLOCK) {
+      decision = av1_highbd_denoiser_filter(
+          src16, src.stride, CONVERT_TO_SHORTPTR(mc_avg_start), mc_avg.y_stride,
+          avg16, avg.y_stride, increase_denoising, bs, motion_magnitude,
+          cpi->common.seq_params->bit_depth);
+    }
 
-  if (decision == FILTER_BLOCK) {
-    aom_convolve_copy(avg_start, avg.y_stride, src.buf, src.stride,
-                      block_size_wide[bs], block_size_high[bs]);
-  } else {  // COPY_BLOCK
-    aom_convolve_copy(src.buf, src.stride, avg_start, avg.y_stride,
-                      block_size_wide[bs], block_size_high[bs]);
+    if (decision == FILTER_BLOCK) {
+      aom_highbd_convolve_copy(avg16, avg.y_stride, src16, src.stride,
+                               block_size_wide[bs], block_size_high[bs]);
+    } else {  // COPY_BLOCK
+      aom_highbd_convolve_copy(src16, src.stride, avg16, avg.y_stride,
+                               block_size_wide[bs], block_size_high[bs]);
+    }
+  } else {
+#endif  // CONFIG_AV1_HIGHBITDEPTH
+    if (decision == FILTER_BLOCK) {
+      decision = av1_denoiser_filter(src.buf, src.stride, mc_avg_start,
+                                     mc_avg.y_stride, avg_start, avg.y_stride,
+                                     increase_denoising, bs, motion_magnitude);
+    }
+
+    if (decision == FILTER_BLOCK) {
+      aom_convolve_copy(avg_start, avg.y_stride, src.buf, src.stride,
+                        block_size_wide[bs], block_size_high[bs]);
+    } else {  // COPY_BLOCK
+      aom_convolve_copy(src.buf, src.stride, avg_start, avg.y_stride,
+                        block_size_wide[bs], block_size_high[bs]);
+    }
+#if CONFIG_AV1_HIGHBITDEPTH
   }
+#endif  // CONFIG_AV1_HIGHBITDEPTH
   *denoiser_decision = decision;
   if (decision == FILTER_BLOCK && zeromv_filter == 1)
     *denoiser_decision = FILTER_ZEROMV_BLOCK;
@@ -379,6 +507,19 @@ static void copy_frame(YV12_BUFFER_CONFIG *const dest,
   assert(dest->y_width == src->y_width);
   assert(dest->y_height == src->y_height);
 
+#if CONFIG_AV1_HIGHBITDEPTH
+  if (dest->flags & YV12_FLAG_HIGHBITDEPTH) {
+    const uint16_t *srcbuf16 = CONVERT_TO_SHORTPTR(src->y_buffer);
+    uint16_t *destbuf16 = CONVERT_TO_SHORTPTR(dest->y_buffer);
+    for (r = 0; r < dest->y_height; ++r) {
+      memcpy(destbuf16, srcbuf16, dest->y_width * sizeof(*destbuf16));
+      destbuf16 += dest->y_stride;
+      srcbuf16 += src->y_stride;
+    }
+    return;
+  }
+#endif  // CONFIG_AV1_HIGHBITDEPTH
+
   for (r = 0; r < dest->y_height; ++r) {
     memcpy(destbuf, srcbuf, dest->y_width);
     destbuf += dest->y_stride;
@@ -352,6 +352,27 @@ typedef struct {
   uint8_t *left_pred;
 } OBMCBuffer;
 
+/*! \brief Number of luma blocks in a 128x128 superblock, over all the block
+ * sizes that allow palette: 8x8, 8x16, 16x8, 16x16, 16x32, 32x16, 32x32, 32x64,
+ * 64x32, 64x64, 4x16, 16x4, 8x32, 32x8, 16x64 and 64x16.
+ */
+#define PALETTE_COLOR_INFO_CACHE_SIZE                                       (256 + 128 + 128 + 64 + 32 + 32 + 16 + 8 + 8 + 4 + 256 + 256 + 64 + 64 +    16 + 16)
+
+/*! \brief Color statistics of a luma block used by the palette search.
+ */
+typedef struct {
+  //! Number of colors in the block.
+  int16_t num_colors;
+  /*! Number of colors after down-converting to 8 bits, which gates the
+   * palette search. Equal to num_colors in low bitdepth. */
+  int16_t num_color_bins;
+  /*! Whether counting ran to the end of the block. If not, num_color_bins is
+   * only a lower bound that exceeds the threshold used for counting. */
+  bool complete;
+  //! The most frequent colors, valid if complete and num_color_bins > 1.
+  int16_t top_colors[PALETTE_MAX_SIZE];
+} PaletteColorInfo;
+
 /*! \brief Contains color maps used in palette mode.
  */
 typedef struct {
@@ -359,6 +380,10 @@ typedef struct {
   uint8_t best_palette_color_map[MAX_PALETTE_SQUARE];
   //! A temporary buffer used for k-means clustering.
   int16_t kmeans_data_buf[2 * MAX_PALETTE_SQUARE];
+  //! Color statistics of the luma blocks searched in the current superblock.
+  PaletteColorInfo color_info[PALETTE_COLOR_INFO_CACHE_SIZE];
+  //! Whether each entry of color_info is valid.
+  uint8_t color_info_valid[PALETTE_COLOR_INFO_CACHE_SIZE];
 } PALETTE_BUFFER;
 
 /*! \brief Contains buffers used by av1_compound_type_rd()
@@ -646,11 +646,10 @@ void av1_cnn_convolve_no_maxpool_padding_valid_c(
   }
 }
 
-static void av1_cnn_convolve(const float **input, int in_width, int in_height,
-                             int in_stride,
-                             const CNN_LAYER_CONFIG *layer_config,
-                             float **output, int out_stride, int start_idx,
-                             int step) {
+void av1_cnn_convolve_c(const float **input, int in_width, int in_height,
+                        int in_stride, const CNN_LAYER_CONFIG *layer_config,
+                        float **output, int out_stride, int start_idx,
+                        int step) {
   assert(!layer_config->deconvolve);
   const int cstep = layer_config->in_channels * layer_config->out_channels;
   const int filter_height_half = layer_config->filter_height >> 1;
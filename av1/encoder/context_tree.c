@@ -43,11 +43,14 @@ void av1_setup_shared_coeff_buffer(const SequenceHeader *const seq_params,
     const int max_num_pix =
         (i == AOM_PLANE_Y) ? max_sb_square_y : max_sb_square_uv;
     AOM_CHECK_MEM_ERROR(error, shared_bufs->coeff_buf[i],
-                        aom_memalign(32, max_num_pix * sizeof(tran_low_t)));
+                        aom_memalign_tagged(AOM_MEM_TAG_THREAD_DATA, 32,
+                                            max_num_pix * sizeof(tran_low_t)));
     AOM_CHECK_MEM_ERROR(error, shared_bufs->qcoeff_buf[i],
-                        aom_memalign(32, max_num_pix * sizeof(tran_low_t)));
+                        aom_memalign_tagged(AOM_MEM_TAG_THREAD_DATA, 32,
+                                            max_num_pix * sizeof(tran_low_t)));
     AOM_CHECK_MEM_ERROR(error, shared_bufs->dqcoeff_buf[i],
-                        aom_memalign(32, max_num_pix * sizeof(tran_low_t)));
+                        aom_memalign_tagged(AOM_MEM_TAG_THREAD_DATA, 32,
+                                            max_num_pix * sizeof(tran_low_t)));
   }
 }
 
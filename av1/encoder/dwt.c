@@ -12,6 +12,7 @@
 #include <assert.h>
 #include <stdlib.h>
 #include <math.h>
+#include <string.h>
 
 #include "config/av1_rtcd.h"
 #include "av1/encoder/dwt.h"
@@ -69,12 +70,34 @@ static void analysis_53_col(int length, tran_low_t *x, tran_low_t *lowpass,
   }
 }
 
+void av1_dwt53_analyze(int levels, int width, int height, tran_low_t *c,
+                       int pitch_c) {
+  int lv, i, j, nh, nw, hh = height, hw = width;
+  tran_low_t buffer[2 * DWT_MAX_LENGTH];
+
+  for (lv = 0; lv < levels; lv++) {
+    nh = hh;
+    hh = (hh + 1) >> 1;
+    nw = hw;
+    hw = (hw + 1) >> 1;
+    if ((nh < 2) || (nw < 2)) return;
+    for (i = 0; i < nh; i++) {
+      memcpy(buffer, &c[i * pitch_c], nw * sizeof(tran_low_t));
+      analysis_53_row(nw, buffer, &c[i * pitch_c], &c[i * pitch_c] + hw);
+    }
+    for (j = 0; j < nw; j++) {
+      for (i = 0; i < nh; i++) buffer[i + nh] = c[i * pitch_c + j];
+      analysis_53_col(nh, buffer + nh, buffer, buffer + hh);
+      for (i = 0; i < nh; i++) c[i * pitch_c + j] = buffer[i];
+    }
+  }
+}
+
 static void dyadic_analyze_53_uint8_input(int levels, int width, int height,
                                           const uint8_t *x, int pitch_x,
                                           tran_low_t *c, int pitch_c,
                                           int dwt_scale_bits, int hbd) {
-  int lv, i, j, nh, nw, hh = height, hw = width;
-  tran_low_t buffer[2 * DWT_MAX_LENGTH];
+  int i, j;
 
   if (hbd) {
     const uint16_t *x16 = CONVERT_TO_SHORTPTR(x);
@@ -91,22 +114,7 @@ static void dyadic_analyze_53_uint8_input(int levels, int width, int height,
     }
   }
 
-  for (lv = 0; lv < levels; lv++) {
-    nh = hh;
-    hh = (hh + 1) >> 1;
-    nw = hw;
-    hw = (hw + 1) >> 1;
-    if ((nh < 2) || (nw < 2)) return;
-    for (i = 0; i < nh; i++) {
-      memcpy(buffer, &c[i * pitch_c], nw * sizeof(tran_low_t));
-      analysis_53_row(nw, buffer, &c[i * pitch_c], &c[i * pitch_c] + hw);
-    }
-    for (j = 0; j < nw; j++) {
-      for (i = 0; i < nh; i++) buffer[i + nh] = c[i * pitch_c + j];
-      analysis_53_col(nh, buffer + nh, buffer, buffer + hh);
-      for (i = 0; i < nh; i++) c[i * pitch_c + j] = buffer[i];
-    }
-  }
+  av1_dwt53_analyze(levels, width, height, c, pitch_c);
 }
 
 void av1_fdwt8x8_uint8_input_c(const uint8_t *input, tran_low_t *output,
@@ -124,8 +132,8 @@ static int haar_ac_sad(const tran_low_t *output, int bw, int bh, int stride) {
   return acsad;
 }
 
-static int haar_ac_sad_8x8_uint8_input(const uint8_t *input, int stride,
-                                       int hbd) {
+int av1_haar_ac_sad_8x8_uint8_input_c(const uint8_t *input, int stride,
+                                      int hbd) {
   tran_low_t output[64];
 
   av1_fdwt8x8_uint8_input(input, output, stride, hbd);
@@ -138,7 +146,7 @@ int64_t av1_haar_ac_sad_mxn_uint8_input(const uint8_t *input, int stride,
   int64_t wavelet_energy = 0;
   for (int r8 = 0; r8 < num_8x8_rows; ++r8) {
     for (int c8 = 0; c8 < num_8x8_cols; ++c8) {
-      wavelet_energy += haar_ac_sad_8x8_uint8_input(
+      wavelet_energy += av1_haar_ac_sad_8x8_uint8_input(
           input + c8 * 8 + r8 * 8 * stride, stride, hbd);
     }
   }
@@ -17,6 +17,11 @@
 
 #define DWT_MAX_LENGTH 64
 
+// Applies levels of the 5/3 wavelet analysis in place to the top-left
+// width x height corner of c.
+void av1_dwt53_analyze(int levels, int width, int height, tran_low_t *c,
+                       int pitch_c);
+
 int64_t av1_haar_ac_sad_mxn_uint8_input(const uint8_t *input, int stride,
                                         int hbd, int num_8x8_rows,
                                         int num_8x8_cols);
@@ -951,13 +951,15 @@ void av1_change_config(struct AV1_COMP *cpi, const AV1EncoderConfig *oxcf,
 
   if (x->palette_buffer == NULL) {
     CHECK_MEM_ERROR(cm, x->palette_buffer,
-                    aom_memalign(16, sizeof(*x->palette_buffer)));
+                    aom_memalign_tagged(AOM_MEM_TAG_THREAD_DATA, 16,
+                                        sizeof(*x->palette_buffer)));
   }
 
   if (x->tmp_conv_dst == NULL) {
-    CHECK_MEM_ERROR(
-        cm, x->tmp_conv_dst,
-        aom_memalign(32, MAX_SB_SIZE * MAX_SB_SIZE * sizeof(*x->tmp_conv_dst)));
+    CHECK_MEM_ERROR(cm, x->tmp_conv_dst,
+                    aom_memalign_tagged(
+                        AOM_MEM_TAG_THREAD_DATA, 32,
+                        MAX_SB_SIZE * MAX_SB_SIZE * sizeof(*x->tmp_conv_dst)));
     x->e_mbd.tmp_conv_dst = x->tmp_conv_dst;
   }
   // The buffers 'tmp_pred_bufs[]' and 'comp_rd_buffer' are used in inter frames
@@ -971,8 +973,9 @@ void av1_change_config(struct AV1_COMP *cpi, const AV1EncoderConfig *oxcf,
     for (int i = 0; i < 2; ++i) {
       if (x->tmp_pred_bufs[i] == NULL) {
         CHECK_MEM_ERROR(cm, x->tmp_pred_bufs[i],
-                        aom_memalign(32, 2 * MAX_MB_PLANE * MAX_SB_SQUARE *
-                                             sizeof(*x->tmp_pred_bufs[i])));
+                        aom_memalign_tagged(AOM_MEM_TAG_THREAD_DATA, 32,
+                                            2 * MAX_MB_PLANE * MAX_SB_SQUARE *
+                                                sizeof(*x->tmp_pred_bufs[i])));
         x->e_mbd.tmp_obmc_bufs[i] = x->tmp_pred_bufs[i];
       }
     }
@@ -981,8 +984,10 @@ void av1_change_config(struct AV1_COMP *cpi, const AV1EncoderConfig *oxcf,
   if (x->upsample_pred == NULL) {
     CHECK_MEM_ERROR(
         cm, x->upsample_pred,
-        aom_memalign(16, (1 + is_highbitdepth) * ((MAX_SB_SIZE + 16) + 16) *
-                             MAX_SB_SIZE * sizeof(*x->upsample_pred)));
+        aom_memalign_tagged(AOM_MEM_TAG_THREAD_DATA, 16,
+                            (1 + is_highbitdepth) *
+                                ((MAX_SB_SIZE + 16) + 16) * MAX_SB_SIZE *
+                                sizeof(*x->upsample_pred)));
     x->e_mbd.tmp_upsample_pred = x->upsample_pred;
   }
 
@@ -2069,11 +2074,12 @@ static void estimate_screen_content(AV1_COMP *cpi, FeatureFlags *features) {
       int n_colors;
       if (use_hbd) {
         av1_count_colors_highbd(this_src, stride, /*rows=*/kBlockHeight,
-                                /*cols=*/kBlockWidth, bd, NULL, count_buf,
-                                &n_colors, NULL);
+                                /*cols=*/kBlockWidth, bd, kColorThresh, NULL,
+                                count_buf, &n_colors, NULL);
       } else {
         av1_count_colors(this_src, stride, /*rows=*/kBlockHeight,
-                         /*cols=*/kBlockWidth, count_buf, &n_colors);
+                         /*cols=*/kBlockWidth, kColorThresh, count_buf,
+                         &n_colors);
       }
       if (n_colors > 1 && n_colors <= kColorThresh) {
         ++counts_1;
@@ -4677,7 +4683,7 @@ static int apply_denoise_2d(AV1_COMP *cpi, const YV12_BUFFER_CONFIG *sd,
 
 int av1_receive_raw_frame(AV1_COMP *cpi, aom_enc_frame_flags_t frame_flags,
                           const YV12_BUFFER_CONFIG *sd, int64_t time_stamp,
-                          int64_t end_time) {
+                          int64_t end_time, const void *input_ref) {
   AV1_COMMON *const cm = &cpi->common;
   const SequenceHeader *const seq_params = cm->seq_params;
   int res = 0;
@@ -4696,12 +4702,14 @@ int av1_receive_raw_frame(AV1_COMP *cpi, aom_enc_frame_flags_t frame_flags,
       (subsampling_x != 1 || subsampling_y != 1)) {
     aom_set_error(cm->error, AOM_CODEC_INVALID_PARAM,
                   "Non-4:2:0 color format requires profile 1 or 2");
+    av1_lookahead_release_input(cpi->ppi->lookahead, input_ref);
     return -1;
   }
   if ((seq_params->profile == PROFILE_1) &&
       !(subsampling_x == 0 && subsampling_y == 0)) {
     aom_set_error(cm->error, AOM_CODEC_INVALID_PARAM,
                   "Profile 1 requires 4:4:4 color format");
+    av1_lookahead_release_input(cpi->ppi->lookahead, input_ref);
     return -1;
   }
   if ((seq_params->profile == PROFILE_2) &&
@@ -4709,6 +4717,7 @@ int av1_receive_raw_frame(AV1_COMP *cpi, aom_enc_frame_flags_t frame_flags,
       !(subsampling_x == 1 && subsampling_y == 0)) {
     aom_set_error(cm->error, AOM_CODEC_INVALID_PARAM,
                   "Profile 2 bit-depth <= 10 requires 4:2:2 color format");
+    av1_lookahead_release_input(cpi->ppi->lookahead, input_ref);
     return -1;
   }
 
@@ -4765,7 +4774,8 @@ int av1_receive_raw_frame(AV1_COMP *cpi, aom_enc_frame_flags_t frame_flags,
 #endif  //  CONFIG_DENOISE
 
   if (av1_lookahead_push(cpi->ppi->lookahead, sd, time_stamp, end_time,
-                         use_highbitdepth, cpi->alloc_pyramid, frame_flags)) {
+                         use_highbitdepth, cpi->alloc_pyramid, frame_flags,
+                         input_ref)) {
     aom_set_error(cm->error, AOM_CODEC_ERROR, "av1_lookahead_push() failed");
     res = -1;
   }
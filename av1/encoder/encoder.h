@@ -886,6 +886,12 @@ typedef struct {
    * Controls screen content detection mode
    */
   aom_screen_detection_mode screen_detection_mode;
+
+  /*!
+   * Indicates if TPL statistics are kept per 32x32 instead of 16x16 block, to
+   * fit a memory budget.
+   */
+  bool coarse_tpl_stats;
 } AlgoCfg;
 /*!\cond */
 
@@ -3856,15 +3862,17 @@ int av1_init_parallel_frame_context(const AV1_COMP_DATA *const first_cpi_data,
  * \param[in,out] sd             Contain raw frame data
  * \param[in]     time_stamp     Time stamp of the frame
  * \param[in]     end_time_stamp End time stamp
+ * \param[in]     input_ref      If not NULL, the frame data may be used in
+ *                               place; see av1_lookahead_push()
  *
  * \return Returns a value to indicate if the frame data is received
  * successfully.
- * \note The caller can assume that a copy of this frame is made and not just a
- * copy of the pointer.
+ * \note Unless input_ref is not NULL, the caller can assume that a copy of
+ * this frame is made and not just a copy of the pointer.
  */
 int av1_receive_raw_frame(AV1_COMP *cpi, aom_enc_frame_flags_t frame_flags,
                           const YV12_BUFFER_CONFIG *sd, int64_t time_stamp,
-                          int64_t end_time_stamp);
+                          int64_t end_time_stamp, const void *input_ref);
 
 /*!\brief Encode a frame
  *
@@ -127,18 +127,24 @@ static inline void alloc_obmc_buffers(OBMCBuffer *obmc_buffer,
                                       struct aom_internal_error_info *error) {
   AOM_CHECK_MEM_ERROR(
       error, obmc_buffer->wsrc,
-      (int32_t *)aom_memalign(16, MAX_SB_SQUARE * sizeof(*obmc_buffer->wsrc)));
+      (int32_t *)aom_memalign_tagged(
+          AOM_MEM_TAG_THREAD_DATA, 16,
+          MAX_SB_SQUARE * sizeof(*obmc_buffer->wsrc)));
   AOM_CHECK_MEM_ERROR(
       error, obmc_buffer->mask,
-      (int32_t *)aom_memalign(16, MAX_SB_SQUARE * sizeof(*obmc_buffer->mask)));
+      (int32_t *)aom_memalign_tagged(
+          AOM_MEM_TAG_THREAD_DATA, 16,
+          MAX_SB_SQUARE * sizeof(*obmc_buffer->mask)));
   AOM_CHECK_MEM_ERROR(
       error, obmc_buffer->above_pred,
-      (uint8_t *)aom_memalign(
-          16, MAX_MB_PLANE * MAX_SB_SQUARE * sizeof(*obmc_buffer->above_pred)));
+      (uint8_t *)aom_memalign_tagged(
+          AOM_MEM_TAG_THREAD_DATA, 16,
+          MAX_MB_PLANE * MAX_SB_SQUARE * sizeof(*obmc_buffer->above_pred)));
   AOM_CHECK_MEM_ERROR(
       error, obmc_buffer->left_pred,
-      (uint8_t *)aom_memalign(
-          16, MAX_MB_PLANE * MAX_SB_SQUARE * sizeof(*obmc_buffer->left_pred)));
+      (uint8_t *)aom_memalign_tagged(
+          AOM_MEM_TAG_THREAD_DATA, 16,
+          MAX_MB_PLANE * MAX_SB_SQUARE * sizeof(*obmc_buffer->left_pred)));
 }
 
 static inline void release_obmc_buffers(OBMCBuffer *obmc_buffer) {
@@ -157,19 +163,25 @@ static inline void alloc_compound_type_rd_buffers(
     struct aom_internal_error_info *error, CompoundTypeRdBuffers *const bufs) {
   AOM_CHECK_MEM_ERROR(
       error, bufs->pred0,
-      (uint8_t *)aom_memalign(16, 2 * MAX_SB_SQUARE * sizeof(*bufs->pred0)));
+      (uint8_t *)aom_memalign_tagged(AOM_MEM_TAG_THREAD_DATA, 16,
+                                     2 * MAX_SB_SQUARE * sizeof(*bufs->pred0)));
   AOM_CHECK_MEM_ERROR(
       error, bufs->pred1,
-      (uint8_t *)aom_memalign(16, 2 * MAX_SB_SQUARE * sizeof(*bufs->pred1)));
+      (uint8_t *)aom_memalign_tagged(AOM_MEM_TAG_THREAD_DATA, 16,
+                                     2 * MAX_SB_SQUARE * sizeof(*bufs->pred1)));
   AOM_CHECK_MEM_ERROR(
       error, bufs->residual1,
-      (int16_t *)aom_memalign(32, MAX_SB_SQUARE * sizeof(*bufs->residual1)));
+      (int16_t *)aom_memalign_tagged(AOM_MEM_TAG_THREAD_DATA, 32,
+                                     MAX_SB_SQUARE * sizeof(*bufs->residual1)));
   AOM_CHECK_MEM_ERROR(
       error, bufs->diff10,
-      (int16_t *)aom_memalign(32, MAX_SB_SQUARE * sizeof(*bufs->diff10)));
-  AOM_CHECK_MEM_ERROR(error, bufs->tmp_best_mask_buf,
-                      (uint8_t *)aom_malloc(2 * MAX_SB_SQUARE *
-                                            sizeof(*bufs->tmp_best_mask_buf)));
+      (int16_t *)aom_memalign_tagged(AOM_MEM_TAG_THREAD_DATA, 32,
+                                     MAX_SB_SQUARE * sizeof(*bufs->diff10)));
+  AOM_CHECK_MEM_ERROR(
+      error, bufs->tmp_best_mask_buf,
+      (uint8_t *)aom_malloc_tagged(
+          AOM_MEM_TAG_THREAD_DATA,
+          2 * MAX_SB_SQUARE * sizeof(*bufs->tmp_best_mask_buf)));
 }
 
 static inline void release_compound_type_rd_buffers(
@@ -389,9 +401,10 @@ static inline void allocate_gradient_info_for_hog(AV1_COMP *cpi) {
   if (!pixel_gradient_info) {
     const AV1_COMMON *const cm = &cpi->common;
     const int plane_types = PLANE_TYPES >> cm->seq_params->monochrome;
-    CHECK_MEM_ERROR(
-        cm, pixel_gradient_info,
-        aom_malloc(sizeof(*pixel_gradient_info) * plane_types * MAX_SB_SQUARE));
+    CHECK_MEM_ERROR(cm, pixel_gradient_info,
+                    aom_malloc_tagged(AOM_MEM_TAG_THREAD_DATA,
+                                      sizeof(*pixel_gradient_info) *
+                                          plane_types * MAX_SB_SQUARE));
     cpi->td.pixel_gradient_info = pixel_gradient_info;
   }
 
@@ -407,8 +420,10 @@ static inline void allocate_src_var_of_4x4_sub_block_buf(AV1_COMP *cpi) {
     const AV1_COMMON *const cm = &cpi->common;
     const BLOCK_SIZE sb_size = cm->seq_params->sb_size;
     const int mi_count_in_sb = mi_size_wide[sb_size] * mi_size_high[sb_size];
-    CHECK_MEM_ERROR(cm, source_variance_info,
-                    aom_malloc(sizeof(*source_variance_info) * mi_count_in_sb));
+    CHECK_MEM_ERROR(
+        cm, source_variance_info,
+        aom_malloc_tagged(AOM_MEM_TAG_THREAD_DATA,
+                          sizeof(*source_variance_info) * mi_count_in_sb));
     cpi->td.src_var_info_of_4x4_sub_blocks = source_variance_info;
   }
 
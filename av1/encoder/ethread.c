@@ -974,16 +974,20 @@ void av1_init_tile_thread_data(AV1_PRIMARY *ppi, int is_first_pass) {
     if (i > 0) {
       // Allocate thread data.
       ThreadData *td;
-      AOM_CHECK_MEM_ERROR(&ppi->error, td, aom_memalign(32, sizeof(*td)));
+      AOM_CHECK_MEM_ERROR(
+          &ppi->error, td,
+          aom_memalign_tagged(AOM_MEM_TAG_THREAD_DATA, 32, sizeof(*td)));
       av1_zero(*td);
       thread_data->original_td = thread_data->td = td;
 
       // Set up shared coeff buffers.
       av1_setup_shared_coeff_buffer(&ppi->seq_params, &td->shared_coeff_buf,
                                     &ppi->error);
-      AOM_CHECK_MEM_ERROR(&ppi->error, td->tmp_conv_dst,
-                          aom_memalign(32, MAX_SB_SIZE * MAX_SB_SIZE *
-                                               sizeof(*td->tmp_conv_dst)));
+      AOM_CHECK_MEM_ERROR(
+          &ppi->error, td->tmp_conv_dst,
+          aom_memalign_tagged(
+              AOM_MEM_TAG_THREAD_DATA, 32,
+              MAX_SB_SIZE * MAX_SB_SIZE * sizeof(*td->tmp_conv_dst)));
 
       if (i < p_mt_info->num_mod_workers[MOD_FP]) {
         // Set up firstpass PICK_MODE_CONTEXT.
@@ -996,8 +1000,10 @@ void av1_init_tile_thread_data(AV1_PRIMARY *ppi, int is_first_pass) {
 
       AOM_CHECK_MEM_ERROR(
           &ppi->error, td->upsample_pred,
-          aom_memalign(16, (1 + is_highbitdepth) * ((MAX_SB_SIZE + 16) + 16) *
-                               MAX_SB_SIZE * sizeof(*td->upsample_pred)));
+          aom_memalign_tagged(AOM_MEM_TAG_THREAD_DATA, 16,
+                              (1 + is_highbitdepth) *
+                                  ((MAX_SB_SIZE + 16) + 16) * MAX_SB_SIZE *
+                                  sizeof(*td->upsample_pred)));
 
       if (!is_first_pass && i < num_enc_workers) {
         // Set up sms_tree.
@@ -1009,17 +1015,21 @@ void av1_init_tile_thread_data(AV1_PRIMARY *ppi, int is_first_pass) {
         for (int x = 0; x < 2; x++) {
           AOM_CHECK_MEM_ERROR(
               &ppi->error, td->hash_value_buffer[x],
-              (uint32_t *)aom_malloc(AOM_BUFFER_SIZE_FOR_BLOCK_HASH *
-                                     sizeof(*td->hash_value_buffer[x])));
+              (uint32_t *)aom_malloc_tagged(
+                  AOM_MEM_TAG_THREAD_DATA,
+                  AOM_BUFFER_SIZE_FOR_BLOCK_HASH *
+                      sizeof(*td->hash_value_buffer[x])));
         }
 
         // Allocate frame counters in thread data.
         AOM_CHECK_MEM_ERROR(&ppi->error, td->counts,
-                            aom_calloc(1, sizeof(*td->counts)));
+                            aom_calloc_tagged(AOM_MEM_TAG_THREAD_DATA, 1,
+                                              sizeof(*td->counts)));
 
         // Allocate buffers used by palette coding mode.
         AOM_CHECK_MEM_ERROR(&ppi->error, td->palette_buffer,
-                            aom_memalign(16, sizeof(*td->palette_buffer)));
+                            aom_memalign_tagged(AOM_MEM_TAG_THREAD_DATA, 16,
+                                                sizeof(*td->palette_buffer)));
 
         // The buffers 'tmp_pred_bufs[]', 'comp_rd_buffer' and 'obmc_buffer' are
         // used in inter frames to store intermediate inter mode prediction
@@ -1034,16 +1044,19 @@ void av1_init_tile_thread_data(AV1_PRIMARY *ppi, int is_first_pass) {
           for (int j = 0; j < 2; ++j) {
             AOM_CHECK_MEM_ERROR(
                 &ppi->error, td->tmp_pred_bufs[j],
-                aom_memalign(32, 2 * MAX_MB_PLANE * MAX_SB_SQUARE *
-                                     sizeof(*td->tmp_pred_bufs[j])));
+                aom_memalign_tagged(AOM_MEM_TAG_THREAD_DATA, 32,
+                                    2 * MAX_MB_PLANE * MAX_SB_SQUARE *
+                                        sizeof(*td->tmp_pred_bufs[j])));
           }
         }
 
         if (is_gradient_caching_for_hog_enabled(ppi->cpi)) {
           const int plane_types = PLANE_TYPES >> ppi->seq_params.monochrome;
           AOM_CHECK_MEM_ERROR(&ppi->error, td->pixel_gradient_info,
-                              aom_malloc(sizeof(*td->pixel_gradient_info) *
-                                         plane_types * MAX_SB_SQUARE));
+                              aom_malloc_tagged(
+                                  AOM_MEM_TAG_THREAD_DATA,
+                                  sizeof(*td->pixel_gradient_info) *
+                                      plane_types * MAX_SB_SQUARE));
         }
 
         if (is_src_var_for_4x4_sub_blocks_caching_enabled(ppi->cpi)) {
@@ -1053,8 +1066,10 @@ void av1_init_tile_thread_data(AV1_PRIMARY *ppi, int is_first_pass) {
 
           AOM_CHECK_MEM_ERROR(
               &ppi->error, td->src_var_info_of_4x4_sub_blocks,
-              aom_malloc(sizeof(*td->src_var_info_of_4x4_sub_blocks) *
-                         mi_count_in_sb));
+              aom_malloc_tagged(
+                  AOM_MEM_TAG_THREAD_DATA,
+                  sizeof(*td->src_var_info_of_4x4_sub_blocks) *
+                      mi_count_in_sb));
         }
 
         if (ppi->cpi->sf.part_sf.partition_search_type == VAR_BASED_PARTITION) {
@@ -19,6 +19,8 @@
 extern "C" {
 #endif
 
+// Copies src into dst and extends the borders of dst. src may be the same as
+// dst, which only extends the borders. Planar formats only in that case.
 void av1_copy_and_extend_frame(const YV12_BUFFER_CONFIG *src,
                                YV12_BUFFER_CONFIG *dst);
 
@@ -11,6 +11,8 @@
 
 #include <stdbool.h>
 
+#include "config/av1_rtcd.h"
+
 #include "av1/common/av1_common_int.h"
 #include "av1/common/cfl.h"
 #include "av1/common/reconintra.h"
@@ -317,28 +319,50 @@ static int rd_pick_filter_intra_sby(const AV1_COMP *const cpi, MACROBLOCK *x,
   }
 }
 
+int av1_count_colors_row_c(const uint8_t *src, int width, int *val_count) {
+  int n = 0;
+  for (int c = 0; c < width; ++c) {
+    if (val_count[src[c]]++ == 0) ++n;
+  }
+  return n;
+}
+
+int av1_count_colors_row_highbd_c(const uint16_t *src, int width,
+                                  int bit_depth, int *val_count,
+                                  int *bin_val_count) {
+  const int max_bin_val = 1 << 8;
+  int n = 0;
+  for (int c = 0; c < width; ++c) {
+    /*
+     * Down-convert the pixels to 8-bit domain before counting.
+     * This provides consistency of behavior for palette search
+     * between lbd and hbd encodes. This down-converted pixels
+     * are only used for calculating the threshold (n).
+     */
+    const int this_val = src[c] >> (bit_depth - 8);
+    assert(this_val < max_bin_val);
+    if (this_val >= max_bin_val) continue;
+    if (bin_val_count[this_val]++ == 0) ++n;
+    if (val_count != NULL) ++val_count[src[c]];
+  }
+  return n;
+}
+
 void av1_count_colors(const uint8_t *src, int stride, int rows, int cols,
-                      int *val_count, int *num_colors) {
+                      int max_colors, int *val_count, int *num_colors) {
   const int max_pix_val = 1 << 8;
   memset(val_count, 0, max_pix_val * sizeof(val_count[0]));
-  for (int r = 0; r < rows; ++r) {
-    for (int c = 0; c < cols; ++c) {
-      const int this_val = src[r * stride + c];
-      assert(this_val < max_pix_val);
-      ++val_count[this_val];
-    }
-  }
   int n = 0;
-  for (int i = 0; i < max_pix_val; ++i) {
-    if (val_count[i]) ++n;
+  for (int r = 0; r < rows && n <= max_colors; ++r) {
+    n += av1_count_colors_row(src + r * stride, cols, val_count);
   }
   *num_colors = n;
 }
 
 void av1_count_colors_highbd(const uint8_t *src8, int stride, int rows,
-                             int cols, int bit_depth, int *val_count,
-                             int *bin_val_count, int *num_color_bins,
-                             int *num_colors) {
+                             int cols, int bit_depth, int max_colors,
+                             int *val_count, int *bin_val_count,
+                             int *num_color_bins, int *num_colors) {
   assert(bit_depth <= 12);
   const int max_bin_val = 1 << 8;
   const int max_pix_val = 1 << bit_depth;
@@ -346,33 +370,21 @@ void av1_count_colors_highbd(const uint8_t *src8, int stride, int rows,
   memset(bin_val_count, 0, max_bin_val * sizeof(val_count[0]));
   if (val_count != NULL)
     memset(val_count, 0, max_pix_val * sizeof(val_count[0]));
-  for (int r = 0; r < rows; ++r) {
-    for (int c = 0; c < cols; ++c) {
-      /*
-       * Down-convert the pixels to 8-bit domain before counting.
-       * This provides consistency of behavior for palette search
-       * between lbd and hbd encodes. This down-converted pixels
-       * are only used for calculating the threshold (n).
-       */
-      const int this_val = ((src[r * stride + c]) >> (bit_depth - 8));
-      assert(this_val < max_bin_val);
-      if (this_val >= max_bin_val) continue;
-      ++bin_val_count[this_val];
-      if (val_count != NULL) ++val_count[(src[r * stride + c])];
-    }
-  }
   int n = 0;
   // Count the colors based on 8-bit domain used to gate the palette path
-  for (int i = 0; i < max_bin_val; ++i) {
-    if (bin_val_count[i]) ++n;
+  for (int r = 0; r < rows && n <= max_colors; ++r) {
+    n += av1_count_colors_row_highbd(src + r * stride, cols, bit_depth,
+                                     val_count, bin_val_count);
   }
   *num_color_bins = n;
 
   // Count the actual hbd colors used to create top_colors
-  n = 0;
   if (val_count != NULL) {
-    for (int i = 0; i < max_pix_val; ++i) {
-      if (val_count[i]) ++n;
+    if (n <= max_colors) {
+      n = 0;
+      for (int i = 0; i < max_pix_val; ++i) {
+        if (val_count[i]) ++n;
+      }
     }
     *num_colors = n;
   }
@@ -381,23 +393,10 @@ void av1_count_colors_highbd(const uint8_t *src8, int stride, int rows,
 bool av1_count_colors_with_threshold(const uint8_t *src, int stride, int rows,
                                      int cols, int num_colors_threshold,
                                      int *num_colors) {
-  bool has_color[1 << 8] = { false };
-  *num_colors = 0;
-
-  for (int r = 0; r < rows; ++r) {
-    for (int c = 0; c < cols; ++c) {
-      const int this_val = src[r * stride + c];
-      if (!has_color[this_val]) {
-        has_color[this_val] = true;
-        (*num_colors)++;
-        if (*num_colors > num_colors_threshold) {
-          // We're over the threshold, so we can exit early
-          return false;
-        }
-      }
-    }
-  }
-  return true;
+  int val_count[1 << 8];
+  av1_count_colors(src, stride, rows, cols, num_colors_threshold, val_count,
+                   num_colors);
+  return *num_colors <= num_colors_threshold;
 }
 
 void set_y_mode_and_delta_angle(const int mode_idx, MB_MODE_INFO *const mbmi,
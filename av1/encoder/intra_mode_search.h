@@ -275,16 +275,25 @@ int64_t av1_rd_pick_intra_sbuv_mode(const AV1_COMP *const cpi, MACROBLOCK *x,
                                     BLOCK_SIZE bsize, TX_SIZE max_tx_size);
 
 /*! \brief Return the number of colors in src. Used by palette mode.
+
+   Counting stops early once more than \a max_colors colors have been found.
+   \note If \a *num_colors is at most \a max_colors, it and the histogram in
+   \a val_count are exact. Otherwise the counts only cover the rows that were
+   read, and \a *num_colors is a lower bound on the number of colors.
  */
 void av1_count_colors(const uint8_t *src, int stride, int rows, int cols,
-                      int *val_count, int *num_colors);
+                      int max_colors, int *val_count, int *num_colors);
 
 /*! \brief See \ref av1_count_colors(), but for highbd.
+
+   \a max_colors applies to the number of 8-bit color bins in
+   \a *num_color_bins. When counting stops early, \a *num_colors is set to
+   the same lower bound.
  */
 void av1_count_colors_highbd(const uint8_t *src8, int stride, int rows,
-                             int cols, int bit_depth, int *val_count,
-                             int *val_count_8bit, int *num_color_bins,
-                             int *num_colors);
+                             int cols, int bit_depth, int max_colors,
+                             int *val_count, int *val_count_8bit,
+                             int *num_color_bins, int *num_colors);
 
 /*! \brief Set \a *num_colors to the number of colors in src.
 
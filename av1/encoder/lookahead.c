@@ -30,12 +30,74 @@ static struct lookahead_entry *pop(struct lookahead_ctx *ctx, int *idx) {
   return buf;
 }
 
+// Returns whether src can be used in place of the own buffers of img: it must
+// have the same format, size and strides, and a border large enough to extend
+// into. The strides must match because the encoder assumes that all source
+// frames share them, e.g. in the temporal filter.
+static bool can_wrap_input(const YV12_BUFFER_CONFIG *src,
+                           const YV12_BUFFER_CONFIG *img) {
+  const int use_highbitdepth = (src->flags & YV12_FLAG_HIGHBITDEPTH) != 0;
+  if (src->monochrome || src->v_buffer == NULL) return false;
+  if (use_highbitdepth != ((img->flags & YV12_FLAG_HIGHBITDEPTH) != 0) ||
+      src->subsampling_x != img->subsampling_x ||
+      src->subsampling_y != img->subsampling_y ||
+      src->y_crop_width != img->y_crop_width ||
+      src->y_crop_height != img->y_crop_height) {
+    return false;
+  }
+  // av1_copy_and_extend_frame() extends the right and bottom edges by the
+  // border of img, or up to the next multiple of 64 if that is further.
+  if (src->border < AOMMAX(img->border, 64)) return false;
+  if (src->y_stride != img->y_stride || src->uv_stride != img->uv_stride) {
+    return false;
+  }
+  for (int i = 0; i < 3; i++) {
+    const uintptr_t addr =
+        use_highbitdepth ? (uintptr_t)CONVERT_TO_SHORTPTR(src->buffers[i])
+                         : (uintptr_t)src->buffers[i];
+    if (addr & 15) return false;
+  }
+  return true;
+}
+
+// Points the entry at the planes of src, keeping its own buffers aside.
+static void wrap_input(struct lookahead_entry *buf,
+                       const YV12_BUFFER_CONFIG *src, const void *input_ref) {
+  YV12_BUFFER_CONFIG *img = &buf->img;
+  for (int i = 0; i < 3; i++) {
+    img->store_buf_adr[i] = img->buffers[i];
+    img->buffers[i] = src->buffers[i];
+  }
+  for (int i = 0; i < 2; i++) {
+    buf->store_strides[i] = img->strides[i];
+    img->strides[i] = src->strides[i];
+  }
+  img->use_external_reference_buffers = 1;
+  buf->input_ref = input_ref;
+}
+
+// Points the entry back at its own buffers and releases the caller buffer it
+// wrapped, if any.
+static void unwrap_input(struct lookahead_ctx *ctx,
+                         struct lookahead_entry *buf) {
+  YV12_BUFFER_CONFIG *img = &buf->img;
+  if (!buf->input_ref) return;
+  for (int i = 0; i < 3; i++) img->buffers[i] = img->store_buf_adr[i];
+  for (int i = 0; i < 2; i++) img->strides[i] = buf->store_strides[i];
+  img->use_external_reference_buffers = 0;
+  av1_lookahead_release_input(ctx, buf->input_ref);
+  buf->input_ref = NULL;
+}
+
 void av1_lookahead_destroy(struct lookahead_ctx *ctx) {
   if (ctx) {
     if (ctx->buf) {
       int i;
 
-      for (i = 0; i < ctx->max_sz; i++) aom_free_frame_buffer(&ctx->buf[i].img);
+      for (i = 0; i < ctx->max_sz; i++) {
+        unwrap_input(ctx, &ctx->buf[i]);
+        aom_free_frame_buffer(&ctx->buf[i].img);
+      }
       free(ctx->buf);
     }
     free(ctx);
@@ -83,6 +145,7 @@ struct lookahead_ctx *av1_lookahead_init(
               NULL, alloc_pyramid, 0)) {
         goto fail;
       }
+      aom_mem_set_tag(ctx->buf[i].img.buffer_alloc, AOM_MEM_TAG_LOOKAHEAD);
     }
   }
   return ctx;
@@ -91,6 +154,18 @@ fail:
   return NULL;
 }
 
+void av1_lookahead_set_release_fn(struct lookahead_ctx *ctx,
+                                  lookahead_release_fn_t release_fn,
+                                  void *release_priv) {
+  ctx->release_fn = release_fn;
+  ctx->release_priv = release_priv;
+}
+
+void av1_lookahead_release_input(struct lookahead_ctx *ctx,
+                                 const void *input_ref) {
+  if (input_ref) ctx->release_fn(ctx->release_priv, input_ref);
+}
+
 int av1_lookahead_full(const struct lookahead_ctx *ctx) {
   // TODO(angiebird): Test this function.
   return ctx->read_ctxs[ENCODE_STAGE].sz >= ctx->read_ctxs[ENCODE_STAGE].pop_sz;
@@ -98,7 +173,8 @@ int av1_lookahead_full(const struct lookahead_ctx *ctx) {
 
 int av1_lookahead_push(struct lookahead_ctx *ctx, const YV12_BUFFER_CONFIG *src,
                        int64_t ts_start, int64_t ts_end, int use_highbitdepth,
-                       bool alloc_pyramid, aom_enc_frame_flags_t flags) {
+                       bool alloc_pyramid, aom_enc_frame_flags_t flags,
+                       const void *input_ref) {
   int width = src->y_crop_width;
   int height = src->y_crop_height;
   int uv_width = src->uv_crop_width;
@@ -108,8 +184,11 @@ int av1_lookahead_push(struct lookahead_ctx *ctx, const YV12_BUFFER_CONFIG *src,
   int larger_dimensions, new_dimensions;
 
   assert(ctx->read_ctxs[ENCODE_STAGE].valid == 1);
-  if (ctx->read_ctxs[ENCODE_STAGE].sz + ctx->max_pre_frames > ctx->max_sz)
+  assert(input_ref == NULL || ctx->release_fn != NULL);
+  if (ctx->read_ctxs[ENCODE_STAGE].sz + ctx->max_pre_frames > ctx->max_sz) {
+    av1_lookahead_release_input(ctx, input_ref);
     return 1;
+  }
 
   ctx->read_ctxs[ENCODE_STAGE].sz++;
   if (ctx->read_ctxs[LAP_STAGE].valid) {
@@ -117,6 +196,12 @@ int av1_lookahead_push(struct lookahead_ctx *ctx, const YV12_BUFFER_CONFIG *src,
   }
 
   struct lookahead_entry *buf = pop(ctx, &ctx->write_idx);
+  unwrap_input(ctx, buf);
+
+  // Use the caller buffer in place when possible, which leaves only the
+  // borders to extend.
+  const bool wrapped = input_ref != NULL && can_wrap_input(src, &buf->img);
+  if (wrapped) wrap_input(buf, src, input_ref);
 
   new_dimensions = width != buf->img.y_crop_width ||
                    height != buf->img.y_crop_height ||
@@ -132,10 +217,13 @@ int av1_lookahead_push(struct lookahead_ctx *ctx, const YV12_BUFFER_CONFIG *src,
     memset(&new_img, 0, sizeof(new_img));
     if (aom_alloc_frame_buffer(&new_img, width, height, subsampling_x,
                                subsampling_y, use_highbitdepth,
-                               AOM_BORDER_IN_PIXELS, 0, alloc_pyramid, 0))
+                               AOM_BORDER_IN_PIXELS, 0, alloc_pyramid, 0)) {
+      av1_lookahead_release_input(ctx, input_ref);
       return 1;
+    }
     aom_free_frame_buffer(&buf->img);
     buf->img = new_img;
+    aom_mem_set_tag(buf->img.buffer_alloc, AOM_MEM_TAG_LOOKAHEAD);
   } else if (new_dimensions) {
     buf->img.y_width = src->y_width;
     buf->img.y_height = src->y_height;
@@ -148,7 +236,8 @@ int av1_lookahead_push(struct lookahead_ctx *ctx, const YV12_BUFFER_CONFIG *src,
     buf->img.subsampling_x = src->subsampling_x;
     buf->img.subsampling_y = src->subsampling_y;
   }
-  av1_copy_and_extend_frame(src, &buf->img);
+  av1_copy_and_extend_frame(wrapped ? &buf->img : src, &buf->img);
+  if (!wrapped) av1_lookahead_release_input(ctx, input_ref);
 
   buf->ts_start = ts_start;
   buf->ts_end = ts_end;
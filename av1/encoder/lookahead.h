@@ -36,8 +36,15 @@ struct lookahead_entry {
   int64_t ts_end;
   int display_idx;
   aom_enc_frame_flags_t flags;
+  // Set while img points into a caller buffer instead of its own allocation,
+  // whose buffer pointers are then kept in img.store_buf_adr.
+  const void *input_ref;
+  int store_strides[2];
 };
 
+// Returns a caller buffer that was pushed with av1_lookahead_push().
+typedef void (*lookahead_release_fn_t)(void *priv, const void *input_ref);
+
 // The max of past frames we want to keep in the queue.
 #define MAX_PRE_FRAMES 1
 
@@ -58,6 +65,8 @@ struct lookahead_ctx {
   int push_frame_count; /* Number of frames that have been pushed in the queue*/
   uint8_t
       max_pre_frames; /* Maximum number of past frames allowed in the queue */
+  lookahead_release_fn_t release_fn; /* Returns caller buffers */
+  void *release_priv;
 };
 /*!\endcond */
 
@@ -75,6 +84,18 @@ struct lookahead_ctx *av1_lookahead_init(
  */
 void av1_lookahead_destroy(struct lookahead_ctx *ctx);
 
+/**\brief Sets the callback that returns the caller buffers passed to
+ * av1_lookahead_push()
+ */
+void av1_lookahead_set_release_fn(struct lookahead_ctx *ctx,
+                                  lookahead_release_fn_t release_fn,
+                                  void *release_priv);
+
+/**\brief Releases a caller buffer that is not pushed after all
+ */
+void av1_lookahead_release_input(struct lookahead_ctx *ctx,
+                                 const void *input_ref);
+
 /**\brief Check if lookahead buffer is full
  */
 int av1_lookahead_full(const struct lookahead_ctx *ctx);
@@ -84,6 +105,12 @@ int av1_lookahead_full(const struct lookahead_ctx *ctx);
  * This function will copy the source image into a new framebuffer with
  * the expected stride/border.
  *
+ * If input_ref is not NULL, the source image belongs to the caller, who
+ * allows it to be used in place. When it is suitable, the queue then wraps
+ * the source image, extends its borders in place, and passes input_ref to
+ * the release callback only once the entry is reused or the queue destroyed.
+ * Otherwise the source image is copied and input_ref released right away.
+ *
  * \param[in] ctx               Pointer to the lookahead context
  * \param[in] src               Pointer to the image to enqueue
  * \param[in] ts_start          Timestamp for the start of this frame
@@ -92,10 +119,12 @@ int av1_lookahead_full(const struct lookahead_ctx *ctx);
  * \param[in] alloc_pyramid     Whether to allocate a downsampling pyramid
  *                              for each frame buffer
  * \param[in] flags             Flags set on this frame
+ * \param[in] input_ref         Caller buffer to release, or NULL
  */
 int av1_lookahead_push(struct lookahead_ctx *ctx, const YV12_BUFFER_CONFIG *src,
                        int64_t ts_start, int64_t ts_end, int use_highbitdepth,
-                       bool alloc_pyramid, aom_enc_frame_flags_t flags);
+                       bool alloc_pyramid, aom_enc_frame_flags_t flags,
+                       const void *input_ref);
 
 /**\brief Get the next source buffer to encode
  *
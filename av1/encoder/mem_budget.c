@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include "aom/aomcx.h"
+#include "aom_dsp/pyramid.h"
+#include "av1/encoder/block.h"
+#include "av1/encoder/hash.h"
+#include "av1/encoder/lookahead.h"
+#include "av1/encoder/mem_budget.h"
+#include "av1/encoder/tpl_model.h"
+
+// Reference frames, plus the current frame and the scratch frames the encoder
+// keeps for scaling, loop restoration search and the like.
+#define NUM_ENCODER_FRAME_BUFFERS (REF_FRAMES + 4)
+
+// Mirrors the plane layout of aom_realloc_frame_buffer().
+static size_t frame_buffer_size(int width, int height, int ss_x, int ss_y,
+                                int border, int use_highbitdepth) {
+  const size_t aligned_width = (width + 7) & ~7;
+  const size_t aligned_height = (height + 7) & ~7;
+  const size_t y_stride = ((aligned_width + 2 * border) + 31) & ~31;
+  const size_t y_size = (aligned_height + 2 * border) * y_stride;
+  const size_t uv_height = (aligned_height >> ss_y) + 2 * (border >> ss_y);
+  const size_t uv_size = uv_height * (y_stride >> ss_x);
+  return (y_size + 2 * uv_size) << use_highbitdepth;
+}
+
+// The scratch buffers av1_init_tile_thread_data() and friends allocate for
+// each worker.
+static size_t thread_data_size(int use_highbitdepth) {
+  size_t size = sizeof(ThreadData) + sizeof(FRAME_CONTEXT) + sizeof(MvCosts);
+  size += 3 * MAX_MB_PLANE * MAX_SB_SQUARE * sizeof(tran_low_t);
+  size += MAX_SB_SIZE * MAX_SB_SIZE * sizeof(CONV_BUF_TYPE);
+  size += (size_t)(1 + use_highbitdepth) * ((MAX_SB_SIZE + 16) + 16) *
+          MAX_SB_SIZE;
+  size += 2 * AOM_BUFFER_SIZE_FOR_BLOCK_HASH * sizeof(uint32_t);
+  size += sizeof(FRAME_COUNTS) + sizeof(PALETTE_BUFFER);
+  // obmc_buffer, comp_rd_buffer and tmp_pred_bufs[].
+  size += 2 * MAX_SB_SQUARE * sizeof(int32_t) +
+          2 * MAX_MB_PLANE * MAX_SB_SQUARE;
+  size += 10 * MAX_SB_SQUARE;
+  size += 2 * 2 * MAX_MB_PLANE * MAX_SB_SQUARE;
+  return size;
+}
+
+size_t av1_estimate_encoder_memory(const AV1EncoderConfig *oxcf,
+                                   int num_lap_buffers) {
+  const int width = oxcf->frm_dim_cfg.width;
+  const int height = oxcf->frm_dim_cfg.height;
+  // The chroma format is not known until the first frame arrives, so assume
+  // the largest one the profile allows.
+  const int ss = oxcf->profile == PROFILE_0;
+  const int hbd = oxcf->use_highbitdepth;
+  const size_t frame_size =
+      frame_buffer_size(width, height, ss, ss, AOM_BORDER_IN_PIXELS, hbd);
+  const size_t pyramid_size =
+      oxcf->tool_cfg.enable_global_motion
+          ? aom_get_pyramid_alloc_size(width, height, hbd)
+          : 0;
+
+  // With lookahead processing, the lookahead holds the LAP buffers and the
+  // lag of the encode stage is taken from them.
+  const int lag_in_frames = oxcf->gf_cfg.lag_in_frames;
+  const int lookahead_lag =
+      num_lap_buffers > 0 ? num_lap_buffers + 1 : AOMMAX(1, lag_in_frames);
+  const int lookahead_depth =
+      clamp(lookahead_lag, 1, MAX_TOTAL_BUFFERS) + MAX_PRE_FRAMES;
+  size_t size = lookahead_depth * (frame_size + pyramid_size);
+  // The current source frame gets a pyramid too.
+  size += NUM_ENCODER_FRAME_BUFFERS * frame_size + pyramid_size;
+
+  if (oxcf->algo_cfg.enable_tpl_model && lag_in_frames > 1) {
+    const int block_mis_log2 = oxcf->algo_cfg.coarse_tpl_stats ? 3 : 2;
+    const size_t mi_cols = ALIGN_POWER_OF_TWO(
+        ((width + 7) & ~7) >> MI_SIZE_LOG2, MAX_MIB_SIZE_LOG2);
+    const size_t mi_rows = ALIGN_POWER_OF_TWO(
+        ((height + 7) & ~7) >> MI_SIZE_LOG2, MAX_MIB_SIZE_LOG2);
+    const size_t num_blocks =
+        (mi_cols >> block_mis_log2) * (mi_rows >> block_mis_log2);
+    // Statistics and a reconstruction for each frame of the lag, plus the
+    // source of the previous ALTREF.
+    size += lag_in_frames * num_blocks * sizeof(TplDepStats);
+    size += (lag_in_frames + 1) * frame_buffer_size(width, height, ss, ss,
+                                                    /*border=*/64, hbd);
+  }
+
+  size += AOMMAX(1, oxcf->max_threads) * thread_data_size(hbd);
+  return size;
+}
+
+unsigned int av1_fit_memory_budget(AV1EncoderConfig *oxcf, int num_lap_buffers,
+                                   size_t budget, size_t *estimate) {
+  unsigned int degradations = 0;
+  // The cheapest degradations in coding efficiency come first.
+  *estimate = av1_estimate_encoder_memory(oxcf, num_lap_buffers);
+  if (*estimate > budget && oxcf->algo_cfg.enable_tpl_model &&
+      oxcf->gf_cfg.lag_in_frames > 1) {
+    oxcf->algo_cfg.coarse_tpl_stats = true;
+    degradations |= AOM_MEM_BUDGET_COARSE_TPL;
+    *estimate = av1_estimate_encoder_memory(oxcf, num_lap_buffers);
+  }
+  if (*estimate > budget && oxcf->tool_cfg.enable_global_motion) {
+    oxcf->tool_cfg.enable_global_motion = false;
+    degradations |= AOM_MEM_BUDGET_NO_GLOBAL_MOTION;
+    *estimate = av1_estimate_encoder_memory(oxcf, num_lap_buffers);
+  }
+  // Lookahead processing fixes the depth of the lookahead when the encoder
+  // is created.
+  while (*estimate > budget && num_lap_buffers == 0 &&
+         oxcf->gf_cfg.lag_in_frames > 0) {
+    --oxcf->gf_cfg.lag_in_frames;
+    degradations |= AOM_MEM_BUDGET_SHORT_LAG;
+    *estimate = av1_estimate_encoder_memory(oxcf, num_lap_buffers);
+  }
+  if (*estimate > budget) degradations |= AOM_MEM_BUDGET_EXCEEDED;
+  return degradations;
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#ifndef AOM_AV1_ENCODER_MEM_BUDGET_H_
+#define AOM_AV1_ENCODER_MEM_BUDGET_H_
+
+#include <stddef.h>
+
+#include "av1/encoder/encoder.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!\brief Estimates the memory the encoder needs for a configuration
+ *
+ * Covers the lookahead, image pyramids, TPL statistics, reference frames and
+ * the per thread scratch buffers, which dominate the memory use of large
+ * encodes. Frame buffers are sized for the largest border the encoder uses.
+ *
+ * \param[in]    oxcf              Encoder configuration
+ * \param[in]    num_lap_buffers   Number of lookahead processing buffers
+ *
+ * \return Estimated memory use in bytes.
+ */
+size_t av1_estimate_encoder_memory(const AV1EncoderConfig *oxcf,
+                                   int num_lap_buffers);
+
+/*!\brief Degrades the configuration until the encoder fits in a budget
+ *
+ * Tries, in order, keeping TPL statistics per 32x32 block, disabling global
+ * motion, which drops the image pyramids, and shortening the lag in frames.
+ * The lag is left alone when lookahead processing is in use.
+ *
+ * \param[in,out] oxcf              Encoder configuration
+ * \param[in]     num_lap_buffers   Number of lookahead processing buffers
+ * \param[in]     budget            Memory budget in bytes
+ * \param[out]    estimate          Estimated memory use of the result
+ *
+ * \return A combination of the AOM_MEM_BUDGET_* flags of aomcx.h.
+ */
+unsigned int av1_fit_memory_budget(AV1EncoderConfig *oxcf, int num_lap_buffers,
+                                   size_t budget, size_t *estimate);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // AOM_AV1_ENCODER_MEM_BUDGET_H_
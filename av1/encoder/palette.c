@@ -537,6 +537,78 @@ static void find_top_colors(const int *const count_buf, int bit_depth,
   }
 }
 
+// Returns the index in PALETTE_BUFFER::color_info of the luma block of size
+// bsize at (mi_row, mi_col). Blocks are aligned to their own size within the
+// superblock, so the index is unique for each block of the superblock.
+static int get_color_info_index(BLOCK_SIZE bsize, int mi_row, int mi_col) {
+  int index = 0;
+  for (BLOCK_SIZE b = BLOCK_8X8; b < bsize; ++b) {
+    if (av1_allow_palette(1, b)) {
+      index += (MAX_MIB_SIZE >> mi_size_wide_log2[b]) *
+               (MAX_MIB_SIZE >> mi_size_high_log2[b]);
+    }
+  }
+  const int row = (mi_row & (MAX_MIB_SIZE - 1)) >> mi_size_high_log2[bsize];
+  const int col = (mi_col & (MAX_MIB_SIZE - 1)) >> mi_size_wide_log2[bsize];
+  index += row * (MAX_MIB_SIZE >> mi_size_wide_log2[bsize]) + col;
+  assert(index < PALETTE_COLOR_INFO_CACHE_SIZE);
+  return index;
+}
+
+// Counts the colors of the luma source block and finds its dominant colors.
+// The palette search visits the same block several times within a superblock,
+// e.g. once for each partition type that contains it, so the results are
+// cached in x->palette_buffer until the next superblock.
+static void get_luma_color_info(const AV1_COMP *cpi, MACROBLOCK *x,
+                                BLOCK_SIZE bsize, int rows, int cols,
+                                int max_colors, PaletteColorInfo *info) {
+  const MACROBLOCKD *const xd = &x->e_mbd;
+  PALETTE_BUFFER *const palette_buffer = x->palette_buffer;
+  int use_cache = 1;
+#if CONFIG_AV1_TEMPORAL_DENOISING
+  // The denoiser writes filtered blocks back to the source buffer.
+  if (cpi->oxcf.noise_sensitivity > 0) use_cache = 0;
+#endif
+  const int index = get_color_info_index(bsize, xd->mi_row, xd->mi_col);
+  if (use_cache && palette_buffer->color_info_valid[index]) {
+    const PaletteColorInfo *const cached = &palette_buffer->color_info[index];
+    // An incomplete count is only a lower bound on the number of colors.
+    if (cached->complete || cached->num_color_bins > max_colors) {
+      *info = *cached;
+      return;
+    }
+  }
+
+  const int src_stride = x->plane[0].src.stride;
+  const uint8_t *const src = x->plane[0].src.buf;
+  const int bit_depth = cpi->common.seq_params->bit_depth;
+  int count_buf[1 << 12];  // Maximum (1 << 12) color levels.
+  int colors, colors_threshold;
+  if (cpi->common.seq_params->use_highbitdepth) {
+    int count_buf_8bit[1 << 8];  // Maximum (1 << 8) bins for hbd path.
+    av1_count_colors_highbd(src, src_stride, rows, cols, bit_depth, max_colors,
+                            count_buf, count_buf_8bit, &colors_threshold,
+                            &colors);
+  } else {
+    av1_count_colors(src, src_stride, rows, cols, max_colors, count_buf,
+                     &colors);
+    colors_threshold = colors;
+  }
+  info->num_colors = colors;
+  info->num_color_bins = colors_threshold;
+  info->complete = colors_threshold <= max_colors;
+  if (info->complete && colors_threshold > 1) {
+    // Find the dominant colors, stored in top_colors[].
+    av1_zero(info->top_colors);
+    find_top_colors(count_buf, bit_depth, AOMMIN(colors, PALETTE_MAX_SIZE),
+                    info->top_colors);
+  }
+  if (use_cache) {
+    palette_buffer->color_info[index] = *info;
+    palette_buffer->color_info_valid[index] = 1;
+  }
+}
+
 void av1_rd_pick_palette_intra_sby(
     const AV1_COMP *cpi, MACROBLOCK *x, BLOCK_SIZE bsize, int dc_mode_cost,
     MB_MODE_INFO *best_mbmi, uint8_t *best_palette_color_map, int64_t *best_rd,
@@ -557,21 +629,9 @@ void av1_rd_pick_palette_intra_sby(
                            &cols);
   const SequenceHeader *const seq_params = cpi->common.seq_params;
   const int is_hbd = seq_params->use_highbitdepth;
-  const int bit_depth = seq_params->bit_depth;
   const int discount_color_cost = cpi->sf.rt_sf.discount_color_cost;
   int unused;
 
-  int count_buf[1 << 12];  // Maximum (1 << 12) color levels.
-  int colors, colors_threshold = 0;
-  if (is_hbd) {
-    int count_buf_8bit[1 << 8];  // Maximum (1 << 8) bins for hbd path.
-    av1_count_colors_highbd(src, src_stride, rows, cols, bit_depth, count_buf,
-                            count_buf_8bit, &colors_threshold, &colors);
-  } else {
-    av1_count_colors(src, src_stride, rows, cols, count_buf, &colors);
-    colors_threshold = colors;
-  }
-
   uint8_t *const color_map = xd->plane[0].color_index_map;
   int color_thresh_palette = x->color_palette_thresh;
   // Allow for larger color_threshold for palette search, based on color,
@@ -590,6 +650,12 @@ void av1_rd_pick_palette_intra_sby(
     }
     if (norm_color_dist < 8000) color_thresh_palette += 20;
   }
+
+  PaletteColorInfo color_info;
+  get_luma_color_info(cpi, x, bsize, rows, cols, color_thresh_palette,
+                      &color_info);
+  const int colors = color_info.num_colors;
+  const int colors_threshold = color_info.num_color_bins;
   if (colors_threshold > 1 && colors_threshold <= color_thresh_palette) {
     int16_t *const data = x->palette_buffer->kmeans_data_buf;
     int16_t centroids[PALETTE_MAX_SIZE];
@@ -603,10 +669,7 @@ void av1_rd_pick_palette_intra_sby(
     uint16_t color_cache[2 * PALETTE_MAX_SIZE];
     const int n_cache = av1_get_palette_cache(xd, 0, color_cache);
 
-    // Find the dominant colors, stored in top_colors[].
-    int16_t top_colors[PALETTE_MAX_SIZE] = { 0 };
-    find_top_colors(count_buf, bit_depth, AOMMIN(colors, PALETTE_MAX_SIZE),
-                    top_colors);
+    int16_t *const top_colors = color_info.top_colors;
 
     // The following are the approaches used for header rdcost based gating
     // for early termination for different values of prune_palette_search_level.
@@ -793,15 +856,15 @@ void av1_rd_pick_palette_intra_sbuv(const AV1_COMP *cpi, MACROBLOCK *x,
     int count_buf[1 << 12];      // Maximum (1 << 12) color levels.
     int count_buf_8bit[1 << 8];  // Maximum (1 << 8) bins for hbd path.
     av1_count_colors_highbd(src_u, src_stride, rows, cols,
-                            seq_params->bit_depth, count_buf, count_buf_8bit,
-                            &colors_threshold_u, &colors_u);
+                            seq_params->bit_depth, 64, count_buf,
+                            count_buf_8bit, &colors_threshold_u, &colors_u);
     av1_count_colors_highbd(src_v, src_stride, rows, cols,
-                            seq_params->bit_depth, count_buf, count_buf_8bit,
-                            &colors_threshold_v, &colors_v);
+                            seq_params->bit_depth, 64, count_buf,
+                            count_buf_8bit, &colors_threshold_v, &colors_v);
   } else {
     int count_buf[1 << 8];
-    av1_count_colors(src_u, src_stride, rows, cols, count_buf, &colors_u);
-    av1_count_colors(src_v, src_stride, rows, cols, count_buf, &colors_v);
+    av1_count_colors(src_u, src_stride, rows, cols, 64, count_buf, &colors_u);
+    av1_count_colors(src_v, src_stride, rows, cols, 64, count_buf, &colors_v);
     colors_threshold_u = colors_u;
     colors_threshold_v = colors_v;
   }
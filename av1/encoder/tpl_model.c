@@ -139,12 +139,13 @@ static inline void get_quantize_error(const MACROBLOCK *x, int plane,
   *sse = AOMMAX(*sse, 1);
 }
 
-static inline void set_tpl_stats_block_size(uint8_t *block_mis_log2,
+static inline void set_tpl_stats_block_size(bool use_coarse_stats,
+                                            uint8_t *block_mis_log2,
                                             uint8_t *tpl_bsize_1d) {
-  // tpl stats bsize: 2 means 16x16
-  *block_mis_log2 = 2;
+  // tpl stats bsize: 2 means 16x16, 3 means 32x32
+  *block_mis_log2 = use_coarse_stats ? 3 : 2;
   // Block size used in tpl motion estimation
-  *tpl_bsize_1d = 16;
+  *tpl_bsize_1d = use_coarse_stats ? 32 : 16;
   // MIN_TPL_BSIZE_1D = 16;
   assert(*tpl_bsize_1d >= 16);
 }
@@ -154,7 +155,9 @@ void av1_setup_tpl_buffers(AV1_PRIMARY *const ppi,
                            int height, int byte_alignment, int lag_in_frames) {
   SequenceHeader *const seq_params = &ppi->seq_params;
   TplParams *const tpl_data = &ppi->tpl_data;
-  set_tpl_stats_block_size(&tpl_data->tpl_stats_block_mis_log2,
+  tpl_data->use_coarse_stats = ppi->cpi->oxcf.algo_cfg.coarse_tpl_stats;
+  set_tpl_stats_block_size(tpl_data->use_coarse_stats,
+                           &tpl_data->tpl_stats_block_mis_log2,
                            &tpl_data->tpl_bsize_1d);
   const uint8_t block_mis_log2 = tpl_data->tpl_stats_block_mis_log2;
   tpl_data->border_in_pixels =
@@ -181,16 +184,19 @@ void av1_setup_tpl_buffers(AV1_PRIMARY *const ppi,
   // allocations are avoided for buffers in tpl_data.
   if (lag_in_frames <= 1) return;
 
-  AOM_CHECK_MEM_ERROR(&ppi->error, tpl_data->txfm_stats_list,
-                      aom_calloc(MAX_LENGTH_TPL_FRAME_STATS,
-                                 sizeof(*tpl_data->txfm_stats_list)));
+  AOM_CHECK_MEM_ERROR(
+      &ppi->error, tpl_data->txfm_stats_list,
+      aom_calloc_tagged(AOM_MEM_TAG_TPL, MAX_LENGTH_TPL_FRAME_STATS,
+                        sizeof(*tpl_data->txfm_stats_list)));
 
   for (int frame = 0; frame < lag_in_frames; ++frame) {
     AOM_CHECK_MEM_ERROR(
         &ppi->error, tpl_data->tpl_stats_pool[frame],
-        aom_calloc(tpl_data->tpl_stats_buffer[frame].width *
-                       tpl_data->tpl_stats_buffer[frame].height,
-                   sizeof(*tpl_data->tpl_stats_buffer[frame].tpl_stats_ptr)));
+        aom_calloc_tagged(
+            AOM_MEM_TAG_TPL,
+            tpl_data->tpl_stats_buffer[frame].width *
+                tpl_data->tpl_stats_buffer[frame].height,
+            sizeof(*tpl_data->tpl_stats_buffer[frame].tpl_stats_ptr)));
 
     if (aom_alloc_frame_buffer(
             &tpl_data->tpl_rec_pool[frame], width, height,
@@ -199,6 +205,8 @@ void av1_setup_tpl_buffers(AV1_PRIMARY *const ppi,
             byte_alignment, false, alloc_y_plane_only))
       aom_internal_error(&ppi->error, AOM_CODEC_MEM_ERROR,
                          "Failed to allocate frame buffer");
+    aom_mem_set_tag(tpl_data->tpl_rec_pool[frame].buffer_alloc,
+                    AOM_MEM_TAG_TPL);
   }
 
   if (aom_alloc_frame_buffer(
@@ -208,6 +216,7 @@ void av1_setup_tpl_buffers(AV1_PRIMARY *const ppi,
           alloc_y_plane_only))
     aom_internal_error(&ppi->error, AOM_CODEC_MEM_ERROR,
                        "Failed to allocate prev gop arf buffer");
+  aom_mem_set_tag(tpl_data->prev_gop_arf_src.buffer_alloc, AOM_MEM_TAG_TPL);
 
   tpl_data->prev_gop_arf_disp_order = -1;
 }
@@ -1838,7 +1847,8 @@ static inline int init_gop_frames_for_tpl(
 
 void av1_init_tpl_stats(TplParams *const tpl_data) {
   tpl_data->ready = 0;
-  set_tpl_stats_block_size(&tpl_data->tpl_stats_block_mis_log2,
+  set_tpl_stats_block_size(tpl_data->use_coarse_stats,
+                           &tpl_data->tpl_stats_block_mis_log2,
                            &tpl_data->tpl_bsize_1d);
   for (int frame_idx = 0; frame_idx < MAX_LENGTH_TPL_FRAME_STATS; ++frame_idx) {
     TplDepFrame *tpl_frame = &tpl_data->tpl_stats_buffer[frame_idx];
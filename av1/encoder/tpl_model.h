@@ -181,6 +181,12 @@ typedef struct TplParams {
    */
   uint8_t tpl_bsize_1d;
 
+  /*!
+   * Whether tpl stats are kept per 32x32 instead of 16x16 block. Fixed when
+   * the tpl buffers are allocated.
+   */
+  bool use_coarse_stats;
+
   /*!
    * Buffer to store the frame level tpl information for each frame in a gf
    * group. tpl_stats_buffer[i] stores the tpl information of ith frame in a gf
@@ -452,16 +458,19 @@ static inline bool tpl_alloc_temp_buffers(TplBuffers *tpl_tmp_buffers,
   const int tpl_block_pels = tpl_bsize_1d * tpl_bsize_1d;
 
   // Allocate temporary buffers used in mode estimation.
-  tpl_tmp_buffers->predictor8 = (uint8_t *)aom_memalign(
-      32, tpl_block_pels * 2 * sizeof(*tpl_tmp_buffers->predictor8));
-  tpl_tmp_buffers->src_diff = (int16_t *)aom_memalign(
-      32, tpl_block_pels * sizeof(*tpl_tmp_buffers->src_diff));
-  tpl_tmp_buffers->coeff = (tran_low_t *)aom_memalign(
-      32, tpl_block_pels * sizeof(*tpl_tmp_buffers->coeff));
-  tpl_tmp_buffers->qcoeff = (tran_low_t *)aom_memalign(
-      32, tpl_block_pels * sizeof(*tpl_tmp_buffers->qcoeff));
-  tpl_tmp_buffers->dqcoeff = (tran_low_t *)aom_memalign(
-      32, tpl_block_pels * sizeof(*tpl_tmp_buffers->dqcoeff));
+  tpl_tmp_buffers->predictor8 = (uint8_t *)aom_memalign_tagged(
+      AOM_MEM_TAG_TPL, 32,
+      tpl_block_pels * 2 * sizeof(*tpl_tmp_buffers->predictor8));
+  tpl_tmp_buffers->src_diff = (int16_t *)aom_memalign_tagged(
+      AOM_MEM_TAG_TPL, 32,
+      tpl_block_pels * sizeof(*tpl_tmp_buffers->src_diff));
+  tpl_tmp_buffers->coeff = (tran_low_t *)aom_memalign_tagged(
+      AOM_MEM_TAG_TPL, 32, tpl_block_pels * sizeof(*tpl_tmp_buffers->coeff));
+  tpl_tmp_buffers->qcoeff = (tran_low_t *)aom_memalign_tagged(
+      AOM_MEM_TAG_TPL, 32, tpl_block_pels * sizeof(*tpl_tmp_buffers->qcoeff));
+  tpl_tmp_buffers->dqcoeff = (tran_low_t *)aom_memalign_tagged(
+      AOM_MEM_TAG_TPL, 32,
+      tpl_block_pels * sizeof(*tpl_tmp_buffers->dqcoeff));
 
   if (!(tpl_tmp_buffers->predictor8 && tpl_tmp_buffers->src_diff &&
         tpl_tmp_buffers->coeff && tpl_tmp_buffers->qcoeff &&
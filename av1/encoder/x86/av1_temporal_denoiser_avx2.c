@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <assert.h>
+#include <immintrin.h>  // AVX2
+
+#include "config/av1_rtcd.h"
+
+#include "aom/aom_integer.h"
+#include "aom_dsp/x86/synonyms_avx2.h"
+
+#include "av1/common/reconinter.h"
+#include "av1/encoder/context_tree.h"
+#include "av1/encoder/av1_temporal_denoiser.h"
+
+// Compute the sum of all pixel differences of this MB.
+static inline int sum_diff_32x1(__m256i acc_diff) {
+  const __m256i k_1 = _mm256_set1_epi16(1);
+  const __m256i acc_diff_lo =
+      _mm256_srai_epi16(_mm256_unpacklo_epi8(acc_diff, acc_diff), 8);
+  const __m256i acc_diff_hi =
+      _mm256_srai_epi16(_mm256_unpackhi_epi8(acc_diff, acc_diff), 8);
+  const __m256i acc_diff_16 = _mm256_add_epi16(acc_diff_lo, acc_diff_hi);
+  const __m256i sum_32 = _mm256_madd_epi16(acc_diff_16, k_1);
+  __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(sum_32),
+                              _mm256_extracti128_si256(sum_32, 1));
+  sum = _mm_add_epi32(sum, _mm_srli_si128(sum, 8));
+  sum = _mm_add_epi32(sum, _mm_srli_si128(sum, 4));
+  return _mm_cvtsi128_si32(sum);
+}
+
+// Denoise a 32x1 vector.
+static inline __m256i denoiser_32x1_avx2(
+    const uint8_t *sig, const uint8_t *mc_running_avg_y, uint8_t *running_avg_y,
+    const __m256i k_4, const __m256i k_8, const __m256i k_16, const __m256i l3,
+    const __m256i l32, const __m256i l21, __m256i acc_diff) {
+  // Calculate differences
+  const __m256i v_sig = yy_loadu_256(sig);
+  const __m256i v_mc_running_avg_y = yy_loadu_256(mc_running_avg_y);
+  const __m256i pdiff = _mm256_subs_epu8(v_mc_running_avg_y, v_sig);
+  const __m256i ndiff = _mm256_subs_epu8(v_sig, v_mc_running_avg_y);
+  // Obtain the sign. FF if diff is negative.
+  const __m256i diff_sign =
+      _mm256_cmpeq_epi8(pdiff, _mm256_setzero_si256());
+  // Clamp absolute difference to 16 to be used to get mask. Doing this
+  // allows us to use _mm256_cmpgt_epi8, which operates on signed byte.
+  const __m256i clamped_absdiff =
+      _mm256_min_epu8(_mm256_or_si256(pdiff, ndiff), k_16);
+  // Get masks for l2 l1 and l0 adjustments.
+  const __m256i mask2 = _mm256_cmpgt_epi8(k_16, clamped_absdiff);
+  const __m256i mask1 = _mm256_cmpgt_epi8(k_8, clamped_absdiff);
+  const __m256i mask0 = _mm256_cmpgt_epi8(k_4, clamped_absdiff);
+  // Get adjustments for l2, l1, and l0.
+  const __m256i adj2 = _mm256_and_si256(mask2, l32);
+  const __m256i adj1 = _mm256_and_si256(mask1, l21);
+  const __m256i adj0 = _mm256_and_si256(mask0, clamped_absdiff);
+
+  // Combine the adjustments and get absolute adjustments.
+  __m256i adj = _mm256_sub_epi8(l3, _mm256_add_epi8(adj2, adj1));
+  adj = _mm256_andnot_si256(mask0, adj);
+  adj = _mm256_or_si256(adj, adj0);
+
+  // Restore the sign and get positive and negative adjustments.
+  const __m256i padj = _mm256_andnot_si256(diff_sign, adj);
+  const __m256i nadj = _mm256_and_si256(diff_sign, adj);
+
+  // Calculate filtered value.
+  __m256i v_running_avg_y = _mm256_adds_epu8(v_sig, padj);
+  v_running_avg_y = _mm256_subs_epu8(v_running_avg_y, nadj);
+  yy_storeu_256(running_avg_y, v_running_avg_y);
+
+  // Adjustments <=7, and each element in acc_diff can fit in signed
+  // char.
+  acc_diff = _mm256_adds_epi8(acc_diff, padj);
+  acc_diff = _mm256_subs_epi8(acc_diff, nadj);
+  return acc_diff;
+}
+
+// Denoise a 32x1 vector with a weaker filter.
+static inline __m256i denoiser_adj_32x1_avx2(const uint8_t *sig,
+                                             const uint8_t *mc_running_avg_y,
+                                             uint8_t *running_avg_y,
+                                             const __m256i k_delta,
+                                             __m256i acc_diff) {
+  __m256i v_running_avg_y = yy_loadu_256(running_avg_y);
+  // Calculate differences.
+  const __m256i v_sig = yy_loadu_256(sig);
+  const __m256i v_mc_running_avg_y = yy_loadu_256(mc_running_avg_y);
+  const __m256i pdiff = _mm256_subs_epu8(v_mc_running_avg_y, v_sig);
+  const __m256i ndiff = _mm256_subs_epu8(v_sig, v_mc_running_avg_y);
+  // Obtain the sign. FF if diff is negative.
+  const __m256i diff_sign =
+      _mm256_cmpeq_epi8(pdiff, _mm256_setzero_si256());
+  // Clamp absolute difference to delta to get the adjustment.
+  const __m256i adj = _mm256_min_epu8(_mm256_or_si256(pdiff, ndiff), k_delta);
+  // Restore the sign and get positive and negative adjustments.
+  const __m256i padj = _mm256_andnot_si256(diff_sign, adj);
+  const __m256i nadj = _mm256_and_si256(diff_sign, adj);
+  // Calculate filtered value.
+  v_running_avg_y = _mm256_subs_epu8(v_running_avg_y, padj);
+  v_running_avg_y = _mm256_adds_epu8(v_running_avg_y, nadj);
+  yy_storeu_256(running_avg_y, v_running_avg_y);
+
+  // Accumulate the adjustments.
+  acc_diff = _mm256_subs_epi8(acc_diff, padj);
+  acc_diff = _mm256_adds_epi8(acc_diff, nadj);
+  return acc_diff;
+}
+
+// Denoise 32x16 to 128x128 blocks. Each byte of acc_diff accumulates the
+// adjustments of one column over 16 rows, exactly as in the SSE2 version, so
+// the saturation behavior and the result are the same.
+static int denoiser_NxM_avx2_big(const uint8_t *sig, int sig_stride,
+                                 const uint8_t *mc_running_avg_y,
+                                 int mc_avg_y_stride, uint8_t *running_avg_y,
+                                 int avg_y_stride, int increase_denoising,
+                                 BLOCK_SIZE bs, int motion_magnitude) {
+  int sum_diff = 0;
+  const int shift_inc =
+      (increase_denoising && motion_magnitude <= MOTION_MAGNITUDE_THRESHOLD)
+          ? 1
+          : 0;
+  __m256i acc_diff[4][8];
+  const __m256i k_4 = _mm256_set1_epi8(4 + shift_inc);
+  const __m256i k_8 = _mm256_set1_epi8(8);
+  const __m256i k_16 = _mm256_set1_epi8(16);
+  // Modify each level's adjustment according to motion_magnitude.
+  const __m256i l3 = _mm256_set1_epi8(
+      (motion_magnitude <= MOTION_MAGNITUDE_THRESHOLD) ? 7 + shift_inc : 6);
+  // Difference between level 3 and level 2 is 2.
+  const __m256i l32 = _mm256_set1_epi8(2);
+  // Difference between level 2 and level 1 is 1.
+  const __m256i l21 = _mm256_set1_epi8(1);
+  const int b_width = block_size_wide[bs];
+  const int b_height = block_size_high[bs];
+  const int b_width_shift5 = b_width >> 5;
+  assert(b_width >= 32 && b_height >= 16);
+
+  for (int r = 0; r < 8; ++r) {
+    for (int c = 0; c < b_width_shift5; ++c) {
+      acc_diff[c][r] = _mm256_setzero_si256();
+    }
+  }
+
+  for (int r = 0; r < b_height; ++r) {
+    for (int c = 0; c < b_width_shift5; ++c) {
+      acc_diff[c][r >> 4] = denoiser_32x1_avx2(
+          sig + 32 * c, mc_running_avg_y + 32 * c, running_avg_y + 32 * c, k_4,
+          k_8, k_16, l3, l32, l21, acc_diff[c][r >> 4]);
+    }
+
+    if ((r & 0xf) == 0xf) {
+      for (int c = 0; c < b_width_shift5; ++c) {
+        sum_diff += sum_diff_32x1(acc_diff[c][r >> 4]);
+      }
+    }
+
+    // Update pointers for next iteration.
+    sig += sig_stride;
+    mc_running_avg_y += mc_avg_y_stride;
+    running_avg_y += avg_y_stride;
+  }
+
+  const int sum_diff_thresh = total_adj_strong_thresh(bs, increase_denoising);
+  if (abs(sum_diff) > sum_diff_thresh) {
+    const int delta =
+        ((abs(sum_diff) - sum_diff_thresh) >> num_pels_log2_lookup[bs]) + 1;
+
+    // Only apply the adjustment for max delta up to 3.
+    if (delta >= 4) return COPY_BLOCK;
+
+    const __m256i k_delta = _mm256_set1_epi8(delta);
+    sig -= sig_stride * b_height;
+    mc_running_avg_y -= mc_avg_y_stride * b_height;
+    running_avg_y -= avg_y_stride * b_height;
+    sum_diff = 0;
+    for (int r = 0; r < b_height; ++r) {
+      for (int c = 0; c < b_width_shift5; ++c) {
+        acc_diff[c][r >> 4] = denoiser_adj_32x1_avx2(
+            sig + 32 * c, mc_running_avg_y + 32 * c, running_avg_y + 32 * c,
+            k_delta, acc_diff[c][r >> 4]);
+      }
+
+      if ((r & 0xf) == 0xf) {
+        for (int c = 0; c < b_width_shift5; ++c) {
+          sum_diff += sum_diff_32x1(acc_diff[c][r >> 4]);
+        }
+      }
+      sig += sig_stride;
+      mc_running_avg_y += mc_avg_y_stride;
+      running_avg_y += avg_y_stride;
+    }
+    if (abs(sum_diff) > sum_diff_thresh) return COPY_BLOCK;
+  }
+  return FILTER_BLOCK;
+}
+
+int av1_denoiser_filter_avx2(const uint8_t *sig, int sig_stride,
+                             const uint8_t *mc_avg, int mc_avg_stride,
+                             uint8_t *avg, int avg_stride,
+                             int increase_denoising, BLOCK_SIZE bs,
+                             int motion_magnitude) {
+  // Rank by frequency of the block type to have an early termination.
+  if (bs == BLOCK_32X32 || bs == BLOCK_64X64 || bs == BLOCK_128X128 ||
+      bs == BLOCK_128X64 || bs == BLOCK_64X128 || bs == BLOCK_32X16 ||
+      bs == BLOCK_32X64 || bs == BLOCK_64X32) {
+    return denoiser_NxM_avx2_big(sig, sig_stride, mc_avg, mc_avg_stride, avg,
+                                 avg_stride, increase_denoising, bs,
+                                 motion_magnitude);
+  }
+  // Blocks that are 16 pixels wide or less fill at most half a register.
+  return av1_denoiser_filter_sse2(sig, sig_stride, mc_avg, mc_avg_stride, avg,
+                                  avg_stride, increase_denoising, bs,
+                                  motion_magnitude);
+}
@@ -17,6 +17,8 @@
 #include "av1/common/av1_common_int.h"
 #include "av1/encoder/cnn.h"
 
+#define CLAMPINDEX(a, hi) ((a) < 0 ? 0 : ((a) >= (hi) ? ((hi) - 1) : (a)))
+
 // This mask rearranges source pixels in the order shown below.
 // shuffle_src_layer0[0][8]: applied on source pixels 0 to 7.
 // shuffle_src_layer0[1][8]: applied on source pixels 7 to 14.
@@ -235,6 +237,217 @@ static inline void perform_convolve_for_4hx2v_2x2_blocks(
   *out_accum = _mm256_add_ps(*out_accum, load_src[0]);
 }
 
+// The kernels below vectorize across 8 consecutive output channels: the
+// weights of a given (input channel, filter tap) pair are contiguous over the
+// output channels, so each tap is one weight load and one broadcast of the
+// input pixel. The taps are accumulated in the same order as the C code, with
+// separate multiplies and adds, so the results are bit-exact.
+
+static inline int get_start_shift_convolve(int width, int filt_width,
+                                           int stride) {
+  const int mod = (width % stride);
+  const int filt_off = (filt_width - 1) / 2;
+  const int dif = (mod ? mod - 1 : stride - 1);
+  return AOMMIN((dif + (filt_width % 2)) / 2, filt_off);
+}
+
+// Returns a mask that enables the first n (at most 8) lanes.
+static inline __m256i channel_mask(int n) {
+  return _mm256_cmpgt_epi32(_mm256_set1_epi32(n),
+                            _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+}
+
+static inline __m256 load_channels(const float *src, __m256i mask) {
+  return _mm256_maskload_ps(src, mask);
+}
+
+static inline void store_channels(float **output, int i, int n, int index,
+                                  __m256 value) {
+  float buf[8];
+  _mm256_storeu_ps(buf, value);
+  for (int j = 0; j < n; ++j) output[i + j][index] = buf[j];
+}
+
+// Convolves output channels i to i + 7 at the filter position whose top-left
+// tap is at (top, left) of the input. Taps outside the input are skipped for
+// PADDING_SAME_ZERO and clamped to the edge for PADDING_SAME_REPLICATE; for
+// PADDING_VALID they are always inside.
+static inline __m256 convolve_channels_at(
+    const float **input, int in_width, int in_height, int in_stride,
+    const CNN_LAYER_CONFIG *layer_config, int i, __m256i mask, int cstep,
+    int top, int left, PADDING_TYPE pad) {
+  __m256 sum = load_channels(&layer_config->bias[i], mask);
+  for (int k = 0; k < layer_config->in_channels; ++k) {
+    int off = k * layer_config->out_channels + i;
+    for (int l = 0; l < layer_config->filter_height; ++l) {
+      int ii = top + l;
+      if (pad == PADDING_SAME_REPLICATE) ii = CLAMPINDEX(ii, in_height);
+      for (int m = 0; m < layer_config->filter_width; ++m, off += cstep) {
+        int jj = left + m;
+        if (pad == PADDING_SAME_ZERO) {
+          if (ii < 0 || ii >= in_height || jj < 0 || jj >= in_width) continue;
+        } else if (pad == PADDING_SAME_REPLICATE) {
+          jj = CLAMPINDEX(jj, in_width);
+        }
+        assert(ii >= 0 && ii < in_height && jj >= 0 && jj < in_width);
+        const __m256 weight = load_channels(&layer_config->weights[off], mask);
+        const __m256 pixel = _mm256_set1_ps(input[k][ii * in_stride + jj]);
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(weight, pixel));
+      }
+    }
+  }
+  return sum;
+}
+
+// Channel-vectorized convolution with maxpool, for skip_width or skip_height
+// greater than 1. The filter origin follows the C code for each padding type.
+static void convolve_maxpool_avx2(const float **input, int in_width,
+                                  int in_height, int in_stride,
+                                  const CNN_LAYER_CONFIG *layer_config,
+                                  float **output, int out_stride, int cstep) {
+  const PADDING_TYPE pad = layer_config->pad;
+  const int is_valid = pad == PADDING_VALID;
+  const int filter_height_half = layer_config->filter_height >> 1;
+  const int filter_width_half = layer_config->filter_width >> 1;
+  const int top_shift = is_valid ? 0 : filter_height_half;
+  const int left_shift = is_valid ? 0 : filter_width_half;
+  const int end_h =
+      is_valid ? in_height - layer_config->filter_height + 1 : in_height;
+  const int end_w =
+      is_valid ? in_width - layer_config->filter_width + 1 : in_width;
+  for (int i = 0; i < layer_config->out_channels; i += 8) {
+    const int n = AOMMIN(8, layer_config->out_channels - i);
+    const __m256i mask = channel_mask(n);
+    for (int h = 0, u = 0; h < end_h; h += layer_config->skip_height, ++u) {
+      for (int w = 0, v = 0; w < end_w; w += layer_config->skip_width, ++v) {
+        __m256 best = _mm256_setzero_ps();
+        for (int hh = h; hh < AOMMIN(in_height, h + layer_config->skip_height);
+             ++hh) {
+          for (int ww = w; ww < AOMMIN(in_width, w + layer_config->skip_width);
+               ++ww) {
+            __m256 a;
+            if (pad == PADDING_SAME_ZERO) {
+              a = convolve_channels_at(input, in_width, in_height, in_stride,
+                                       layer_config, i, mask, cstep,
+                                       hh - top_shift, ww - left_shift,
+                                       PADDING_SAME_ZERO);
+            } else if (pad == PADDING_SAME_REPLICATE) {
+              a = convolve_channels_at(input, in_width, in_height, in_stride,
+                                       layer_config, i, mask, cstep,
+                                       hh - top_shift, ww - left_shift,
+                                       PADDING_SAME_REPLICATE);
+            } else {
+              a = convolve_channels_at(input, in_width, in_height, in_stride,
+                                       layer_config, i, mask, cstep, hh, ww,
+                                       PADDING_VALID);
+            }
+            // Same operand order as AOMMAX(output, a) in the C code.
+            best = (h == hh && w == ww) ? a : _mm256_max_ps(best, a);
+          }
+        }
+        store_channels(output, i, n, u * out_stride + v, best);
+      }
+    }
+  }
+}
+
+// Channel-vectorized convolution with filter_width and filter_height equal to
+// 1. Like the C code, threads split this case along the width.
+static void convolve_element_wise_avx2(const float **input, int in_width,
+                                       int in_height, int in_stride,
+                                       const CNN_LAYER_CONFIG *layer_config,
+                                       float **output, int out_stride,
+                                       int start_idx, int step) {
+  const int start_h = get_start_shift_convolve(
+      in_height, layer_config->filter_height, layer_config->skip_height);
+  const int start_w =
+      get_start_shift_convolve(in_width, layer_config->filter_width,
+                               layer_config->skip_width) +
+      start_idx * layer_config->skip_width;
+  const int out_w_step = AOMMAX(step, 1);
+  const int in_w_step = layer_config->skip_width * out_w_step;
+  for (int i = 0; i < layer_config->out_channels; i += 8) {
+    const int n = AOMMIN(8, layer_config->out_channels - i);
+    const __m256i mask = channel_mask(n);
+    for (int h = start_h, u = 0; h < in_height;
+         h += layer_config->skip_height, ++u) {
+      const int out_h = u * out_stride + start_idx;
+      for (int w = start_w, out_index = out_h; w < in_width;
+           w += in_w_step, out_index += out_w_step) {
+        const __m256 sum = convolve_channels_at(
+            input, in_width, in_height, in_stride, layer_config, i, mask,
+            layer_config->in_channels * layer_config->out_channels, h, w,
+            PADDING_VALID);
+        store_channels(output, i, n, out_index, sum);
+      }
+    }
+  }
+}
+
+// Channel-vectorized convolution without maxpool for the SAME paddings. The
+// filter is anchored the same way as in the C code.
+static void convolve_no_maxpool_padding_same_avx2(
+    const float **input, int in_width, int in_height, int in_stride,
+    const CNN_LAYER_CONFIG *layer_config, float **output, int out_stride,
+    int cstep) {
+  const int filter_height_half = layer_config->filter_height >> 1;
+  const int filter_width_half = layer_config->filter_width >> 1;
+  const int ii_shift =
+      filter_height_half - (layer_config->filter_height - 1) % 2;
+  const int jj_shift = filter_width_half - (layer_config->filter_width - 1) % 2;
+  const int start_h = get_start_shift_convolve(
+      in_height, layer_config->filter_height, layer_config->skip_height);
+  const int start_w = get_start_shift_convolve(
+      in_width, layer_config->filter_width, layer_config->skip_width);
+  for (int i = 0; i < layer_config->out_channels; i += 8) {
+    const int n = AOMMIN(8, layer_config->out_channels - i);
+    const __m256i mask = channel_mask(n);
+    for (int h = start_h, u = 0; h < in_height;
+         h += layer_config->skip_height, ++u) {
+      for (int w = start_w, out_index = u * out_stride; w < in_width;
+           w += layer_config->skip_width, ++out_index) {
+        __m256 sum;
+        if (layer_config->pad == PADDING_SAME_ZERO) {
+          sum = convolve_channels_at(input, in_width, in_height, in_stride,
+                                     layer_config, i, mask, cstep,
+                                     h - ii_shift, w - jj_shift,
+                                     PADDING_SAME_ZERO);
+        } else {
+          sum = convolve_channels_at(input, in_width, in_height, in_stride,
+                                     layer_config, i, mask, cstep,
+                                     h - ii_shift, w - jj_shift,
+                                     PADDING_SAME_REPLICATE);
+        }
+        store_channels(output, i, n, out_index, sum);
+      }
+    }
+  }
+}
+
+// Channel-vectorized convolution without maxpool and with PADDING_VALID, for
+// the filter sizes that have no dedicated kernel above.
+static void convolve_no_maxpool_padding_valid_avx2(
+    const float **input, int in_width, int in_height, int in_stride,
+    const CNN_LAYER_CONFIG *layer_config, float **output, int out_stride,
+    int start_idx, int cstep) {
+  for (int i = start_idx; i < layer_config->out_channels; i += 8) {
+    const int n = AOMMIN(8, layer_config->out_channels - i);
+    const __m256i mask = channel_mask(n);
+    for (int h = 0, u = 0; h < in_height - layer_config->filter_height + 1;
+         h += layer_config->skip_height, ++u) {
+      for (int w = 0, out_index = u * out_stride;
+           w < in_width - layer_config->filter_width + 1;
+           w += layer_config->skip_width, ++out_index) {
+        const __m256 sum =
+            convolve_channels_at(input, in_width, in_height, in_stride,
+                                 layer_config, i, mask, cstep, h, w,
+                                 PADDING_VALID);
+        store_channels(output, i, n, out_index, sum);
+      }
+    }
+  }
+}
+
 // AVX2 variant of av1_cnn_convolve_no_maxpool_padding_valid_c(), when
 // filter_width and filter_height are equal to 5.
 // CNN convolve parsing is based on av1_intra_mode_cnn_partition_cnn_config.
@@ -485,10 +698,14 @@ static void cnn_convolve_no_maxpool_padding_valid_2x2_avx2(
     cnn_convolve_no_maxpool_padding_valid_layer2_avx2(
         input, in_stride, layer_config, output, out_stride, start_idx, cstep,
         channel_step);
-  } else {
+  } else if (channel_step == 1) {
     // For layer equal to 3 and 4, the input is of size 4x4 and 2x2
-    // respectively. Implementing SIMD for these cases might not be optimal,
-    // which is why we call C path for layer >= 3.
+    // respectively. These are too small to vectorize across the width, so
+    // vectorize across the output channels instead.
+    convolve_no_maxpool_padding_valid_avx2(input, in_width, in_height,
+                                           in_stride, layer_config, output,
+                                           out_stride, start_idx, cstep);
+  } else {
     av1_cnn_convolve_no_maxpool_padding_valid_c(
         input, in_width, in_height, in_stride, layer_config, output, out_stride,
         start_idx, cstep, channel_step);
@@ -513,8 +730,10 @@ void av1_cnn_convolve_no_maxpool_padding_valid_avx2(
     const float **input, int in_width, int in_height, int in_stride,
     const CNN_LAYER_CONFIG *layer_config, float **output, int out_stride,
     int start_idx, int cstep, int channel_step) {
+  // The 5x5 kernel only accumulates a single input channel.
   if (layer_config->filter_width == 5 && layer_config->filter_height == 5 &&
-      layer_config->skip_width == 4 && layer_config->skip_height == 4) {
+      layer_config->skip_width == 4 && layer_config->skip_height == 4 &&
+      layer_config->in_channels == 1) {
     cnn_convolve_no_maxpool_padding_valid_5x5_avx2(
         input, in_width, in_height, in_stride, layer_config, output, out_stride,
         start_idx, cstep, channel_step);
@@ -524,9 +743,209 @@ void av1_cnn_convolve_no_maxpool_padding_valid_avx2(
     cnn_convolve_no_maxpool_padding_valid_2x2_avx2(
         input, in_width, in_height, in_stride, layer_config, output, out_stride,
         start_idx, cstep, channel_step);
+  } else if (channel_step == 1) {
+    convolve_no_maxpool_padding_valid_avx2(input, in_width, in_height,
+                                           in_stride, layer_config, output,
+                                           out_stride, start_idx, cstep);
   } else {
     av1_cnn_convolve_no_maxpool_padding_valid_c(
         input, in_width, in_height, in_stride, layer_config, output, out_stride,
         start_idx, cstep, channel_step);
   }
 }
+
+// AVX2 variant of av1_cnn_convolve_c(). Threads split the channels when step
+// is greater than 1, except for the element-wise case; the channel split is
+// left to the C code.
+void av1_cnn_convolve_avx2(const float **input, int in_width, int in_height,
+                           int in_stride, const CNN_LAYER_CONFIG *layer_config,
+                           float **output, int out_stride, int start_idx,
+                           int step) {
+  assert(!layer_config->deconvolve);
+  const int cstep = layer_config->in_channels * layer_config->out_channels;
+  const int is_maxpool =
+      layer_config->maxpool &&
+      (layer_config->skip_height > 1 || layer_config->skip_width > 1);
+  const int is_element_wise = !is_maxpool &&
+                              layer_config->filter_height == 1 &&
+                              layer_config->filter_width == 1;
+
+  if (is_element_wise) {
+    convolve_element_wise_avx2(input, in_width, in_height, in_stride,
+                               layer_config, output, out_stride, start_idx,
+                               step);
+  } else if (step > 1) {
+    av1_cnn_convolve_c(input, in_width, in_height, in_stride, layer_config,
+                       output, out_stride, start_idx, step);
+  } else if (is_maxpool) {
+    convolve_maxpool_avx2(input, in_width, in_height, in_stride, layer_config,
+                          output, out_stride, cstep);
+  } else if (layer_config->pad == PADDING_VALID) {
+    av1_cnn_convolve_no_maxpool_padding_valid(
+        input, in_width, in_height, in_stride, layer_config, output,
+        out_stride, start_idx, cstep, 1);
+  } else {
+    convolve_no_maxpool_padding_same_avx2(input, in_width, in_height,
+                                          in_stride, layer_config, output,
+                                          out_stride, cstep);
+  }
+}
+
+static inline int get_start_shift_deconvolve(int filt_width, int stride) {
+  const int dif = AOMMAX(filt_width - stride, 0);
+  return dif / 2;
+}
+
+// Deconvolves output channels i to i + 7 at output position (u, v), with the
+// taps visited in the same order as av1_cnn_deconvolve_c().
+static inline __m256 deconvolve_channels_at(
+    const float **input, int in_width, int in_height, int in_stride,
+    const CNN_LAYER_CONFIG *layer_config, int i, __m256i mask, int cstep,
+    int top, int left) {
+  const int pad = layer_config->pad;
+  __m256 sum = load_channels(&layer_config->bias[i], mask);
+  for (int k = 0; k < layer_config->in_channels; ++k) {
+    int off = k * layer_config->out_channels + i;
+    for (int l = 0; l < layer_config->filter_height; ++l) {
+      const int h = top - l;
+      for (int m = 0; m < layer_config->filter_width; ++m, off += cstep) {
+        const int w = left - m;
+        if ((h % layer_config->skip_height) != 0 ||
+            (w % layer_config->skip_width) != 0)
+          continue;
+        int ii = h / layer_config->skip_height;
+        int jj = w / layer_config->skip_width;
+        if (pad == PADDING_SAME_REPLICATE) {
+          ii = CLAMPINDEX(ii, in_height);
+          jj = CLAMPINDEX(jj, in_width);
+        } else if (ii < 0 || ii >= in_height || jj < 0 || jj >= in_width) {
+          continue;
+        }
+        const __m256 weight = load_channels(&layer_config->weights[off], mask);
+        const __m256 pixel = _mm256_set1_ps(input[k][ii * in_stride + jj]);
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(weight, pixel));
+      }
+    }
+  }
+  return sum;
+}
+
+// AVX2 variant of av1_cnn_deconvolve_c(), vectorized across output channels.
+void av1_cnn_deconvolve_avx2(const float **input, int in_width, int in_height,
+                             int in_stride,
+                             const CNN_LAYER_CONFIG *layer_config,
+                             float **output, int out_stride) {
+  assert(layer_config->deconvolve);
+  const int cstep = layer_config->in_channels * layer_config->out_channels;
+  const int is_valid = layer_config->pad == PADDING_VALID;
+  const int top_shift =
+      is_valid ? 0
+               : get_start_shift_deconvolve(layer_config->filter_height,
+                                            layer_config->skip_height);
+  const int left_shift =
+      is_valid ? 0
+               : get_start_shift_deconvolve(layer_config->filter_width,
+                                            layer_config->skip_width);
+  int out_width = 0;
+  int out_height = 0;
+  av1_find_cnn_layer_output_size(in_width, in_height, layer_config, &out_width,
+                                 &out_height);
+  for (int i = 0; i < layer_config->out_channels; i += 8) {
+    const int n = AOMMIN(8, layer_config->out_channels - i);
+    const __m256i mask = channel_mask(n);
+    for (int u = 0; u < out_height; ++u) {
+      for (int v = 0; v < out_width; ++v) {
+        const __m256 sum = deconvolve_channels_at(
+            input, in_width, in_height, in_stride, layer_config, i, mask,
+            cstep, u + top_shift, v + left_shift);
+        store_channels(output, i, n, u * out_stride + v, sum);
+      }
+    }
+  }
+}
+
+void av1_cnn_add_avx2(float **output, int channels, int width, int height,
+                      int stride, const float **add) {
+  for (int c = 0; c < channels; ++c) {
+    for (int i = 0; i < height; ++i) {
+      float *out = &output[c][i * stride];
+      const float *in = &add[c][i * stride];
+      int j = 0;
+      for (; j + 8 <= width; j += 8) {
+        _mm256_storeu_ps(
+            out + j,
+            _mm256_add_ps(_mm256_loadu_ps(out + j), _mm256_loadu_ps(in + j)));
+      }
+      for (; j < width; ++j) out[j] += in[j];
+    }
+  }
+}
+
+void av1_cnn_activate_avx2(float **output, int channels, int width,
+                           int height, int stride,
+                           ACTIVATION layer_activation) {
+  if (layer_activation != RELU && layer_activation != SOFTSIGN) {
+    av1_cnn_activate_c(output, channels, width, height, stride,
+                       layer_activation);
+    return;
+  }
+  const __m256 zero = _mm256_setzero_ps();
+  const __m256 one = _mm256_set1_ps(1.0f);
+  const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+  for (int c = 0; c < channels; ++c) {
+    for (int i = 0; i < height; ++i) {
+      float *out = &output[c][i * stride];
+      int j = 0;
+      if (layer_activation == RELU) {
+        // max(0, x) returns x when x is -0.0 or NaN, like (x < 0) ? 0 : x.
+        for (; j + 8 <= width; j += 8) {
+          _mm256_storeu_ps(out + j,
+                           _mm256_max_ps(zero, _mm256_loadu_ps(out + j)));
+        }
+        for (; j < width; ++j) out[j] = (out[j] < 0) ? 0 : out[j];
+      } else {
+        for (; j + 8 <= width; j += 8) {
+          const __m256 x = _mm256_loadu_ps(out + j);
+          const __m256 abs_x = _mm256_andnot_ps(sign_mask, x);
+          _mm256_storeu_ps(out + j,
+                           _mm256_div_ps(x, _mm256_add_ps(abs_x, one)));
+        }
+        for (; j < width; ++j) out[j] = out[j] / (fabsf(out[j]) + 1.0f);
+      }
+    }
+  }
+}
+
+void av1_cnn_batchnorm_avx2(float **image, int channels, int width,
+                            int height, int stride, const float *gamma,
+                            const float *beta, const float *mean,
+                            const float *std) {
+  assert(gamma && beta && beta && std && "batchnorm has null parameter!");
+  for (int ch = 0; ch < channels; ch++) {
+    const float ch_gamma = gamma[ch];
+    const float ch_beta = beta[ch];
+    const float ch_mean = mean[ch];
+    const float ch_std = std[ch];
+    const __m256 v_gamma = _mm256_set1_ps(ch_gamma);
+    const __m256 v_beta = _mm256_set1_ps(ch_beta);
+    const __m256 v_mean = _mm256_set1_ps(ch_mean);
+    const __m256 v_std = _mm256_set1_ps(ch_std);
+    float *image_row = image[ch];
+
+    for (int row = 0; row < height; row++) {
+      int col = 0;
+      // Same operation order as the C code, so the results are bit-exact.
+      for (; col + 8 <= width; col += 8) {
+        const __m256 x =
+            _mm256_sub_ps(_mm256_loadu_ps(image_row + col), v_mean);
+        const __m256 y = _mm256_div_ps(_mm256_mul_ps(v_gamma, x), v_std);
+        _mm256_storeu_ps(image_row + col, _mm256_add_ps(y, v_beta));
+      }
+      for (; col < width; col++) {
+        image_row[col] =
+            ch_gamma * (image_row[col] - ch_mean) / ch_std + ch_beta;
+      }
+      image_row += stride;
+    }
+  }
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <immintrin.h>
+
+#include "config/av1_rtcd.h"
+
+#include "av1/encoder/dwt.h"
+
+static inline void transpose_32bit_8x8_avx2(const __m256i *in, __m256i *out) {
+  __m256i t[8], u[8];
+  for (int i = 0; i < 4; i++) {
+    t[2 * i] = _mm256_unpacklo_epi32(in[2 * i], in[2 * i + 1]);
+    t[2 * i + 1] = _mm256_unpackhi_epi32(in[2 * i], in[2 * i + 1]);
+  }
+  for (int i = 0; i < 2; i++) {
+    u[4 * i + 0] = _mm256_unpacklo_epi64(t[4 * i + 0], t[4 * i + 2]);
+    u[4 * i + 1] = _mm256_unpackhi_epi64(t[4 * i + 0], t[4 * i + 2]);
+    u[4 * i + 2] = _mm256_unpacklo_epi64(t[4 * i + 1], t[4 * i + 3]);
+    u[4 * i + 3] = _mm256_unpackhi_epi64(t[4 * i + 1], t[4 * i + 3]);
+  }
+  for (int i = 0; i < 4; i++) {
+    out[i] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x20);
+    out[i + 4] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x31);
+  }
+}
+
+// Loads an 8x8 block, scaled like the C code, with one row per register.
+static inline void load_block_8x8(const uint8_t *input, int stride, int hbd,
+                                  __m256i *rows) {
+  if (hbd) {
+    const uint16_t *input16 = CONVERT_TO_SHORTPTR(input);
+    for (int i = 0; i < 8; i++) {
+      const __m128i v =
+          _mm_loadu_si128((const __m128i *)(input16 + i * stride));
+      rows[i] = _mm256_slli_epi32(_mm256_cvtepu16_epi32(v), 2);
+    }
+  } else {
+    for (int i = 0; i < 8; i++) {
+      const __m128i v = _mm_loadl_epi64((const __m128i *)(input + i * stride));
+      rows[i] = _mm256_slli_epi32(_mm256_cvtepu8_epi32(v), 2);
+    }
+  }
+}
+
+static inline __m256i round_shift1(__m256i a, __m256i b) {
+  return _mm256_srai_epi32(
+      _mm256_add_epi32(_mm256_add_epi32(a, b), _mm256_set1_epi32(1)), 1);
+}
+
+// One length-8 row analysis step of the 5/3 wavelet, applied to 8 rows at
+// once: x[j] holds column j of the rows. On return x[0..3] hold the low-pass
+// and x[4..7] the high-pass outputs.
+static inline void analysis_53_row_x8(__m256i *x) {
+  __m256i a[4], b[4];
+  for (int k = 0; k < 3; k++) {
+    a[k] = _mm256_slli_epi32(x[2 * k], 1);
+    b[k] = _mm256_sub_epi32(x[2 * k + 1], round_shift1(x[2 * k], x[2 * k + 2]));
+  }
+  a[3] = _mm256_slli_epi32(x[6], 1);
+  b[3] = _mm256_sub_epi32(x[7], x[6]);
+  x[0] = _mm256_add_epi32(a[0], round_shift1(b[0], b[0]));
+  for (int k = 1; k < 4; k++) {
+    x[k] = _mm256_add_epi32(a[k], round_shift1(b[k - 1], b[k]));
+  }
+  for (int k = 0; k < 4; k++) x[4 + k] = b[k];
+}
+
+// Same as analysis_53_row_x8(), for the column step of the 5/3 wavelet.
+static inline void analysis_53_col_x8(__m256i *x) {
+  const __m256i two = _mm256_set1_epi32(2);
+  __m256i a[4], b[4];
+  for (int k = 0; k < 3; k++) {
+    a[k] = x[2 * k];
+    const __m256i sum = _mm256_add_epi32(x[2 * k], x[2 * k + 2]);
+    b[k] = _mm256_srai_epi32(
+        _mm256_add_epi32(
+            _mm256_sub_epi32(_mm256_slli_epi32(x[2 * k + 1], 1), sum), two),
+        2);
+  }
+  a[3] = x[6];
+  b[3] = _mm256_srai_epi32(
+      _mm256_add_epi32(_mm256_sub_epi32(x[7], x[6]), _mm256_set1_epi32(1)),
+      1);
+  x[0] = _mm256_add_epi32(a[0], round_shift1(b[0], b[0]));
+  for (int k = 1; k < 4; k++) {
+    x[k] = _mm256_add_epi32(a[k], round_shift1(b[k - 1], b[k]));
+  }
+  for (int k = 0; k < 4; k++) x[4 + k] = b[k];
+}
+
+// Computes the first decomposition level of the 8x8 block, with one output
+// row per register.
+static inline void fdwt8x8_level0(const uint8_t *input, int stride, int hbd,
+                                  __m256i *rows) {
+  __m256i cols[8];
+  load_block_8x8(input, stride, hbd, rows);
+  transpose_32bit_8x8_avx2(rows, cols);
+  analysis_53_row_x8(cols);
+  transpose_32bit_8x8_avx2(cols, rows);
+  analysis_53_col_x8(rows);
+}
+
+void av1_fdwt8x8_uint8_input_avx2(const uint8_t *input, tran_low_t *output,
+                                  int stride, int hbd) {
+  __m256i rows[8];
+  fdwt8x8_level0(input, stride, hbd, rows);
+  for (int i = 0; i < 8; i++) {
+    _mm256_storeu_si256((__m256i *)(output + i * 8), rows[i]);
+  }
+  // The remaining levels only transform the 4x4 low-pass corner.
+  av1_dwt53_analyze(3, 4, 4, output, 8);
+}
+
+int av1_haar_ac_sad_8x8_uint8_input_avx2(const uint8_t *input, int stride,
+                                         int hbd) {
+  // The AC coefficients are all outside the 4x4 low-pass corner, which the
+  // later levels never touch, so only the first level is needed.
+  __m256i rows[8];
+  fdwt8x8_level0(input, stride, hbd, rows);
+  const __m256i hi_cols = _mm256_setr_epi32(0, 0, 0, 0, -1, -1, -1, -1);
+  __m256i sum = _mm256_setzero_si256();
+  for (int i = 0; i < 4; i++) {
+    sum = _mm256_add_epi32(
+        sum, _mm256_and_si256(_mm256_abs_epi32(rows[i]), hi_cols));
+    sum = _mm256_add_epi32(sum, _mm256_abs_epi32(rows[i + 4]));
+  }
+  __m128i sum128 = _mm_add_epi32(_mm256_castsi256_si128(sum),
+                                 _mm256_extracti128_si256(sum, 1));
+  sum128 = _mm_add_epi32(sum128, _mm_srli_si128(sum128, 8));
+  sum128 = _mm_add_epi32(sum128, _mm_srli_si128(sum128, 4));
+  return _mm_cvtsi128_si32(sum128);
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <emmintrin.h>
+
+#include "config/av1_rtcd.h"
+
+#include "aom_dsp/x86/transpose_sse2.h"
+#include "av1/encoder/dwt.h"
+
+// The 8x8 block is held as two 8x4 halves: lo[i] has columns 0-3 of row i and
+// hi[i] has columns 4-7.
+static inline void load_block_8x8(const uint8_t *input, int stride, int hbd,
+                                  __m128i *lo, __m128i *hi) {
+  const __m128i zero = _mm_setzero_si128();
+  for (int i = 0; i < 8; i++) {
+    __m128i v;
+    if (hbd) {
+      v = _mm_loadu_si128(
+          (const __m128i *)(CONVERT_TO_SHORTPTR(input) + i * stride));
+    } else {
+      v = _mm_unpacklo_epi8(
+          _mm_loadl_epi64((const __m128i *)(input + i * stride)), zero);
+    }
+    lo[i] = _mm_slli_epi32(_mm_unpacklo_epi16(v, zero), 2);
+    hi[i] = _mm_slli_epi32(_mm_unpackhi_epi16(v, zero), 2);
+  }
+}
+
+static inline __m128i round_shift1(__m128i a, __m128i b) {
+  return _mm_srai_epi32(_mm_add_epi32(_mm_add_epi32(a, b), _mm_set1_epi32(1)),
+                        1);
+}
+
+// One length-8 row analysis step of the 5/3 wavelet, applied to 4 rows at
+// once: x[j] holds column j of the rows. On return x[0..3] hold the low-pass
+// and x[4..7] the high-pass outputs.
+static inline void analysis_53_row_x4(__m128i *x) {
+  __m128i a[4], b[4];
+  for (int k = 0; k < 3; k++) {
+    a[k] = _mm_slli_epi32(x[2 * k], 1);
+    b[k] = _mm_sub_epi32(x[2 * k + 1], round_shift1(x[2 * k], x[2 * k + 2]));
+  }
+  a[3] = _mm_slli_epi32(x[6], 1);
+  b[3] = _mm_sub_epi32(x[7], x[6]);
+  x[0] = _mm_add_epi32(a[0], round_shift1(b[0], b[0]));
+  for (int k = 1; k < 4; k++) {
+    x[k] = _mm_add_epi32(a[k], round_shift1(b[k - 1], b[k]));
+  }
+  for (int k = 0; k < 4; k++) x[4 + k] = b[k];
+}
+
+// Same as analysis_53_row_x4(), for the column step of the 5/3 wavelet.
+static inline void analysis_53_col_x4(__m128i *x) {
+  const __m128i two = _mm_set1_epi32(2);
+  __m128i a[4], b[4];
+  for (int k = 0; k < 3; k++) {
+    a[k] = x[2 * k];
+    const __m128i sum = _mm_add_epi32(x[2 * k], x[2 * k + 2]);
+    b[k] = _mm_srai_epi32(
+        _mm_add_epi32(_mm_sub_epi32(_mm_slli_epi32(x[2 * k + 1], 1), sum),
+                      two),
+        2);
+  }
+  a[3] = x[6];
+  b[3] = _mm_srai_epi32(
+      _mm_add_epi32(_mm_sub_epi32(x[7], x[6]), _mm_set1_epi32(1)), 1);
+  x[0] = _mm_add_epi32(a[0], round_shift1(b[0], b[0]));
+  for (int k = 1; k < 4; k++) {
+    x[k] = _mm_add_epi32(a[k], round_shift1(b[k - 1], b[k]));
+  }
+  for (int k = 0; k < 4; k++) x[4 + k] = b[k];
+}
+
+// Computes the first decomposition level of the 8x8 block. On return lo[i]
+// and hi[i] hold columns 0-3 and 4-7 of output row i.
+static inline void fdwt8x8_level0(const uint8_t *input, int stride, int hbd,
+                                  __m128i *lo, __m128i *hi) {
+  load_block_8x8(input, stride, hbd, lo, hi);
+  for (int r = 0; r < 8; r += 4) {
+    __m128i cols[8];
+    transpose_32bit_4x4(lo + r, cols);
+    transpose_32bit_4x4(hi + r, cols + 4);
+    analysis_53_row_x4(cols);
+    transpose_32bit_4x4(cols, lo + r);
+    transpose_32bit_4x4(cols + 4, hi + r);
+  }
+  analysis_53_col_x4(lo);
+  analysis_53_col_x4(hi);
+}
+
+void av1_fdwt8x8_uint8_input_sse2(const uint8_t *input, tran_low_t *output,
+                                  int stride, int hbd) {
+  __m128i lo[8], hi[8];
+  fdwt8x8_level0(input, stride, hbd, lo, hi);
+  for (int i = 0; i < 8; i++) {
+    _mm_storeu_si128((__m128i *)(output + i * 8), lo[i]);
+    _mm_storeu_si128((__m128i *)(output + i * 8 + 4), hi[i]);
+  }
+  // The remaining levels only transform the 4x4 low-pass corner.
+  av1_dwt53_analyze(3, 4, 4, output, 8);
+}
+
+static inline __m128i abs_epi32(__m128i x) {
+  const __m128i sign = _mm_srai_epi32(x, 31);
+  return _mm_sub_epi32(_mm_xor_si128(x, sign), sign);
+}
+
+int av1_haar_ac_sad_8x8_uint8_input_sse2(const uint8_t *input, int stride,
+                                         int hbd) {
+  // The AC coefficients are all outside the 4x4 low-pass corner, which the
+  // later levels never touch, so only the first level is needed.
+  __m128i lo[8], hi[8];
+  fdwt8x8_level0(input, stride, hbd, lo, hi);
+  __m128i sum = _mm_setzero_si128();
+  for (int i = 0; i < 4; i++) {
+    sum = _mm_add_epi32(sum, abs_epi32(hi[i]));
+    sum = _mm_add_epi32(sum, abs_epi32(lo[i + 4]));
+    sum = _mm_add_epi32(sum, abs_epi32(hi[i + 4]));
+  }
+  sum = _mm_add_epi32(sum, _mm_srli_si128(sum, 8));
+  sum = _mm_add_epi32(sum, _mm_srli_si128(sum, 4));
+  return _mm_cvtsi128_si32(sum);
+}
@@ -14,6 +14,8 @@
 #include <smmintrin.h>  /* SSE4.1 */
 #include <immintrin.h>  /* AVX2 */
 
+#include "config/av1_rtcd.h"
+
 #include "aom/aom_integer.h"
 #include "aom_dsp/x86/mem_sse2.h"
 #include "av1/common/av1_common_int.h"
@@ -120,3 +122,179 @@ void av1_txb_init_levels_avx2(const tran_low_t *const coeff, const int width,
     } while (i < width);
   }
 }
+
+static inline void load_levels_16x2x5_avx2(const uint8_t *const src,
+                                           const int stride, const int next,
+                                           const ptrdiff_t *const offsets,
+                                           __m256i *const level) {
+  level[0] = yy_loadu2_128(src + next + 1, src + 1);
+  level[1] = yy_loadu2_128(src + next + stride, src + stride);
+  level[2] = yy_loadu2_128(src + next + offsets[0], src + offsets[0]);
+  level[3] = yy_loadu2_128(src + next + offsets[1], src + offsets[1]);
+  level[4] = yy_loadu2_128(src + next + offsets[2], src + offsets[2]);
+}
+
+static inline __m256i get_coeff_contexts_kernel_avx2(__m256i *const level) {
+  const __m256i const_3 = _mm256_set1_epi8(3);
+  const __m256i const_4 = _mm256_set1_epi8(4);
+  __m256i count;
+
+  count = _mm256_min_epu8(level[0], const_3);
+  level[1] = _mm256_min_epu8(level[1], const_3);
+  level[2] = _mm256_min_epu8(level[2], const_3);
+  level[3] = _mm256_min_epu8(level[3], const_3);
+  level[4] = _mm256_min_epu8(level[4], const_3);
+  count = _mm256_add_epi8(count, level[1]);
+  count = _mm256_add_epi8(count, level[2]);
+  count = _mm256_add_epi8(count, level[3]);
+  count = _mm256_add_epi8(count, level[4]);
+  count = _mm256_avg_epu8(count, _mm256_setzero_si256());
+  count = _mm256_min_epu8(count, const_4);
+  return count;
+}
+
+// Computes the contexts of 32 levels per iteration: two columns at a time when
+// height is 16, otherwise 32 levels of the same column. The offset added to
+// the first 16 levels of column c is pos_first[min(c, last_first)], the one
+// added to the remaining levels of the column is
+// pos_large[min(c, last_large)].
+static inline void get_16n_coeff_contexts_avx2(
+    const uint8_t *levels, const int width, const int height,
+    const ptrdiff_t *const offsets, const __m128i *const pos_first,
+    const int last_first, const __m128i *const pos_large, const int last_large,
+    int8_t *coeff_contexts) {
+  const int stride = height + TX_PAD_HOR;
+  __m256i level[5];
+
+  assert(!(height % 16));
+
+  if (height == 16) {
+    assert(!(width % 2));
+    for (int col = 0; col < width; col += 2) {
+      const __m256i pos_to_offset =
+          yy_set_m128i(pos_first[AOMMIN(col + 1, last_first)],
+                       pos_first[AOMMIN(col, last_first)]);
+      load_levels_16x2x5_avx2(levels, stride, stride, offsets, level);
+      const __m256i count = _mm256_add_epi8(
+          get_coeff_contexts_kernel_avx2(level), pos_to_offset);
+      yy_storeu_256(coeff_contexts, count);
+      levels += 2 * stride;
+      coeff_contexts += 32;
+    }
+  } else {
+    for (int col = 0; col < width; ++col) {
+      const __m128i large = pos_large[AOMMIN(col, last_large)];
+      __m256i pos_to_offset =
+          yy_set_m128i(large, pos_first[AOMMIN(col, last_first)]);
+      for (int h = 0; h < height; h += 32) {
+        load_levels_16x2x5_avx2(levels, stride, 16, offsets, level);
+        const __m256i count = _mm256_add_epi8(
+            get_coeff_contexts_kernel_avx2(level), pos_to_offset);
+        yy_storeu_256(coeff_contexts, count);
+        pos_to_offset = yy_set_m128i(large, large);
+        levels += 32;
+        coeff_contexts += 32;
+      }
+      levels += TX_PAD_HOR;
+    }
+  }
+}
+
+// Note: levels[] must be in the range [0, 127], inclusive.
+void av1_get_nz_map_contexts_avx2(const uint8_t *const levels,
+                                  const int16_t *const scan, const int eob,
+                                  const TX_SIZE tx_size,
+                                  const TX_CLASS tx_class,
+                                  int8_t *const coeff_contexts) {
+  const int width = get_txb_wide(tx_size);
+  const int height = get_txb_high(tx_size);
+  const int last_idx = eob - 1;
+  if (!last_idx || height < 16) {
+    // Columns of 4 or 8 levels are handled as efficiently by the SSE2 code.
+    av1_get_nz_map_contexts_sse2(levels, scan, eob, tx_size, tx_class,
+                                 coeff_contexts);
+    return;
+  }
+
+  const int real_width = tx_size_wide[tx_size];
+  const int real_height = tx_size_high[tx_size];
+  const int stride = height + TX_PAD_HOR;
+  ptrdiff_t offsets[3];
+
+  if (tx_class == TX_CLASS_2D) {
+    offsets[0] = 0 * stride + 2;
+    offsets[1] = 1 * stride + 1;
+    offsets[2] = 2 * stride + 0;
+
+    const __m128i ctx_21 = _mm_set1_epi8(21);
+    __m128i pos_first[5];
+    __m128i pos_large[3];
+    if (real_width == real_height) {
+      pos_first[0] = _mm_setr_epi8(0, 1, 6, 6, 21, 21, 21, 21, 21, 21, 21, 21,
+                                   21, 21, 21, 21);
+      pos_first[1] = _mm_setr_epi8(1, 6, 6, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+                                   21, 21, 21, 21);
+      pos_first[2] = _mm_setr_epi8(6, 6, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+                                   21, 21, 21, 21, 21);
+      pos_first[3] = _mm_setr_epi8(6, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+                                   21, 21, 21, 21, 21);
+      pos_first[4] = pos_large[0] = pos_large[1] = pos_large[2] = ctx_21;
+    } else if (real_width < real_height) {
+      pos_first[0] = _mm_setr_epi8(0, 11, 6, 6, 21, 21, 21, 21, 21, 21, 21, 21,
+                                   21, 21, 21, 21);
+      pos_first[1] = _mm_setr_epi8(11, 11, 6, 21, 21, 21, 21, 21, 21, 21, 21,
+                                   21, 21, 21, 21, 21);
+      pos_first[2] = pos_first[3] = pos_first[4] = _mm_setr_epi8(
+          11, 11, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21);
+      pos_large[0] = pos_large[1] = pos_large[2] = ctx_21;
+    } else {  // real_width > real_height
+      pos_first[0] = pos_first[1] = _mm_set1_epi8(16);
+      pos_first[2] = _mm_setr_epi8(6, 6, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+                                   21, 21, 21, 21, 21);
+      pos_first[3] = _mm_setr_epi8(6, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+                                   21, 21, 21, 21, 21);
+      pos_first[4] = pos_large[2] = ctx_21;
+      pos_large[0] = pos_large[1] = _mm_set1_epi8(16);
+    }
+    get_16n_coeff_contexts_avx2(levels, width, height, offsets, pos_first, 4,
+                                pos_large, 2, coeff_contexts);
+    coeff_contexts[0] = 0;
+  } else if (tx_class == TX_CLASS_HORIZ) {
+    offsets[0] = 2 * stride;
+    offsets[1] = 3 * stride;
+    offsets[2] = 4 * stride;
+
+    const __m128i pos_to_offset[3] = { _mm_set1_epi8(SIG_COEF_CONTEXTS_2D + 0),
+                                       _mm_set1_epi8(SIG_COEF_CONTEXTS_2D + 5),
+                                       _mm_set1_epi8(SIG_COEF_CONTEXTS_2D +
+                                                     10) };
+    get_16n_coeff_contexts_avx2(levels, width, height, offsets, pos_to_offset,
+                                2, pos_to_offset, 2, coeff_contexts);
+  } else {  // TX_CLASS_VERT
+    offsets[0] = 2;
+    offsets[1] = 3;
+    offsets[2] = 4;
+
+    const __m128i pos_first =
+        _mm_setr_epi8(SIG_COEF_CONTEXTS_2D + 0, SIG_COEF_CONTEXTS_2D + 5,
+                      SIG_COEF_CONTEXTS_2D + 10, SIG_COEF_CONTEXTS_2D + 10,
+                      SIG_COEF_CONTEXTS_2D + 10, SIG_COEF_CONTEXTS_2D + 10,
+                      SIG_COEF_CONTEXTS_2D + 10, SIG_COEF_CONTEXTS_2D + 10,
+                      SIG_COEF_CONTEXTS_2D + 10, SIG_COEF_CONTEXTS_2D + 10,
+                      SIG_COEF_CONTEXTS_2D + 10, SIG_COEF_CONTEXTS_2D + 10,
+                      SIG_COEF_CONTEXTS_2D + 10, SIG_COEF_CONTEXTS_2D + 10,
+                      SIG_COEF_CONTEXTS_2D + 10, SIG_COEF_CONTEXTS_2D + 10);
+    const __m128i pos_large = _mm_set1_epi8(SIG_COEF_CONTEXTS_2D + 10);
+    get_16n_coeff_contexts_avx2(levels, width, height, offsets, &pos_first, 0,
+                                &pos_large, 0, coeff_contexts);
+  }
+
+  const int bhl = get_txb_bhl(tx_size);
+  const int pos = scan[last_idx];
+  if (last_idx <= (width << bhl) / 8)
+    coeff_contexts[pos] = 1;
+  else if (last_idx <= (width << bhl) / 4)
+    coeff_contexts[pos] = 2;
+  else
+    coeff_contexts[pos] = 3;
+}
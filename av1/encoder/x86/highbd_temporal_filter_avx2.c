@@ -473,3 +473,139 @@ void av1_highbd_apply_temporal_filter_avx2(
   aom_free(frame_sse);
   aom_free(luma_sse_sum);
 }
+
+// Processes 16 columns of pixels per iteration, walking down the plane one
+// row at a time. The Sobel gradient magnitude and the absolute Laplacian of
+// 12-bit input are at most 8 * 4095 = 32760, so both fit in 16-bit lanes.
+// Adding the rounding offset may carry them into bit 15, which is why they
+// are rounded with a logical shift.
+double av1_highbd_estimate_noise_from_single_plane_avx2(const uint16_t *src,
+                                                        int height, int width,
+                                                        int stride,
+                                                        int bit_depth,
+                                                        int edge_thresh) {
+  int count = 0;
+  int64_t accum = 0;
+  // w16 stores width multiple of 16.
+  const int w16 = (width - 1) & ~0xf;
+  const int shift = bit_depth - 8;
+  const __m128i shift_reg = _mm_cvtsi32_si128(shift);
+  const __m256i round = _mm256_set1_epi16((1 << shift) >> 1);
+  const __m256i edge_threshold = _mm256_set1_epi16(edge_thresh);
+  const __m256i one = _mm256_set1_epi16(1);
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i sum_accumulator = zero;
+  __m256i num_accumulator = zero;
+
+  //  A | B | C
+  //  D | E | F
+  //  G | H | I
+  // g_x = (A - C) + (G - I) + 2*(D - F)
+  // g_y = (A + C) - (G + I) + 2*(B - H)
+  // v   = 4*E - 2*(D+F+B+H) + (A+C+G+I)
+  for (int w = 1; w < w16; w += 16) {
+    const uint16_t *row = src + w;
+    __m256i A = _mm256_loadu_si256((const __m256i *)(row - 1));
+    __m256i B = _mm256_loadu_si256((const __m256i *)row);
+    __m256i C = _mm256_loadu_si256((const __m256i *)(row + 1));
+    row += stride;
+    __m256i D = _mm256_loadu_si256((const __m256i *)(row - 1));
+    __m256i E = _mm256_loadu_si256((const __m256i *)row);
+    __m256i F = _mm256_loadu_si256((const __m256i *)(row + 1));
+    __m256i sum_col = zero;
+    __m256i num_col = zero;
+
+    for (int h = 1; h < height - 1; ++h) {
+      row += stride;
+      const __m256i G = _mm256_loadu_si256((const __m256i *)(row - 1));
+      const __m256i H = _mm256_loadu_si256((const __m256i *)row);
+      const __m256i I = _mm256_loadu_si256((const __m256i *)(row + 1));
+
+      const __m256i sum_AC = _mm256_add_epi16(A, C);
+      const __m256i sum_GI = _mm256_add_epi16(G, I);
+      const __m256i g_x = _mm256_add_epi16(
+          _mm256_add_epi16(_mm256_sub_epi16(A, C), _mm256_sub_epi16(G, I)),
+          _mm256_slli_epi16(_mm256_sub_epi16(D, F), 1));
+      const __m256i g_y = _mm256_add_epi16(
+          _mm256_sub_epi16(sum_AC, sum_GI),
+          _mm256_slli_epi16(_mm256_sub_epi16(B, H), 1));
+      __m256i ga =
+          _mm256_add_epi16(_mm256_abs_epi16(g_x), _mm256_abs_epi16(g_y));
+      ga = _mm256_srl_epi16(_mm256_add_epi16(ga, round), shift_reg);
+      const __m256i mask = _mm256_cmpgt_epi16(edge_threshold, ga);
+
+      // 4*E - 2*(D+F+B+H) + (A+C+G+I)
+      const __m256i sum_DFBH =
+          _mm256_add_epi16(_mm256_add_epi16(D, F), _mm256_add_epi16(B, H));
+      __m256i v = _mm256_sub_epi16(_mm256_slli_epi16(E, 2),
+                                   _mm256_slli_epi16(sum_DFBH, 1));
+      v = _mm256_abs_epi16(
+          _mm256_add_epi16(v, _mm256_add_epi16(sum_AC, sum_GI)));
+      v = _mm256_srl_epi16(_mm256_add_epi16(v, round), shift_reg);
+      v = _mm256_and_si256(v, mask);
+
+      sum_col = _mm256_add_epi32(sum_col, _mm256_madd_epi16(v, one));
+      num_col = _mm256_sub_epi16(num_col, mask);
+
+      A = D;
+      B = E;
+      C = F;
+      D = G;
+      E = H;
+      F = I;
+    }
+    // The 32-bit sums of a single column cannot overflow, but those of the
+    // whole plane may, so they are widened here.
+    sum_accumulator = _mm256_add_epi64(
+        sum_accumulator, _mm256_unpacklo_epi32(sum_col, zero));
+    sum_accumulator = _mm256_add_epi64(
+        sum_accumulator, _mm256_unpackhi_epi32(sum_col, zero));
+    num_accumulator = _mm256_add_epi32(
+        num_accumulator, _mm256_unpacklo_epi16(num_col, zero));
+    num_accumulator = _mm256_add_epi32(
+        num_accumulator, _mm256_unpackhi_epi16(num_col, zero));
+  }
+
+  // Process the remaining width here.
+  for (int h = 1; h < height - 1; ++h) {
+    for (int w = w16 + 1; w < width - 1; ++w) {
+      const int k = h * stride + w;
+
+      // Compute sobel gradients
+      const int g_x = (src[k - stride - 1] - src[k - stride + 1]) +
+                      (src[k + stride - 1] - src[k + stride + 1]) +
+                      2 * (src[k - 1] - src[k + 1]);
+      const int g_y = (src[k - stride - 1] - src[k + stride - 1]) +
+                      (src[k - stride + 1] - src[k + stride + 1]) +
+                      2 * (src[k - stride] - src[k + stride]);
+      const int ga = ROUND_POWER_OF_TWO(abs(g_x) + abs(g_y), shift);
+
+      if (ga < edge_thresh) {
+        // Find Laplacian
+        const int v =
+            4 * src[k] -
+            2 * (src[k - 1] + src[k + 1] + src[k - stride] + src[k + stride]) +
+            (src[k - stride - 1] + src[k - stride + 1] + src[k + stride - 1] +
+             src[k + stride + 1]);
+        accum += ROUND_POWER_OF_TWO(abs(v), shift);
+        ++count;
+      }
+    }
+  }
+
+  __m128i sum_128 = _mm_add_epi64(_mm256_castsi256_si128(sum_accumulator),
+                                  _mm256_extracti128_si256(sum_accumulator, 1));
+  sum_128 = _mm_add_epi64(sum_128, _mm_srli_si128(sum_128, 8));
+  int64_t sum;
+  _mm_storel_epi64((__m128i *)&sum, sum_128);
+  __m128i num_128 = _mm_add_epi32(_mm256_castsi256_si128(num_accumulator),
+                                  _mm256_extracti128_si256(num_accumulator, 1));
+  num_128 = _mm_add_epi32(num_128, _mm_srli_si128(num_128, 8));
+  num_128 = _mm_add_epi32(num_128, _mm_srli_si128(num_128, 4));
+
+  accum += sum;
+  count += _mm_cvtsi128_si32(num_128);
+
+  // If very few smooth pels, return -1 since the estimate is unreliable.
+  return (count < 16) ? -1.0 : (double)accum / (6 * count) * SQRT_PI_BY_2;
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <immintrin.h>  // AVX2
+
+#include "config/av1_rtcd.h"
+
+#include "av1/encoder/x86/palette_x86.h"
+
+int av1_count_colors_row_avx2(const uint8_t *src, int width, int *val_count) {
+  int n = val_count[src[0]]++ == 0;
+  int c = 1;
+  for (; c + 32 <= width; c += 32) {
+    const __m256i cur = _mm256_loadu_si256((const __m256i *)(src + c));
+    const __m256i prev = _mm256_loadu_si256((const __m256i *)(src + c - 1));
+    const unsigned int same =
+        (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(cur, prev));
+    if (same == 0) {
+      for (int i = 0; i < 32; ++i) n += val_count[src[c + i]]++ == 0;
+    } else {
+      n += count_color_runs(src + c, ~same | 1, 32, val_count);
+    }
+  }
+  for (; c < width; ++c) n += val_count[src[c]]++ == 0;
+  return n;
+}
+
+static inline __m256i cmpeq_prev_epi16(const uint16_t *src) {
+  const __m256i cur = _mm256_loadu_si256((const __m256i *)src);
+  const __m256i prev = _mm256_loadu_si256((const __m256i *)(src - 1));
+  return _mm256_cmpeq_epi16(cur, prev);
+}
+
+int av1_count_colors_row_highbd_avx2(const uint16_t *src, int width,
+                                     int bit_depth, int *val_count,
+                                     int *bin_val_count) {
+  const int shift = bit_depth - 8;
+  int n = count_color_runs_highbd(src, 1, 1, shift, val_count, bin_val_count);
+  int c = 1;
+  for (; c + 32 <= width; c += 32) {
+    // The pack interleaves the 128-bit lanes of its inputs, which the
+    // permute puts back in pixel order.
+    const __m256i same16 = _mm256_permute4x64_epi64(
+        _mm256_packs_epi16(cmpeq_prev_epi16(src + c),
+                           cmpeq_prev_epi16(src + c + 16)),
+        0xd8);
+    const unsigned int same = (unsigned int)_mm256_movemask_epi8(same16);
+    n += count_color_runs_highbd(src + c, ~same | 1, 32, shift, val_count,
+                                 bin_val_count);
+  }
+  for (; c < width; ++c) {
+    n += count_color_runs_highbd(src + c, 1, 1, shift, val_count,
+                                 bin_val_count);
+  }
+  return n;
+}
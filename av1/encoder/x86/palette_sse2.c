@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <emmintrin.h>  // SSE2
+
+#include "config/av1_rtcd.h"
+
+#include "av1/encoder/x86/palette_x86.h"
+
+int av1_count_colors_row_sse2(const uint8_t *src, int width, int *val_count) {
+  int n = val_count[src[0]]++ == 0;
+  int c = 1;
+  for (; c + 16 <= width; c += 16) {
+    const __m128i cur = _mm_loadu_si128((const __m128i *)(src + c));
+    const __m128i prev = _mm_loadu_si128((const __m128i *)(src + c - 1));
+    const unsigned int same = _mm_movemask_epi8(_mm_cmpeq_epi8(cur, prev));
+    if (same == 0) {
+      for (int i = 0; i < 16; ++i) n += val_count[src[c + i]]++ == 0;
+    } else {
+      n += count_color_runs(src + c, (~same & 0xffff) | 1, 16, val_count);
+    }
+  }
+  for (; c < width; ++c) n += val_count[src[c]]++ == 0;
+  return n;
+}
+
+int av1_count_colors_row_highbd_sse2(const uint16_t *src, int width,
+                                     int bit_depth, int *val_count,
+                                     int *bin_val_count) {
+  const int shift = bit_depth - 8;
+  int n = count_color_runs_highbd(src, 1, 1, shift, val_count, bin_val_count);
+  int c = 1;
+  for (; c + 16 <= width; c += 16) {
+    const __m128i cur0 = _mm_loadu_si128((const __m128i *)(src + c));
+    const __m128i cur1 = _mm_loadu_si128((const __m128i *)(src + c + 8));
+    const __m128i prev0 = _mm_loadu_si128((const __m128i *)(src + c - 1));
+    const __m128i prev1 = _mm_loadu_si128((const __m128i *)(src + c + 7));
+    const __m128i same16 = _mm_packs_epi16(_mm_cmpeq_epi16(cur0, prev0),
+                                           _mm_cmpeq_epi16(cur1, prev1));
+    const unsigned int same = _mm_movemask_epi8(same16);
+    n += count_color_runs_highbd(src + c, (~same & 0xffff) | 1, 16, shift,
+                                 val_count, bin_val_count);
+  }
+  for (; c < width; ++c) {
+    n += count_color_runs_highbd(src + c, 1, 1, shift, val_count,
+                                 bin_val_count);
+  }
+  return n;
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#ifndef AOM_AV1_ENCODER_X86_PALETTE_X86_H_
+#define AOM_AV1_ENCODER_X86_PALETTE_X86_H_
+
+#include "aom_ports/bitops.h"
+
+// Adds the len pixels at src to the histogram, one run of equal pixels at a
+// time. Bit i of starts is set if a run starts at src[i]; bit 0 must be set.
+// Returns the number of colors that were not in the histogram before.
+//
+// Screen content has long runs of equal pixels, which are counted here with
+// one histogram update per run instead of one per pixel.
+static inline int count_color_runs(const uint8_t *src, unsigned int starts,
+                                   int len, int *val_count) {
+  int n = 0;
+  int end = len;
+  do {
+    const int start = get_msb(starts);
+    const int val = src[start];
+    n += val_count[val] == 0;
+    val_count[val] += end - start;
+    end = start;
+    starts ^= 1u << start;
+  } while (starts);
+  return n;
+}
+
+// High bitdepth version of count_color_runs(). Counts into the 8-bit bins of
+// bin_val_count, and into val_count if it is not NULL, and returns the number
+// of new bins.
+static inline int count_color_runs_highbd(const uint16_t *src,
+                                          unsigned int starts, int len,
+                                          int shift, int *val_count,
+                                          int *bin_val_count) {
+  int n = 0;
+  int end = len;
+  do {
+    const int start = get_msb(starts);
+    const int val = src[start];
+    const int bin = val >> shift;
+    if (bin < (1 << 8)) {
+      n += bin_val_count[bin] == 0;
+      bin_val_count[bin] += end - start;
+      if (val_count != NULL) val_count[val] += end - start;
+    }
+    end = start;
+    starts ^= 1u << start;
+  } while (starts);
+  return n;
+}
+
+#endif  // AOM_AV1_ENCODER_X86_PALETTE_X86_H_
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <assert.h>
+#include <immintrin.h>  // AVX2
+
+#include "config/aom_config.h"
+#include "config/aom_dsp_rtcd.h"
+#include "config/av1_rtcd.h"
+
+#include "aom/aom_integer.h"
+#include "aom_dsp/x86/synonyms.h"
+#include "aom_dsp/x86/synonyms_avx2.h"
+
+#include "av1/common/av1_common_int.h"
+#include "av1/common/blockd.h"
+#include "av1/encoder/reconinter_enc.h"
+
+// The sub-pixel cases are dominated by aom_convolve8_horiz/vert(), which
+// already dispatch to their AVX2 versions from the SSE2 function, so only the
+// full-pixel copy and the compound average are specialized here. Narrow
+// blocks gain nothing from the wider registers and use the SSE2 code.
+
+void aom_upsampled_pred_avx2(MACROBLOCKD *xd, const struct AV1Common *const cm,
+                             int mi_row, int mi_col, const MV *const mv,
+                             uint8_t *comp_pred, int width, int height,
+                             int subpel_x_q3, int subpel_y_q3,
+                             const uint8_t *ref, int ref_stride,
+                             int subpel_search) {
+  if (subpel_x_q3 || subpel_y_q3 || width < 16) {
+    aom_upsampled_pred_sse2(xd, cm, mi_row, mi_col, mv, comp_pred, width,
+                            height, subpel_x_q3, subpel_y_q3, ref, ref_stride,
+                            subpel_search);
+    return;
+  }
+  if (aom_upsampled_pred_scaled(xd, cm, mi_row, mi_col, mv, comp_pred, width,
+                                height)) {
+    return;
+  }
+
+  if (width == 16) {
+    assert(!(height & 1));
+    /*Read 16 pixels two rows at a time.*/
+    for (int i = 0; i < height; i += 2) {
+      yy_storeu_256(comp_pred, yy_loadu2_128(ref + ref_stride, ref));
+      comp_pred += 32;
+      ref += 2 * ref_stride;
+    }
+  } else {
+    assert(!(width & 31));
+    /*Read 32 pixels one row at a time.*/
+    for (int i = 0; i < height; i++) {
+      for (int j = 0; j < width; j += 32) {
+        yy_storeu_256(comp_pred + j, yy_loadu_256(ref + j));
+      }
+      comp_pred += width;
+      ref += ref_stride;
+    }
+  }
+}
+
+void aom_comp_avg_upsampled_pred_avx2(
+    MACROBLOCKD *xd, const struct AV1Common *const cm, int mi_row, int mi_col,
+    const MV *const mv, uint8_t *comp_pred, const uint8_t *pred, int width,
+    int height, int subpel_x_q3, int subpel_y_q3, const uint8_t *ref,
+    int ref_stride, int subpel_search) {
+  if (width < 8) {
+    aom_comp_avg_upsampled_pred_sse2(xd, cm, mi_row, mi_col, mv, comp_pred,
+                                     pred, width, height, subpel_x_q3,
+                                     subpel_y_q3, ref, ref_stride,
+                                     subpel_search);
+    return;
+  }
+
+  const int is_full_pel = !subpel_x_q3 && !subpel_y_q3;
+  if (is_full_pel && !aom_upsampled_pred_scaled(xd, cm, mi_row, mi_col, mv,
+                                                comp_pred, width, height)) {
+    // The upsampled prediction would be a plain copy of the reference, so
+    // average straight from the reference instead.
+    aom_comp_avg_pred_avx2(comp_pred, pred, width, height, ref, ref_stride);
+    return;
+  }
+
+  // A scaled full-pel prediction has been built by the check above.
+  if (!is_full_pel) {
+    aom_upsampled_pred(xd, cm, mi_row, mi_col, mv, comp_pred, width, height,
+                       subpel_x_q3, subpel_y_q3, ref, ref_stride,
+                       subpel_search);
+  }
+  aom_comp_avg_pred_avx2(comp_pred, pred, width, height, comp_pred, width);
+}
+
+#if CONFIG_AV1_HIGHBITDEPTH
+void aom_highbd_upsampled_pred_avx2(MACROBLOCKD *xd,
+                                    const struct AV1Common *const cm,
+                                    int mi_row, int mi_col, const MV *const mv,
+                                    uint8_t *comp_pred8, int width, int height,
+                                    int subpel_x_q3, int subpel_y_q3,
+                                    const uint8_t *ref8, int ref_stride, int bd,
+                                    int subpel_search) {
+  if (subpel_x_q3 || subpel_y_q3 || width < 8) {
+    aom_highbd_upsampled_pred_sse2(xd, cm, mi_row, mi_col, mv, comp_pred8,
+                                   width, height, subpel_x_q3, subpel_y_q3,
+                                   ref8, ref_stride, bd, subpel_search);
+    return;
+  }
+  if (aom_upsampled_pred_scaled(xd, cm, mi_row, mi_col, mv, comp_pred8, width,
+                                height)) {
+    return;
+  }
+
+  const uint16_t *ref = CONVERT_TO_SHORTPTR(ref8);
+  uint16_t *comp_pred = CONVERT_TO_SHORTPTR(comp_pred8);
+  if (width == 8) {
+    assert(!(height & 1));
+    /*Read 8 pixels two rows at a time.*/
+    for (int i = 0; i < height; i += 2) {
+      yy_storeu_256(comp_pred, yy_loadu2_128(ref + ref_stride, ref));
+      comp_pred += 16;
+      ref += 2 * ref_stride;
+    }
+  } else {
+    assert(!(width & 15));
+    /*Read 16 pixels one row at a time.*/
+    for (int i = 0; i < height; i++) {
+      for (int j = 0; j < width; j += 16) {
+        yy_storeu_256(comp_pred + j, yy_loadu_256(ref + j));
+      }
+      comp_pred += width;
+      ref += ref_stride;
+    }
+  }
+}
+
+// Computes comp_pred = avg(pred, ref), where pred and comp_pred are
+// contiguous width x height blocks. ref may alias comp_pred.
+static inline void highbd_comp_avg_pred_avx2(uint16_t *comp_pred,
+                                             const uint16_t *pred, int width,
+                                             int height, const uint16_t *ref,
+                                             int ref_stride) {
+  if (width == 8) {
+    assert(!(height & 1));
+    for (int i = 0; i < height; i += 2) {
+      const __m256i r = yy_loadu2_128(ref + ref_stride, ref);
+      const __m256i p = yy_loadu_256(pred);
+      yy_storeu_256(comp_pred, _mm256_avg_epu16(r, p));
+      comp_pred += 16;
+      pred += 16;
+      ref += 2 * ref_stride;
+    }
+  } else {
+    assert(!(width & 15));
+    for (int i = 0; i < height; i++) {
+      for (int j = 0; j < width; j += 16) {
+        const __m256i r = yy_loadu_256(ref + j);
+        const __m256i p = yy_loadu_256(pred + j);
+        yy_storeu_256(comp_pred + j, _mm256_avg_epu16(r, p));
+      }
+      comp_pred += width;
+      pred += width;
+      ref += ref_stride;
+    }
+  }
+}
+
+void aom_highbd_comp_avg_upsampled_pred_avx2(
+    MACROBLOCKD *xd, const struct AV1Common *const cm, int mi_row, int mi_col,
+    const MV *const mv, uint8_t *comp_pred8, const uint8_t *pred8, int width,
+    int height, int subpel_x_q3, int subpel_y_q3, const uint8_t *ref8,
+    int ref_stride, int bd, int subpel_search) {
+  if (width < 8) {
+    aom_highbd_comp_avg_upsampled_pred_sse2(
+        xd, cm, mi_row, mi_col, mv, comp_pred8, pred8, width, height,
+        subpel_x_q3, subpel_y_q3, ref8, ref_stride, bd, subpel_search);
+    return;
+  }
+
+  uint16_t *comp_pred = CONVERT_TO_SHORTPTR(comp_pred8);
+  const uint16_t *pred = CONVERT_TO_SHORTPTR(pred8);
+  const int is_full_pel = !subpel_x_q3 && !subpel_y_q3;
+  if (is_full_pel && !aom_upsampled_pred_scaled(xd, cm, mi_row, mi_col, mv,
+                                                comp_pred8, width, height)) {
+    // The upsampled prediction would be a plain copy of the reference, so
+    // average straight from the reference instead.
+    highbd_comp_avg_pred_avx2(comp_pred, pred, width, height,
+                              CONVERT_TO_SHORTPTR(ref8), ref_stride);
+    return;
+  }
+
+  // A scaled full-pel prediction has been built by the check above.
+  if (!is_full_pel) {
+    aom_highbd_upsampled_pred(xd, cm, mi_row, mi_col, mv, comp_pred8, width,
+                              height, subpel_x_q3, subpel_y_q3, ref8,
+                              ref_stride, bd, subpel_search);
+  }
+  highbd_comp_avg_pred_avx2(comp_pred, pred, width, height, comp_pred, width);
+}
+#endif  // CONFIG_AV1_HIGHBITDEPTH
@@ -52,6 +52,7 @@ set_aom_detect_var(HAVE_SSE4_2 0 "Enables SSE 4.2 optimizations.")
 set_aom_detect_var(HAVE_AVX 0 "Enables AVX optimizations.")
 set_aom_detect_var(HAVE_AVX2 0 "Enables AVX2 optimizations.")
 set_aom_detect_var(HAVE_AVX512 0 "Enables AVX512 optimizations.")
+set_aom_detect_var(HAVE_AVXVNNI 0 "Enables AVX-VNNI optimizations.")
 
 # RISC-V64 feature flags.
 set_aom_detect_var(HAVE_RVV 0 "Enables RVV optimizations.")
@@ -249,6 +250,8 @@ set_aom_option_var(ENABLE_AVX2
                    "Enables AVX2 optimizations on x86/x86_64 targets." ON)
 set_aom_option_var(ENABLE_AVX512
                    "Enables AVX512 optimizations on x86/x86_64 targets." ON)
+set_aom_option_var(ENABLE_AVXVNNI
+                   "Enables AVX-VNNI optimizations on x86_64 targets." ON)
 
 # RVV intrinsics flags.
 set_aom_option_var(ENABLE_RVV "Enables RVV optimizations on RISC-V targets." ON)
@@ -20,7 +20,7 @@ include("${AOM_ROOT}/cmake/util.cmake")
 function(get_msvc_intrinsic_flag flag translated_flag)
   if("${flag}" STREQUAL "-mavx")
     set(${translated_flag} "/arch:AVX" PARENT_SCOPE)
-  elseif("${flag}" STREQUAL "-mavx2")
+  elseif("${flag}" STREQUAL "-mavx2" OR "${flag}" STREQUAL "-mavxvnni")
     set(${translated_flag} "/arch:AVX2" PARENT_SCOPE)
   else()
 
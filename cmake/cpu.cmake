@@ -130,6 +130,29 @@ elseif("${AOM_TARGET_CPU}" MATCHES "^x86")
       set(AOM_RTCD_FLAGS ${AOM_RTCD_FLAGS} --disable-${flavor})
     endif()
   endforeach()
+
+  # AVX-VNNI is not part of the flavor chain above: AVX512 cores need not
+  # implement it, so disabling it must not disable AVX512. It is only used on
+  # x86_64, like AVX512.
+  if(ENABLE_AVXVNNI
+     AND HAVE_AVX2
+     AND "${AOM_TARGET_CPU}" STREQUAL "x86_64")
+    if(NOT MSVC)
+      unset(FLAG_SUPPORTED)
+      check_c_compiler_flag("-mavxvnni" FLAG_SUPPORTED)
+      if(NOT ${FLAG_SUPPORTED})
+        set(ENABLE_AVXVNNI 0)
+      endif()
+    endif()
+  else()
+    set(ENABLE_AVXVNNI 0)
+  endif()
+  if(ENABLE_AVXVNNI)
+    set(HAVE_AVXVNNI 1)
+  else()
+    set(HAVE_AVXVNNI 0)
+    set(AOM_RTCD_FLAGS ${AOM_RTCD_FLAGS} --disable-avxvnni)
+  endif()
 elseif("${AOM_TARGET_CPU}" MATCHES "riscv")
   set(AOM_ARCH_RISCV64 1)
 
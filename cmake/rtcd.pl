@@ -421,7 +421,7 @@ EOF
 # List of architectures in low-to-high preference order.
 my @PRIORITY_ARCH = qw/
   c
-  mmx sse sse2 sse3 ssse3 sse4_1 sse4_2 avx avx2
+  mmx sse sse2 sse3 ssse3 sse4_1 sse4_2 avx avx2 avxvnni
   arm_crc32 neon neon_dotprod neon_i8mm sve sve2
   rvv
   vsx
@@ -443,7 +443,7 @@ if ($opts{arch} eq 'x86') {
   x86;
 } elsif ($opts{arch} eq 'x86_64') {
   @ALL_ARCHS = filter(qw/mmx sse sse2 sse3 ssse3 sse4_1 sse4_2 avx avx2
-                         avx512/);
+                         avxvnni avx512/);
   if (keys %required == 0) {
     @REQUIRES = filter(qw/mmx sse sse2/);
     &require(@REQUIRES);
@@ -13,6 +13,7 @@
 
 #include <cstdio>
 #include <cstddef>
+#include <cstdlib>
 
 #include "gtest/gtest.h"
 
@@ -32,3 +33,83 @@ TEST(AomMemTest, NullParams) {
   ASSERT_EQ(aom_memset16(nullptr, 0, 0), nullptr);
   aom_free(nullptr);
 }
+
+TEST(AomMemTest, UsageByTag) {
+  aom_mem_usage_t tpl_before, pyramid_before, total_before;
+  ASSERT_EQ(aom_mem_get_usage(AOM_MEM_TAG_TPL, &tpl_before), 0);
+  ASSERT_EQ(aom_mem_get_usage(AOM_MEM_TAG_PYRAMID, &pyramid_before), 0);
+  ASSERT_EQ(aom_mem_get_usage(AOM_MEM_TAG_COUNT, &total_before), 0);
+
+  void *const mem = aom_memalign_tagged(AOM_MEM_TAG_TPL, 64, 1000);
+  ASSERT_NE(mem, nullptr);
+  aom_mem_usage_t usage;
+  ASSERT_EQ(aom_mem_get_usage(AOM_MEM_TAG_TPL, &usage), 0);
+  EXPECT_GE(usage.live_bytes, tpl_before.live_bytes + 1000);
+  EXPECT_GE(usage.peak_bytes, usage.live_bytes);
+  const size_t mem_bytes = usage.live_bytes - tpl_before.live_bytes;
+  ASSERT_EQ(aom_mem_get_usage(AOM_MEM_TAG_COUNT, &usage), 0);
+  EXPECT_EQ(usage.live_bytes, total_before.live_bytes + mem_bytes);
+
+  aom_mem_set_tag(mem, AOM_MEM_TAG_PYRAMID);
+  ASSERT_EQ(aom_mem_get_usage(AOM_MEM_TAG_TPL, &usage), 0);
+  EXPECT_EQ(usage.live_bytes, tpl_before.live_bytes);
+  ASSERT_EQ(aom_mem_get_usage(AOM_MEM_TAG_PYRAMID, &usage), 0);
+  EXPECT_EQ(usage.live_bytes, pyramid_before.live_bytes + mem_bytes);
+
+  aom_free(mem);
+  ASSERT_EQ(aom_mem_get_usage(AOM_MEM_TAG_PYRAMID, &usage), 0);
+  EXPECT_EQ(usage.live_bytes, pyramid_before.live_bytes);
+  EXPECT_GE(usage.peak_bytes, pyramid_before.live_bytes + mem_bytes);
+  aom_mem_reset_peak_usage();
+  ASSERT_EQ(aom_mem_get_usage(AOM_MEM_TAG_PYRAMID, &usage), 0);
+  EXPECT_EQ(usage.peak_bytes, usage.live_bytes);
+
+  EXPECT_EQ(aom_mem_get_usage(AOM_MEM_TAG_COUNT, nullptr), -1);
+  EXPECT_EQ(aom_mem_get_usage(static_cast<aom_mem_tag_t>(-1), &usage), -1);
+}
+
+namespace {
+
+struct HookCounts {
+  int allocs;
+  int frees;
+};
+
+void *CountingAlloc(void *priv, size_t size) {
+  ++static_cast<HookCounts *>(priv)->allocs;
+  return malloc(size);
+}
+
+void CountingFree(void *priv, void *ptr) {
+  ++static_cast<HookCounts *>(priv)->frees;
+  free(ptr);
+}
+
+}  // namespace
+
+TEST(AomMemTest, Hooks) {
+  aom_mem_usage_t total;
+  ASSERT_EQ(aom_mem_get_usage(AOM_MEM_TAG_COUNT, &total), 0);
+  if (total.live_bytes != 0) {
+    GTEST_SKIP() << "libaom still holds memory from an earlier test";
+  }
+
+  HookCounts counts = { 0, 0 };
+  const aom_mem_hooks_t incomplete = { CountingAlloc, nullptr, &counts };
+  EXPECT_EQ(aom_mem_set_hooks(&incomplete), -1);
+  const aom_mem_hooks_t hooks = { CountingAlloc, CountingFree, &counts };
+  ASSERT_EQ(aom_mem_set_hooks(&hooks), 0);
+
+  void *const mem = aom_malloc(100);
+  ASSERT_NE(mem, nullptr);
+  EXPECT_EQ(counts.allocs, 1);
+  // The hooks cannot change while memory from them is live.
+  EXPECT_EQ(aom_mem_set_hooks(nullptr), -1);
+  aom_free(mem);
+  EXPECT_EQ(counts.frees, 1);
+
+  ASSERT_EQ(aom_mem_set_hooks(nullptr), 0);
+  aom_free(aom_malloc(100));
+  EXPECT_EQ(counts.allocs, 1);
+  EXPECT_EQ(counts.frees, 1);
+}
@@ -423,6 +423,11 @@ INSTANTIATE_TEST_SUITE_P(AVX2, AV1ConvolveXTest,
                          BuildLowbdParams(av1_convolve_x_sr_avx2));
 #endif
 
+#if CONFIG_HIGHWAY && HAVE_AVX512
+INSTANTIATE_TEST_SUITE_P(AVX512, AV1ConvolveXTest,
+                         BuildLowbdParams(av1_convolve_x_sr_avx512));
+#endif
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(NEON, AV1ConvolveXTest,
                          BuildLowbdParams(av1_convolve_x_sr_neon));
@@ -640,6 +645,11 @@ INSTANTIATE_TEST_SUITE_P(AVX2, AV1ConvolveXHighbdTest,
                          BuildHighbdParams(av1_highbd_convolve_x_sr_avx2));
 #endif
 
+#if CONFIG_HIGHWAY && HAVE_AVX512
+INSTANTIATE_TEST_SUITE_P(AVX512, AV1ConvolveXHighbdTest,
+                         BuildHighbdParams(av1_highbd_convolve_x_sr_avx512));
+#endif
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(NEON, AV1ConvolveXHighbdTest,
                          BuildHighbdParams(av1_highbd_convolve_x_sr_neon));
@@ -848,6 +858,11 @@ INSTANTIATE_TEST_SUITE_P(AVX2, AV1ConvolveYTest,
                          BuildLowbdParams(av1_convolve_y_sr_avx2));
 #endif
 
+#if CONFIG_HIGHWAY && HAVE_AVX512
+INSTANTIATE_TEST_SUITE_P(AVX512, AV1ConvolveYTest,
+                         BuildLowbdParams(av1_convolve_y_sr_avx512));
+#endif
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(NEON, AV1ConvolveYTest,
                          BuildLowbdParams(av1_convolve_y_sr_neon));
@@ -1045,6 +1060,11 @@ INSTANTIATE_TEST_SUITE_P(AVX2, AV1ConvolveYHighbdTest,
                          BuildHighbdParams(av1_highbd_convolve_y_sr_avx2));
 #endif
 
+#if CONFIG_HIGHWAY && HAVE_AVX512
+INSTANTIATE_TEST_SUITE_P(AVX512, AV1ConvolveYHighbdTest,
+                         BuildHighbdParams(av1_highbd_convolve_y_sr_avx512));
+#endif
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(NEON, AV1ConvolveYHighbdTest,
                          BuildHighbdParams(av1_highbd_convolve_y_sr_neon));
@@ -1360,6 +1380,11 @@ INSTANTIATE_TEST_SUITE_P(AVX2, AV1Convolve2DTest,
                          BuildLowbdParams(av1_convolve_2d_sr_avx2));
 #endif
 
+#if CONFIG_HIGHWAY && HAVE_AVX512
+INSTANTIATE_TEST_SUITE_P(AVX512, AV1Convolve2DTest,
+                         BuildLowbdParams(av1_convolve_2d_sr_avx512));
+#endif
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(NEON, AV1Convolve2DTest,
                          BuildLowbdParams(av1_convolve_2d_sr_neon));
@@ -1603,6 +1628,11 @@ INSTANTIATE_TEST_SUITE_P(AVX2, AV1Convolve2DHighbdTest,
                          BuildHighbdParams(av1_highbd_convolve_2d_sr_avx2));
 #endif
 
+#if CONFIG_HIGHWAY && HAVE_AVX512
+INSTANTIATE_TEST_SUITE_P(AVX512, AV1Convolve2DHighbdTest,
+                         BuildHighbdParams(av1_highbd_convolve_2d_sr_avx512));
+#endif
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(NEON, AV1Convolve2DHighbdTest,
                          BuildHighbdParams(av1_highbd_convolve_2d_sr_neon));
@@ -1934,6 +1964,11 @@ INSTANTIATE_TEST_SUITE_P(AVX2, AV1ConvolveXCompoundTest,
                          BuildLowbdLumaParams(av1_dist_wtd_convolve_x_avx2));
 #endif
 
+#if CONFIG_HIGHWAY && HAVE_AVX512
+INSTANTIATE_TEST_SUITE_P(AVX512, AV1ConvolveXCompoundTest,
+                         BuildLowbdLumaParams(av1_dist_wtd_convolve_x_avx512));
+#endif
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(NEON, AV1ConvolveXCompoundTest,
                          BuildLowbdLumaParams(av1_dist_wtd_convolve_x_neon));
@@ -2045,6 +2080,12 @@ INSTANTIATE_TEST_SUITE_P(
     BuildHighbdLumaParams(av1_highbd_dist_wtd_convolve_x_avx2));
 #endif
 
+#if CONFIG_HIGHWAY && HAVE_AVX512
+INSTANTIATE_TEST_SUITE_P(
+    AVX512, AV1ConvolveXHighbdCompoundTest,
+    BuildHighbdLumaParams(av1_highbd_dist_wtd_convolve_x_avx512));
+#endif
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(
     NEON, AV1ConvolveXHighbdCompoundTest,
@@ -2098,6 +2139,11 @@ INSTANTIATE_TEST_SUITE_P(AVX2, AV1ConvolveYCompoundTest,
                          BuildLowbdLumaParams(av1_dist_wtd_convolve_y_avx2));
 #endif
 
+#if CONFIG_HIGHWAY && HAVE_AVX512
+INSTANTIATE_TEST_SUITE_P(AVX512, AV1ConvolveYCompoundTest,
+                         BuildLowbdLumaParams(av1_dist_wtd_convolve_y_avx512));
+#endif
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(NEON, AV1ConvolveYCompoundTest,
                          BuildLowbdLumaParams(av1_dist_wtd_convolve_y_neon));
@@ -2154,6 +2200,12 @@ INSTANTIATE_TEST_SUITE_P(
     BuildHighbdLumaParams(av1_highbd_dist_wtd_convolve_y_avx2));
 #endif
 
+#if CONFIG_HIGHWAY && HAVE_AVX512
+INSTANTIATE_TEST_SUITE_P(
+    AVX512, AV1ConvolveYHighbdCompoundTest,
+    BuildHighbdLumaParams(av1_highbd_dist_wtd_convolve_y_avx512));
+#endif
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(
     NEON, AV1ConvolveYHighbdCompoundTest,
@@ -2290,6 +2342,12 @@ INSTANTIATE_TEST_SUITE_P(
     BuildLowbdLumaParams(av1_dist_wtd_convolve_2d_copy_avx2));
 #endif
 
+#if CONFIG_HIGHWAY && HAVE_AVX512
+INSTANTIATE_TEST_SUITE_P(
+    AVX512, AV1Convolve2DCopyCompoundTest,
+    BuildLowbdLumaParams(av1_dist_wtd_convolve_2d_copy_avx512));
+#endif
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(
     NEON, AV1Convolve2DCopyCompoundTest,
@@ -2380,6 +2438,12 @@ INSTANTIATE_TEST_SUITE_P(
     BuildHighbdLumaParams(av1_highbd_dist_wtd_convolve_2d_copy_avx2));
 #endif
 
+#if CONFIG_HIGHWAY && HAVE_AVX512
+INSTANTIATE_TEST_SUITE_P(
+    AVX512, AV1Convolve2DCopyHighbdCompoundTest,
+    BuildHighbdLumaParams(av1_highbd_dist_wtd_convolve_2d_copy_avx512));
+#endif
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(
     NEON, AV1Convolve2DCopyHighbdCompoundTest,
@@ -2482,6 +2546,11 @@ INSTANTIATE_TEST_SUITE_P(AVX2, AV1Convolve2DCompoundTest,
                          BuildLowbdLumaParams(av1_dist_wtd_convolve_2d_avx2));
 #endif
 
+#if CONFIG_HIGHWAY && HAVE_AVX512
+INSTANTIATE_TEST_SUITE_P(AVX512, AV1Convolve2DCompoundTest,
+                         BuildLowbdLumaParams(av1_dist_wtd_convolve_2d_avx512));
+#endif
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(NEON, AV1Convolve2DCompoundTest,
                          BuildLowbdLumaParams(av1_dist_wtd_convolve_2d_neon));
@@ -2597,6 +2666,12 @@ INSTANTIATE_TEST_SUITE_P(
     BuildHighbdLumaParams(av1_highbd_dist_wtd_convolve_2d_avx2));
 #endif
 
+#if CONFIG_HIGHWAY && HAVE_AVX512
+INSTANTIATE_TEST_SUITE_P(
+    AVX512, AV1Convolve2DHighbdCompoundTest,
+    BuildHighbdLumaParams(av1_highbd_dist_wtd_convolve_2d_avx512));
+#endif
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(
     NEON, AV1Convolve2DHighbdCompoundTest,
@@ -2617,4 +2692,196 @@ INSTANTIATE_TEST_SUITE_P(
 
 #endif  // CONFIG_AV1_HIGHBITDEPTH
 
+#if CONFIG_HIGHWAY && HAVE_AVX512
+//////////////////////////////////////////////////////////
+// Per-kernel speed of the AVX-512 convolutions
+//////////////////////////////////////////////////////////
+
+// Times the C, AVX2 and AVX-512 versions of a kernel with 'call' and prints
+// one row of the speedup table.
+template <typename T, typename Call>
+void PrintConvolveSpeed(const char *name, int size, const T (&funcs)[3],
+                        const Call &call) {
+  const int num_iters = 1000 * 64 * 64 / (size * size);
+  double time[3];
+  for (int i = 0; i < 3; ++i) {
+    aom_usec_timer timer;
+    aom_usec_timer_start(&timer);
+    for (int n = 0; n < num_iters; ++n) {
+      call(funcs[i]);
+    }
+    aom_usec_timer_mark(&timer);
+    time[i] = static_cast<double>(aom_usec_timer_elapsed(&timer)) / num_iters;
+  }
+  printf("%-36s %3dx%-3d %9.2f %9.2f %9.2f %7.2fx %7.2fx\n", name, size, size,
+         time[0], time[1], time[2], time[0] / time[2], time[1] / time[2]);
+}
+
+TEST(AVX512_AV1ConvolveSpeedTest, DISABLED_SpeedTable) {
+  constexpr int kStride = MAX_SB_SIZE + 16;
+  constexpr int kSubpel = 8;
+  libaom_test::ACMRandom rnd(libaom_test::ACMRandom::DeterministicSeed());
+  std::vector<uint8_t> input8(kStride * kStride);
+  for (uint8_t &p : input8) p = rnd.Rand8();
+  const uint8_t *src8 = input8.data() + 8 * kStride + 8;
+  DECLARE_ALIGNED(32, uint8_t, dst8[MAX_SB_SQUARE]);
+  DECLARE_ALIGNED(32, CONV_BUF_TYPE, conv_buf[MAX_SB_SQUARE]);
+  memset(conv_buf, 0, sizeof(conv_buf));
+#if CONFIG_AV1_HIGHBITDEPTH
+  constexpr int kBitDepth = 10;
+  std::vector<uint16_t> input16(kStride * kStride);
+  for (uint16_t &p : input16) p = rnd.Rand16() & ((1 << kBitDepth) - 1);
+  const uint16_t *src16 = input16.data() + 8 * kStride + 8;
+  DECLARE_ALIGNED(32, uint16_t, dst16[MAX_SB_SQUARE]);
+#endif
+
+  printf("%-36s %7s %9s %9s %9s %8s %8s\n", "kernel (us per block)", "block",
+         "C", "AVX2", "AVX512", "vs C", "vs AVX2");
+  for (int size : { 64, 128 }) {
+    const InterpFilterParams *fp =
+        av1_get_interp_filter_params_with_block_size(EIGHTTAP_REGULAR, size);
+    ConvolveParams sr = get_conv_params_no_round(0, 0, nullptr, 0, 0, 8);
+    // Second prediction of a distance weighted compound.
+    ConvolveParams comp =
+        get_conv_params_no_round(1, 0, conv_buf, MAX_SB_SIZE, 1, 8);
+    comp.use_dist_wtd_comp_avg = 1;
+    comp.fwd_offset = quant_dist_lookup_table[0][0];
+    comp.bck_offset = quant_dist_lookup_table[0][1];
+
+    const convolve_x_func x_sr[] = { av1_convolve_x_sr_c,
+                                     av1_convolve_x_sr_avx2,
+                                     av1_convolve_x_sr_avx512 };
+    PrintConvolveSpeed("av1_convolve_x_sr", size, x_sr, [&](convolve_x_func f) {
+      f(src8, kStride, dst8, MAX_SB_SIZE, size, size, fp, kSubpel, &sr);
+    });
+    const convolve_y_func y_sr[] = { av1_convolve_y_sr_c,
+                                     av1_convolve_y_sr_avx2,
+                                     av1_convolve_y_sr_avx512 };
+    PrintConvolveSpeed("av1_convolve_y_sr", size, y_sr, [&](convolve_y_func f) {
+      f(src8, kStride, dst8, MAX_SB_SIZE, size, size, fp, kSubpel);
+    });
+    const convolve_2d_func sr_2d[] = { av1_convolve_2d_sr_c,
+                                       av1_convolve_2d_sr_avx2,
+                                       av1_convolve_2d_sr_avx512 };
+    PrintConvolveSpeed(
+        "av1_convolve_2d_sr", size, sr_2d, [&](convolve_2d_func f) {
+          f(src8, kStride, dst8, MAX_SB_SIZE, size, size, fp, fp, kSubpel,
+            kSubpel, &sr);
+        });
+    const convolve_x_func dist_wtd_x[] = { av1_dist_wtd_convolve_x_c,
+                                           av1_dist_wtd_convolve_x_avx2,
+                                           av1_dist_wtd_convolve_x_avx512 };
+    PrintConvolveSpeed(
+        "av1_dist_wtd_convolve_x", size, dist_wtd_x, [&](convolve_x_func f) {
+          f(src8, kStride, dst8, MAX_SB_SIZE, size, size, fp, kSubpel, &comp);
+        });
+    const convolve_x_func dist_wtd_y[] = { av1_dist_wtd_convolve_y_c,
+                                           av1_dist_wtd_convolve_y_avx2,
+                                           av1_dist_wtd_convolve_y_avx512 };
+    PrintConvolveSpeed(
+        "av1_dist_wtd_convolve_y", size, dist_wtd_y, [&](convolve_x_func f) {
+          f(src8, kStride, dst8, MAX_SB_SIZE, size, size, fp, kSubpel, &comp);
+        });
+    const convolve_2d_func dist_wtd_2d[] = { av1_dist_wtd_convolve_2d_c,
+                                             av1_dist_wtd_convolve_2d_avx2,
+                                             av1_dist_wtd_convolve_2d_avx512 };
+    PrintConvolveSpeed(
+        "av1_dist_wtd_convolve_2d", size, dist_wtd_2d, [&](convolve_2d_func f) {
+          f(src8, kStride, dst8, MAX_SB_SIZE, size, size, fp, fp, kSubpel,
+            kSubpel, &comp);
+        });
+    const compound_conv_2d_copy_func dist_wtd_copy[] = {
+      av1_dist_wtd_convolve_2d_copy_c, av1_dist_wtd_convolve_2d_copy_avx2,
+      av1_dist_wtd_convolve_2d_copy_avx512
+    };
+    PrintConvolveSpeed("av1_dist_wtd_convolve_2d_copy", size, dist_wtd_copy,
+                       [&](compound_conv_2d_copy_func f) {
+                         f(src8, kStride, dst8, MAX_SB_SIZE, size, size, &comp);
+                       });
+
+#if CONFIG_AV1_HIGHBITDEPTH
+    ConvolveParams hbd_sr =
+        get_conv_params_no_round(0, 0, nullptr, 0, 0, kBitDepth);
+    ConvolveParams hbd_comp =
+        get_conv_params_no_round(1, 0, conv_buf, MAX_SB_SIZE, 1, kBitDepth);
+    hbd_comp.use_dist_wtd_comp_avg = 1;
+    hbd_comp.fwd_offset = quant_dist_lookup_table[0][0];
+    hbd_comp.bck_offset = quant_dist_lookup_table[0][1];
+
+    const highbd_convolve_x_func hbd_x_sr[] = {
+      av1_highbd_convolve_x_sr_c, av1_highbd_convolve_x_sr_avx2,
+      av1_highbd_convolve_x_sr_avx512
+    };
+    PrintConvolveSpeed(
+        "av1_highbd_convolve_x_sr", size, hbd_x_sr,
+        [&](highbd_convolve_x_func f) {
+          f(src16, kStride, dst16, MAX_SB_SIZE, size, size, fp, kSubpel,
+            &hbd_sr, kBitDepth);
+        });
+    const highbd_convolve_y_func hbd_y_sr[] = {
+      av1_highbd_convolve_y_sr_c, av1_highbd_convolve_y_sr_avx2,
+      av1_highbd_convolve_y_sr_avx512
+    };
+    PrintConvolveSpeed(
+        "av1_highbd_convolve_y_sr", size, hbd_y_sr,
+        [&](highbd_convolve_y_func f) {
+          f(src16, kStride, dst16, MAX_SB_SIZE, size, size, fp, kSubpel,
+            kBitDepth);
+        });
+    const highbd_convolve_2d_func hbd_sr_2d[] = {
+      av1_highbd_convolve_2d_sr_c, av1_highbd_convolve_2d_sr_avx2,
+      av1_highbd_convolve_2d_sr_avx512
+    };
+    PrintConvolveSpeed(
+        "av1_highbd_convolve_2d_sr", size, hbd_sr_2d,
+        [&](highbd_convolve_2d_func f) {
+          f(src16, kStride, dst16, MAX_SB_SIZE, size, size, fp, fp, kSubpel,
+            kSubpel, &hbd_sr, kBitDepth);
+        });
+    const highbd_convolve_x_func hbd_dist_wtd_x[] = {
+      av1_highbd_dist_wtd_convolve_x_c, av1_highbd_dist_wtd_convolve_x_avx2,
+      av1_highbd_dist_wtd_convolve_x_avx512
+    };
+    PrintConvolveSpeed(
+        "av1_highbd_dist_wtd_convolve_x", size, hbd_dist_wtd_x,
+        [&](highbd_convolve_x_func f) {
+          f(src16, kStride, dst16, MAX_SB_SIZE, size, size, fp, kSubpel,
+            &hbd_comp, kBitDepth);
+        });
+    const highbd_convolve_x_func hbd_dist_wtd_y[] = {
+      av1_highbd_dist_wtd_convolve_y_c, av1_highbd_dist_wtd_convolve_y_avx2,
+      av1_highbd_dist_wtd_convolve_y_avx512
+    };
+    PrintConvolveSpeed(
+        "av1_highbd_dist_wtd_convolve_y", size, hbd_dist_wtd_y,
+        [&](highbd_convolve_x_func f) {
+          f(src16, kStride, dst16, MAX_SB_SIZE, size, size, fp, kSubpel,
+            &hbd_comp, kBitDepth);
+        });
+    const highbd_convolve_2d_func hbd_dist_wtd_2d[] = {
+      av1_highbd_dist_wtd_convolve_2d_c, av1_highbd_dist_wtd_convolve_2d_avx2,
+      av1_highbd_dist_wtd_convolve_2d_avx512
+    };
+    PrintConvolveSpeed(
+        "av1_highbd_dist_wtd_convolve_2d", size, hbd_dist_wtd_2d,
+        [&](highbd_convolve_2d_func f) {
+          f(src16, kStride, dst16, MAX_SB_SIZE, size, size, fp, fp, kSubpel,
+            kSubpel, &hbd_comp, kBitDepth);
+        });
+    const highbd_compound_conv_2d_copy_func hbd_dist_wtd_copy[] = {
+      av1_highbd_dist_wtd_convolve_2d_copy_c,
+      av1_highbd_dist_wtd_convolve_2d_copy_avx2,
+      av1_highbd_dist_wtd_convolve_2d_copy_avx512
+    };
+    PrintConvolveSpeed(
+        "av1_highbd_dist_wtd_convolve_2d_copy", size, hbd_dist_wtd_copy,
+        [&](highbd_compound_conv_2d_copy_func f) {
+          f(src16, kStride, dst16, MAX_SB_SIZE, size, size, &hbd_comp,
+            kBitDepth);
+        });
+#endif  // CONFIG_AV1_HIGHBITDEPTH
+  }
+}
+#endif  // CONFIG_HIGHWAY && HAVE_AVX512
+
 }  // namespace
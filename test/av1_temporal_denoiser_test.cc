@@ -99,6 +99,48 @@ TEST_P(AV1DenoiserTest, BitexactCheck) {
   }
 }
 
+#if CONFIG_AV1_HIGHBITDEPTH
+// The high bitdepth filter scales its thresholds by the extra bits of
+// precision, so at a bit depth of 8 it must match the low bitdepth filter.
+TEST(AV1HighbdDenoiserTest, MatchesLowbdAt8Bit) {
+  ACMRandom rnd(ACMRandom::DeterministicSeed());
+  DECLARE_ALIGNED(16, uint8_t, sig_block[kNumPixels]);
+  DECLARE_ALIGNED(16, uint8_t, mc_avg_block[kNumPixels]);
+  DECLARE_ALIGNED(16, uint8_t, avg_block[kNumPixels]);
+  DECLARE_ALIGNED(16, uint16_t, sig_block16[kNumPixels]);
+  DECLARE_ALIGNED(16, uint16_t, mc_avg_block16[kNumPixels]);
+  DECLARE_ALIGNED(16, uint16_t, avg_block16[kNumPixels]);
+
+  for (int i = 0; i < 1000; ++i) {
+    const BLOCK_SIZE bs = static_cast<BLOCK_SIZE>(rnd(BLOCK_SIZES_ALL));
+    const int increase_denoising = rnd(2);
+    const int motion_magnitude =
+        rnd.Rand8() % static_cast<int>(MOTION_MAGNITUDE_THRESHOLD * 1.2);
+    for (int j = 0; j < kNumPixels; ++j) {
+      sig_block[j] = rnd.Rand8();
+      const int temp =
+          sig_block[j] + ((rnd.Rand8() % 2 == 0) ? -1 : 1) * (rnd.Rand8() % 20);
+      mc_avg_block[j] = (temp < 0) ? 0 : ((temp > 255) ? 255 : temp);
+      sig_block16[j] = sig_block[j];
+      mc_avg_block16[j] = mc_avg_block[j];
+    }
+
+    const int decision = av1_denoiser_filter_c(
+        sig_block, 128, mc_avg_block, 128, avg_block, 128, increase_denoising,
+        bs, motion_magnitude);
+    const int decision16 = av1_highbd_denoiser_filter_c(
+        sig_block16, 128, mc_avg_block16, 128, avg_block16, 128,
+        increase_denoising, bs, motion_magnitude, 8);
+    ASSERT_EQ(decision, decision16);
+    for (int h = 0; h < block_size_high[bs]; ++h) {
+      for (int w = 0; w < block_size_wide[bs]; ++w) {
+        ASSERT_EQ(avg_block[h * 128 + w], avg_block16[h * 128 + w]);
+      }
+    }
+  }
+}
+#endif  // CONFIG_AV1_HIGHBITDEPTH
+
 using std::make_tuple;
 
 // Test for all block size.
@@ -120,6 +162,24 @@ INSTANTIATE_TEST_SUITE_P(
                       make_tuple(&av1_denoiser_filter_sse2, BLOCK_128X128)));
 #endif  // HAVE_SSE2
 
+#if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, AV1DenoiserTest,
+    ::testing::Values(make_tuple(&av1_denoiser_filter_avx2, BLOCK_8X8),
+                      make_tuple(&av1_denoiser_filter_avx2, BLOCK_8X16),
+                      make_tuple(&av1_denoiser_filter_avx2, BLOCK_16X8),
+                      make_tuple(&av1_denoiser_filter_avx2, BLOCK_16X16),
+                      make_tuple(&av1_denoiser_filter_avx2, BLOCK_16X32),
+                      make_tuple(&av1_denoiser_filter_avx2, BLOCK_32X16),
+                      make_tuple(&av1_denoiser_filter_avx2, BLOCK_32X32),
+                      make_tuple(&av1_denoiser_filter_avx2, BLOCK_32X64),
+                      make_tuple(&av1_denoiser_filter_avx2, BLOCK_64X32),
+                      make_tuple(&av1_denoiser_filter_avx2, BLOCK_64X64),
+                      make_tuple(&av1_denoiser_filter_avx2, BLOCK_128X64),
+                      make_tuple(&av1_denoiser_filter_avx2, BLOCK_64X128),
+                      make_tuple(&av1_denoiser_filter_avx2, BLOCK_128X128)));
+#endif  // HAVE_AVX2
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(
     NEON, AV1DenoiserTest,
@@ -480,6 +480,13 @@ INSTANTIATE_TEST_SUITE_P(
                                    aom_highbd_blend_a64_mask_sse4_1)));
 #endif  // HAVE_SSE4_1
 
+#if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, BlendA64MaskTestHBD,
+    ::testing::Values(TestFuncsHBD(aom_highbd_blend_a64_mask_c,
+                                   aom_highbd_blend_a64_mask_avx2)));
+#endif  // HAVE_AVX2
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(
     NEON, BlendA64MaskTestHBD,
@@ -637,14 +644,5 @@ INSTANTIATE_TEST_SUITE_P(
                                        aom_highbd_blend_a64_d16_mask_neon)));
 #endif  // HAVE_NEON
 
-// TODO(slavarnway): Enable the following in the avx2 commit. (56501)
-#if 0
-#if HAVE_AVX2
-INSTANTIATE_TEST_SUITE_P(
-    SSE4_1, BlendA64MaskTestHBD,
-    ::testing::Values(TestFuncsHBD(aom_highbd_blend_a64_mask_c,
-                                   aom_highbd_blend_a64_mask_avx2)));
-#endif  // HAVE_AVX2
-#endif
 #endif  // CONFIG_AV1_HIGHBITDEPTH
 }  // namespace
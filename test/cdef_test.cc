@@ -401,6 +401,108 @@ void test_finddir_dual_speed(
       ref_elapsed_time, elapsed_time, ref_elapsed_time / elapsed_time);
 }
 
+using find_dir_quad_t = void (*)(const uint16_t *const img[4], int stride,
+                                 int32_t *const var[4], int coeff_shift,
+                                 int *const dir[4]);
+
+using find_dir_quad_param_t = std::tuple<find_dir_quad_t, find_dir_quad_t>;
+
+class CDEFFindDirQuadTest
+    : public ::testing::TestWithParam<find_dir_quad_param_t> {
+ public:
+  ~CDEFFindDirQuadTest() override = default;
+  void SetUp() override {
+    finddir_ = GET_PARAM(0);
+    ref_finddir_ = GET_PARAM(1);
+  }
+
+ protected:
+  find_dir_quad_t finddir_;
+  find_dir_quad_t ref_finddir_;
+};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(CDEFFindDirQuadTest);
+
+using CDEFFindDirQuadSpeedTest = CDEFFindDirQuadTest;
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(CDEFFindDirQuadSpeedTest);
+
+void test_finddir_quad(find_dir_quad_t finddir, find_dir_quad_t ref_finddir) {
+  const int size_wd = 32;
+  const int size_ht = 8;
+  ACMRandom rnd(ACMRandom::DeterministicSeed());
+  DECLARE_ALIGNED(16, uint16_t, s[size_ht * size_wd]);
+  const uint16_t *const img[4] = { s, s + 8, s + 16, s + 24 };
+
+  int error = 0, errdepth = 0;
+  int32_t ref_var[4] = { 0 };
+  int ref_dir[4] = { 0 };
+  int32_t var[4] = { 0 };
+  int dir[4] = { 0 };
+  int32_t *const ref_var_out[4] = { &ref_var[0], &ref_var[1], &ref_var[2],
+                                    &ref_var[3] };
+  int *const ref_dir_out[4] = { &ref_dir[0], &ref_dir[1], &ref_dir[2],
+                                &ref_dir[3] };
+  int32_t *const var_out[4] = { &var[0], &var[1], &var[2], &var[3] };
+  int *const dir_out[4] = { &dir[0], &dir[1], &dir[2], &dir[3] };
+
+  for (int depth = 8; depth <= 12 && !error; depth += 2) {
+    for (int count = 0; count < 256 && !error; count++) {
+      for (int level = 0; level < (1 << depth) && !error;
+           level += 1 << (depth - 8)) {
+        for (int bits = 1; bits <= depth && !error; bits++) {
+          for (unsigned int i = 0; i < sizeof(s) / sizeof(*s); i++)
+            s[i] = clamp((rnd.Rand16() & ((1 << bits) - 1)) + level, 0,
+                         (1 << depth) - 1);
+          for (int c = 0; c < 1 + 9 * (finddir == ref_finddir); c++)
+            ref_finddir(img, size_wd, ref_var_out, depth - 8, ref_dir_out);
+          if (finddir != ref_finddir)
+            API_REGISTER_STATE_CHECK(
+                finddir(img, size_wd, var_out, depth - 8, dir_out));
+          if (ref_finddir != finddir) {
+            for (int j = 0; j < 4; j++) {
+              if (ref_dir[j] != dir[j] || ref_var[j] != var[j]) error = 1;
+            }
+            errdepth = depth;
+          }
+        }
+      }
+    }
+  }
+
+  for (int j = 0; j < 4; j++) {
+    EXPECT_EQ(0, error) << "Error: CDEFFindDirTest, SIMD and C mismatch."
+                        << std::endl
+                        << "direction: " << dir[j] << " : " << ref_dir[j]
+                        << std::endl
+                        << "variance: " << var[j] << " : " << ref_var[j]
+                        << std::endl
+                        << "depth: " << errdepth << std::endl
+                        << std::endl;
+  }
+}
+
+void test_finddir_quad_speed(find_dir_quad_t finddir,
+                             find_dir_quad_t ref_finddir) {
+  aom_usec_timer ref_timer;
+  aom_usec_timer timer;
+
+  aom_usec_timer_start(&ref_timer);
+  test_finddir_quad(ref_finddir, ref_finddir);
+  aom_usec_timer_mark(&ref_timer);
+  const double ref_elapsed_time =
+      static_cast<double>(aom_usec_timer_elapsed(&ref_timer));
+
+  aom_usec_timer_start(&timer);
+  test_finddir_quad(finddir, finddir);
+  aom_usec_timer_mark(&timer);
+  const double elapsed_time =
+      static_cast<double>(aom_usec_timer_elapsed(&timer));
+
+  printf(
+      "ref_time=%lf \t simd_time=%lf \t "
+      "gain=%lf \n",
+      ref_elapsed_time, elapsed_time, ref_elapsed_time / elapsed_time);
+}
+
 #define MAX_CDEF_BLOCK 256
 
 constexpr int kIterations = 100;
@@ -606,6 +708,14 @@ TEST_P(CDEFFindDirDualSpeedTest, DISABLED_TestSpeed) {
   test_finddir_dual_speed(finddir_, ref_finddir_);
 }
 
+TEST_P(CDEFFindDirQuadTest, TestSIMDNoMismatch) {
+  test_finddir_quad(finddir_, ref_finddir_);
+}
+
+TEST_P(CDEFFindDirQuadSpeedTest, DISABLED_TestSpeed) {
+  test_finddir_quad_speed(finddir_, ref_finddir_);
+}
+
 TEST_P(CDEFCopyRect8to16Test, TestSIMDNoMismatch) {
   test_copy_rect_8_to_16(test_func_, ref_func_);
 }
@@ -662,6 +772,10 @@ INSTANTIATE_TEST_SUITE_P(SSSE3, CDEFFindDirTest,
 INSTANTIATE_TEST_SUITE_P(SSSE3, CDEFFindDirDualTest,
                          ::testing::Values(make_tuple(&cdef_find_dir_dual_ssse3,
                                                       &cdef_find_dir_dual_c)));
+INSTANTIATE_TEST_SUITE_P(
+    SSSE3, CDEFFindDirQuadTest,
+    ::testing::Values(make_tuple(&cdef_find_dir_quad_ssse3,
+                                 &cdef_find_dir_quad_c)));
 
 INSTANTIATE_TEST_SUITE_P(
     SSSE3, CDEFCopyRect8to16Test,
@@ -708,6 +822,10 @@ INSTANTIATE_TEST_SUITE_P(
     SSE4_1, CDEFFindDirDualTest,
     ::testing::Values(make_tuple(&cdef_find_dir_dual_sse4_1,
                                  &cdef_find_dir_dual_c)));
+INSTANTIATE_TEST_SUITE_P(
+    SSE4_1, CDEFFindDirQuadTest,
+    ::testing::Values(make_tuple(&cdef_find_dir_quad_sse4_1,
+                                 &cdef_find_dir_quad_c)));
 
 INSTANTIATE_TEST_SUITE_P(
     SSE4_1, CDEFCopyRect8to16Test,
@@ -753,6 +871,10 @@ INSTANTIATE_TEST_SUITE_P(AVX2, CDEFFindDirTest,
 INSTANTIATE_TEST_SUITE_P(AVX2, CDEFFindDirDualTest,
                          ::testing::Values(make_tuple(&cdef_find_dir_dual_avx2,
                                                       &cdef_find_dir_dual_c)));
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, CDEFFindDirQuadTest,
+    ::testing::Values(make_tuple(&cdef_find_dir_quad_avx2,
+                                 &cdef_find_dir_quad_c)));
 
 INSTANTIATE_TEST_SUITE_P(
     AVX2, CDEFCopyRect8to16Test,
@@ -767,6 +889,37 @@ INSTANTIATE_TEST_SUITE_P(
 #endif  // CONFIG_AV1_HIGHBITDEPTH
 #endif
 
+#if CONFIG_HIGHWAY && HAVE_AVX512
+static const CdefFilterBlockFunctions kCdefFilterFuncAvx512[] = {
+  { &cdef_filter_8_0_avx512, &cdef_filter_8_1_avx512, &cdef_filter_8_2_avx512,
+    &cdef_filter_8_3_avx512 }
+};
+
+static const CdefFilterBlockFunctions kCdefFilterHighbdFuncAvx512[] = {
+  { &cdef_filter_16_0_avx512, &cdef_filter_16_1_avx512,
+    &cdef_filter_16_2_avx512, &cdef_filter_16_3_avx512 }
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    AVX512, CDEFBlockTest,
+    ::testing::Combine(::testing::ValuesIn(kCdefFilterFuncAvx512),
+                       ::testing::ValuesIn(kCdefFilterFuncC),
+                       ::testing::Values(BLOCK_4X4, BLOCK_4X8, BLOCK_8X4,
+                                         BLOCK_8X8),
+                       ::testing::Range(0, 16), ::testing::Values(8)));
+INSTANTIATE_TEST_SUITE_P(
+    AVX512, CDEFBlockHighbdTest,
+    ::testing::Combine(::testing::ValuesIn(kCdefFilterHighbdFuncAvx512),
+                       ::testing::ValuesIn(kCdefFilterHighbdFuncC),
+                       ::testing::Values(BLOCK_4X4, BLOCK_4X8, BLOCK_8X4,
+                                         BLOCK_8X8),
+                       ::testing::Range(0, 16), ::testing::Range(10, 13, 2)));
+INSTANTIATE_TEST_SUITE_P(
+    AVX512, CDEFFindDirQuadTest,
+    ::testing::Values(make_tuple(&cdef_find_dir_quad_avx512,
+                                 &cdef_find_dir_quad_c)));
+#endif  // CONFIG_HIGHWAY && HAVE_AVX512
+
 #if HAVE_NEON
 static const CdefFilterBlockFunctions kCdefFilterFuncNeon[] = {
   { &cdef_filter_8_0_neon, &cdef_filter_8_1_neon, &cdef_filter_8_2_neon,
@@ -798,6 +951,10 @@ INSTANTIATE_TEST_SUITE_P(NEON, CDEFFindDirTest,
 INSTANTIATE_TEST_SUITE_P(NEON, CDEFFindDirDualTest,
                          ::testing::Values(make_tuple(&cdef_find_dir_dual_neon,
                                                       &cdef_find_dir_dual_c)));
+INSTANTIATE_TEST_SUITE_P(
+    NEON, CDEFFindDirQuadTest,
+    ::testing::Values(make_tuple(&cdef_find_dir_quad_neon,
+                                 &cdef_find_dir_quad_c)));
 
 INSTANTIATE_TEST_SUITE_P(
     NEON, CDEFCopyRect8to16Test,
@@ -921,8 +1078,33 @@ INSTANTIATE_TEST_SUITE_P(AVX2, CDEFFindDirSpeedTest,
 INSTANTIATE_TEST_SUITE_P(AVX2, CDEFFindDirDualSpeedTest,
                          ::testing::Values(make_tuple(&cdef_find_dir_dual_avx2,
                                                       &cdef_find_dir_dual_c)));
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, CDEFFindDirQuadSpeedTest,
+    ::testing::Values(make_tuple(&cdef_find_dir_quad_avx2,
+                                 &cdef_find_dir_quad_c)));
 #endif
 
+#if CONFIG_HIGHWAY && HAVE_AVX512
+INSTANTIATE_TEST_SUITE_P(
+    AVX512, CDEFSpeedTest,
+    ::testing::Combine(::testing::ValuesIn(kCdefFilterFuncAvx512),
+                       ::testing::ValuesIn(kCdefFilterFuncC),
+                       ::testing::Values(BLOCK_4X4, BLOCK_4X8, BLOCK_8X4,
+                                         BLOCK_8X8),
+                       ::testing::Range(0, 16), ::testing::Values(8)));
+INSTANTIATE_TEST_SUITE_P(
+    AVX512, CDEFSpeedHighbdTest,
+    ::testing::Combine(::testing::ValuesIn(kCdefFilterHighbdFuncAvx512),
+                       ::testing::ValuesIn(kCdefFilterHighbdFuncC),
+                       ::testing::Values(BLOCK_4X4, BLOCK_4X8, BLOCK_8X4,
+                                         BLOCK_8X8),
+                       ::testing::Range(0, 16), ::testing::Values(10)));
+INSTANTIATE_TEST_SUITE_P(
+    AVX512, CDEFFindDirQuadSpeedTest,
+    ::testing::Values(make_tuple(&cdef_find_dir_quad_avx512,
+                                 &cdef_find_dir_quad_c)));
+#endif  // CONFIG_HIGHWAY && HAVE_AVX512
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(
     NEON, CDEFSpeedTest,
@@ -12,6 +12,7 @@
 #include <assert.h>
 #include <math.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "gtest/gtest.h"
 
@@ -2658,4 +2659,345 @@ INSTANTIATE_TEST_SUITE_P(NEON, CNNConvolveTest,
                              &av1_cnn_convolve_no_maxpool_padding_valid_neon)));
 #endif
 
+using CNNConvolveFunc = void (*)(const float **input, int in_width,
+                                 int in_height, int in_stride,
+                                 const CNN_LAYER_CONFIG *layer_config,
+                                 float **output, int out_stride, int start_idx,
+                                 int step);
+using CNNConvolveLayerTestFuncs = libaom_test::FuncParam<CNNConvolveFunc>;
+
+using CNNDeconvolveFunc = void (*)(const float **input, int in_width,
+                                   int in_height, int in_stride,
+                                   const CNN_LAYER_CONFIG *layer_config,
+                                   float **output, int out_stride);
+using CNNDeconvolveTestFuncs = libaom_test::FuncParam<CNNDeconvolveFunc>;
+
+using CNNActivateFunc = void (*)(float **input, int channels, int width,
+                                 int height, int stride,
+                                 ACTIVATION layer_activation);
+using CNNActivateTestFuncs = libaom_test::FuncParam<CNNActivateFunc>;
+
+using CNNAddFunc = void (*)(float **input, int channels, int width, int height,
+                            int stride, const float **add);
+using CNNAddTestFuncs = libaom_test::FuncParam<CNNAddFunc>;
+
+using CNNBatchnormFunc = void (*)(float **image, int channels, int width,
+                                  int height, int stride, const float *gamma,
+                                  const float *beta, const float *mean,
+                                  const float *std);
+using CNNBatchnormTestFuncs = libaom_test::FuncParam<CNNBatchnormFunc>;
+
+// The SIMD layer kernels below accumulate in the same order as the C code, so
+// their outputs must match exactly.
+constexpr int kMaxTestChannels = 20;
+constexpr int kMaxTestDim = 40;
+constexpr int kMaxTestSize = kMaxTestDim * kMaxTestDim;
+
+class CNNLayerTestBase {
+ protected:
+  void FillRandom(float *buf, int size) {
+    for (int i = 0; i < size; ++i) {
+      buf[i] = ((float)rng_.Rand31() - (1 << 30)) / (1u << 31);
+    }
+  }
+
+  void SetBuffers(float *data, float **bufs, int channels, int size) {
+    for (int c = 0; c < channels; ++c) bufs[c] = data + c * size;
+  }
+
+  libaom_test::ACMRandom rng_;
+  float input_data_[kMaxTestChannels * kMaxTestSize];
+  float weights_[5 * 5 * kMaxTestChannels * kMaxTestChannels];
+  float bias_[kMaxTestChannels];
+  float ref_data_[kMaxTestChannels * 4 * kMaxTestSize];
+  float tst_data_[kMaxTestChannels * 4 * kMaxTestSize];
+};
+
+class CNNConvolveLayerTest
+    : public CNNLayerTestBase,
+      public ::testing::TestWithParam<CNNConvolveLayerTestFuncs> {
+ protected:
+  void RunTest(int in_width, int in_height, CNN_LAYER_CONFIG *layer_config,
+               int step) {
+    float *input[kMaxTestChannels], *output_ref[kMaxTestChannels],
+        *output_tst[kMaxTestChannels];
+    const int in_size = in_width * in_height;
+    FillRandom(input_data_, layer_config->in_channels * in_size);
+    SetBuffers(input_data_, input, layer_config->in_channels, in_size);
+    FillRandom(weights_, layer_config->filter_width *
+                             layer_config->filter_height *
+                             layer_config->in_channels *
+                             layer_config->out_channels);
+    FillRandom(bias_, layer_config->out_channels);
+    layer_config->weights = weights_;
+    layer_config->bias = bias_;
+
+    int out_width = 0, out_height = 0;
+    av1_find_cnn_layer_output_size(in_width, in_height, layer_config,
+                                   &out_width, &out_height);
+    const int out_size = out_width * out_height;
+    ASSERT_LE(out_size, kMaxTestSize);
+    SetBuffers(ref_data_, output_ref, layer_config->out_channels, out_size);
+    SetBuffers(tst_data_, output_tst, layer_config->out_channels, out_size);
+    memset(ref_data_, 0, sizeof(ref_data_));
+    memset(tst_data_, 0, sizeof(tst_data_));
+
+    const CNNConvolveLayerTestFuncs funcs = GetParam();
+    // With more than one thread, each worker handles one start_idx.
+    for (int start_idx = 0; start_idx < AOMMAX(step, 1); ++start_idx) {
+      funcs.ref_func((const float **)input, in_width, in_height, in_width,
+                     layer_config, output_ref, out_width, start_idx, step);
+      funcs.tst_func((const float **)input, in_width, in_height, in_width,
+                     layer_config, output_tst, out_width, start_idx, step);
+    }
+    for (int c = 0; c < layer_config->out_channels; ++c) {
+      for (int i = 0; i < out_size; ++i) {
+        ASSERT_EQ(output_ref[c][i], output_tst[c][i])
+            << "channel " << c << " pixel " << i << " filter "
+            << layer_config->filter_width << "x" << layer_config->filter_height
+            << " skip " << layer_config->skip_width << "x"
+            << layer_config->skip_height << " pad " << layer_config->pad
+            << " maxpool " << layer_config->maxpool << " step " << step;
+      }
+    }
+  }
+};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(CNNConvolveLayerTest);
+
+TEST_P(CNNConvolveLayerTest, CheckOutput) {
+  const int filter_dims[][2] = { { 1, 1 }, { 2, 2 }, { 3, 3 },
+                                 { 5, 5 }, { 3, 2 }, { 1, 4 } };
+  const int skip_dims[][2] = { { 1, 1 }, { 2, 2 }, { 4, 4 }, { 2, 1 } };
+  const int channels[][2] = { { 1, 1 }, { 3, 8 }, { 20, 4 }, { 4, 20 } };
+  const PADDING_TYPE pads[] = { PADDING_SAME_ZERO, PADDING_SAME_REPLICATE,
+                                PADDING_VALID };
+  for (const auto &filter : filter_dims) {
+    for (const auto &skip : skip_dims) {
+      for (const auto &ch : channels) {
+        for (const PADDING_TYPE pad : pads) {
+          for (int maxpool = 0; maxpool <= 1; ++maxpool) {
+            for (int step = 0; step <= 3; step += 3) {
+              CNN_LAYER_CONFIG layer_config = {};
+              layer_config.in_channels = ch[0];
+              layer_config.out_channels = ch[1];
+              layer_config.filter_width = filter[0];
+              layer_config.filter_height = filter[1];
+              layer_config.skip_width = skip[0];
+              layer_config.skip_height = skip[1];
+              layer_config.pad = pad;
+              layer_config.maxpool = maxpool;
+              const int in_width = 9 + rng_(24);
+              const int in_height = 9 + rng_(24);
+              RunTest(in_width, in_height, &layer_config, step);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+class CNNDeconvolveTest
+    : public CNNLayerTestBase,
+      public ::testing::TestWithParam<CNNDeconvolveTestFuncs> {};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(CNNDeconvolveTest);
+
+TEST_P(CNNDeconvolveTest, CheckOutput) {
+  const int filter_dims[][2] = { { 1, 1 }, { 2, 2 }, { 3, 3 }, { 5, 3 } };
+  const int skip_dims[][2] = { { 1, 1 }, { 2, 2 }, { 3, 2 } };
+  const int channels[][2] = { { 1, 1 }, { 3, 8 }, { 20, 13 } };
+  const PADDING_TYPE pads[] = { PADDING_SAME_ZERO, PADDING_SAME_REPLICATE,
+                                PADDING_VALID };
+  const CNNDeconvolveTestFuncs funcs = GetParam();
+  for (const auto &filter : filter_dims) {
+    for (const auto &skip : skip_dims) {
+      for (const auto &ch : channels) {
+        for (const PADDING_TYPE pad : pads) {
+          CNN_LAYER_CONFIG layer_config = {};
+          layer_config.in_channels = ch[0];
+          layer_config.out_channels = ch[1];
+          layer_config.filter_width = filter[0];
+          layer_config.filter_height = filter[1];
+          layer_config.skip_width = skip[0];
+          layer_config.skip_height = skip[1];
+          layer_config.pad = pad;
+          layer_config.deconvolve = 1;
+          layer_config.weights = weights_;
+          layer_config.bias = bias_;
+          const int in_width = 4 + rng_(8);
+          const int in_height = 4 + rng_(8);
+          const int in_size = in_width * in_height;
+          float *input[kMaxTestChannels], *output_ref[kMaxTestChannels],
+              *output_tst[kMaxTestChannels];
+          FillRandom(input_data_, ch[0] * in_size);
+          SetBuffers(input_data_, input, ch[0], in_size);
+          FillRandom(weights_, filter[0] * filter[1] * ch[0] * ch[1]);
+          FillRandom(bias_, ch[1]);
+
+          int out_width = 0, out_height = 0;
+          av1_find_cnn_layer_output_size(in_width, in_height, &layer_config,
+                                         &out_width, &out_height);
+          const int out_size = out_width * out_height;
+          ASSERT_LE(out_size, 4 * kMaxTestSize);
+          SetBuffers(ref_data_, output_ref, ch[1], out_size);
+          SetBuffers(tst_data_, output_tst, ch[1], out_size);
+          funcs.ref_func((const float **)input, in_width, in_height, in_width,
+                         &layer_config, output_ref, out_width);
+          funcs.tst_func((const float **)input, in_width, in_height, in_width,
+                         &layer_config, output_tst, out_width);
+          for (int c = 0; c < ch[1]; ++c) {
+            for (int i = 0; i < out_size; ++i) {
+              ASSERT_EQ(output_ref[c][i], output_tst[c][i])
+                  << "channel " << c << " pixel " << i << " pad " << pad;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+class CNNActivateTest : public CNNLayerTestBase,
+                        public ::testing::TestWithParam<CNNActivateTestFuncs> {
+};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(CNNActivateTest);
+
+TEST_P(CNNActivateTest, CheckOutput) {
+  const CNNActivateTestFuncs funcs = GetParam();
+  const ACTIVATION activations[] = { NONE, RELU, SOFTSIGN };
+  float *ref[kMaxTestChannels], *tst[kMaxTestChannels];
+  for (const ACTIVATION activation : activations) {
+    for (int width = 1; width <= 33; width += 4) {
+      const int height = 1 + rng_(kMaxTestDim);
+      const int stride = width + rng_(4);
+      const int channels = 1 + rng_(kMaxTestChannels);
+      FillRandom(ref_data_, channels * stride * height);
+      // Signed zeros are handled like the C code.
+      ref_data_[0] = -0.0f;
+      memcpy(tst_data_, ref_data_, sizeof(ref_data_));
+      SetBuffers(ref_data_, ref, channels, stride * height);
+      SetBuffers(tst_data_, tst, channels, stride * height);
+      funcs.ref_func(ref, channels, width, height, stride, activation);
+      funcs.tst_func(tst, channels, width, height, stride, activation);
+      ASSERT_EQ(memcmp(ref_data_, tst_data_, sizeof(ref_data_)), 0)
+          << "activation " << activation << " width " << width;
+    }
+  }
+}
+
+class CNNAddTest : public CNNLayerTestBase,
+                   public ::testing::TestWithParam<CNNAddTestFuncs> {};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(CNNAddTest);
+
+TEST_P(CNNAddTest, CheckOutput) {
+  const CNNAddTestFuncs funcs = GetParam();
+  float *ref[kMaxTestChannels], *tst[kMaxTestChannels];
+  float *add[kMaxTestChannels];
+  for (int width = 1; width <= 33; width += 4) {
+    const int height = 1 + rng_(kMaxTestDim);
+    const int stride = width + rng_(4);
+    const int channels = 1 + rng_(kMaxTestChannels);
+    FillRandom(ref_data_, channels * stride * height);
+    FillRandom(input_data_, channels * stride * height);
+    memcpy(tst_data_, ref_data_, sizeof(ref_data_));
+    SetBuffers(ref_data_, ref, channels, stride * height);
+    SetBuffers(tst_data_, tst, channels, stride * height);
+    SetBuffers(input_data_, add, channels, stride * height);
+    funcs.ref_func(ref, channels, width, height, stride, (const float **)add);
+    funcs.tst_func(tst, channels, width, height, stride, (const float **)add);
+    ASSERT_EQ(memcmp(ref_data_, tst_data_, sizeof(ref_data_)), 0)
+        << "width " << width;
+  }
+}
+
+class CNNBatchnormTest
+    : public CNNLayerTestBase,
+      public ::testing::TestWithParam<CNNBatchnormTestFuncs> {};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(CNNBatchnormTest);
+
+TEST_P(CNNBatchnormTest, CheckOutput) {
+  const CNNBatchnormTestFuncs funcs = GetParam();
+  float *ref[kMaxTestChannels], *tst[kMaxTestChannels];
+  float gamma[kMaxTestChannels], beta[kMaxTestChannels];
+  float mean[kMaxTestChannels], std[kMaxTestChannels];
+  for (int width = 1; width <= 33; width += 4) {
+    const int height = 1 + rng_(kMaxTestDim);
+    const int stride = width + rng_(4);
+    const int channels = 1 + rng_(kMaxTestChannels);
+    FillRandom(gamma, channels);
+    FillRandom(beta, channels);
+    FillRandom(mean, channels);
+    for (int c = 0; c < channels; ++c) std[c] = 0.5f + rng_(100) / 100.0f;
+    FillRandom(ref_data_, channels * stride * height);
+    memcpy(tst_data_, ref_data_, sizeof(ref_data_));
+    SetBuffers(ref_data_, ref, channels, stride * height);
+    SetBuffers(tst_data_, tst, channels, stride * height);
+    funcs.ref_func(ref, channels, width, height, stride, gamma, beta, mean,
+                   std);
+    funcs.tst_func(tst, channels, width, height, stride, gamma, beta, mean,
+                   std);
+    ASSERT_EQ(memcmp(ref_data_, tst_data_, sizeof(ref_data_)), 0)
+        << "width " << width;
+  }
+}
+
+#if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(AVX2, CNNConvolveLayerTest,
+                         ::testing::Values(CNNConvolveLayerTestFuncs(
+                             &av1_cnn_convolve_c, &av1_cnn_convolve_avx2)));
+INSTANTIATE_TEST_SUITE_P(AVX2, CNNDeconvolveTest,
+                         ::testing::Values(CNNDeconvolveTestFuncs(
+                             &av1_cnn_deconvolve_c, &av1_cnn_deconvolve_avx2)));
+INSTANTIATE_TEST_SUITE_P(AVX2, CNNActivateTest,
+                         ::testing::Values(CNNActivateTestFuncs(
+                             &av1_cnn_activate_c, &av1_cnn_activate_avx2)));
+INSTANTIATE_TEST_SUITE_P(AVX2, CNNAddTest,
+                         ::testing::Values(CNNAddTestFuncs(&av1_cnn_add_c,
+                                                           &av1_cnn_add_avx2)));
+INSTANTIATE_TEST_SUITE_P(AVX2, CNNBatchnormTest,
+                         ::testing::Values(CNNBatchnormTestFuncs(
+                             &av1_cnn_batchnorm_c, &av1_cnn_batchnorm_avx2)));
+#endif
+
+// Times the whole intra partition CNN on one 64x64 block, the way the encoder
+// runs it. Run with AOM_SIMD_CAPS_MASK=0 to time the C path.
+TEST(CNNPredictTest, DISABLED_Speed) {
+  const CNN_CONFIG *cnn_config = &av1_intra_mode_cnn_partition_cnn_config;
+  const CNN_THREAD_DATA thread_data = { 1, nullptr };
+  const int width = 65, height = 65, stride = 80;
+  libaom_test::ACMRandom rng(libaom_test::ACMRandom::DeterministicSeed());
+  uint8_t src[stride * height];
+  for (int i = 0; i < stride * height; ++i) src[i] = rng.Rand8();
+  uint8_t *image[1] = { src };
+
+  const int num_outputs = 4;
+  const int output_dims[4] = { 1, 2, 4, 8 };
+  const int out_chs[4] = { CNN_BRANCH_0_OUT_CH, CNN_BRANCH_1_OUT_CH,
+                           CNN_BRANCH_2_OUT_CH, CNN_BRANCH_3_OUT_CH };
+  float cnn_buffer[CNN_OUT_BUF_SIZE];
+  float *output_buffer[CNN_TOT_OUT_CH];
+  float **cur_output_buf = output_buffer;
+  float *curr_buf_ptr = cnn_buffer;
+  for (int output_idx = 0; output_idx < num_outputs; output_idx++) {
+    const int ch_size = output_dims[output_idx] * output_dims[output_idx];
+    for (int ch = 0; ch < out_chs[output_idx]; ch++) {
+      cur_output_buf[ch] = curr_buf_ptr;
+      curr_buf_ptr += ch_size;
+    }
+    cur_output_buf += out_chs[output_idx];
+  }
+  CNN_MULTI_OUT output = { num_outputs, out_chs, output_dims, output_buffer };
+
+  const int run_times = 10000;
+  aom_usec_timer timer;
+  aom_usec_timer_start(&timer);
+  for (int i = 0; i < run_times; ++i) {
+    ASSERT_TRUE(av1_cnn_predict_img_multi_out(
+        image, width, height, stride, cnn_config, &thread_data, &output));
+  }
+  aom_usec_timer_mark(&timer);
+  printf("av1_cnn_predict 64x64: %7.2f us\n",
+         static_cast<double>(aom_usec_timer_elapsed(&timer)) / run_times);
+}
+
 }  // namespace
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+#include "config/aom_dsp_rtcd.h"
+
+#include "gtest/gtest.h"
+#include "test/acm_random.h"
+#include "test/function_equivalence_test.h"
+#include "test/util.h"
+
+#include "aom_mem/aom_mem.h"
+#include "aom_ports/aom_timer.h"
+#include "aom_dsp/flow_estimation/corner_detect.h"
+extern "C" {
+#include "third_party/fastfeat/fast.h"
+}
+
+namespace {
+
+using libaom_test::ACMRandom;
+
+constexpr int kFastBarrier = 18;
+
+// Fills a width x height image with one of a few patterns that produce a mix
+// of isolated corners, clusters of corners with equal scores, and flat areas.
+void GenerateImage(ACMRandom *rnd, uint8_t *img, int width, int height,
+                   int stride, int mode) {
+  for (int i = 0; i < height; ++i) {
+    for (int j = 0; j < width; ++j) {
+      uint8_t v;
+      switch (mode) {
+        case 0: v = rnd->Rand8(); break;
+        case 1: v = (rnd->Rand8() & 3) * 60 + (rnd->Rand8() & 7); break;
+        case 2: v = ((i / 7 + j / 5) & 1) ? 250 : 0; break;
+        default: v = rnd->Rand8Extremes(); break;
+      }
+      img[i * stride + j] = v;
+    }
+  }
+}
+
+using Fast9ScoreRowFunc = void (*)(const uint8_t *src, int stride, int width,
+                                   int threshold, uint8_t *scores);
+using Fast9ScoreRowParam = libaom_test::FuncParam<Fast9ScoreRowFunc>;
+
+class Fast9ScoreRowTest : public ::testing::TestWithParam<Fast9ScoreRowParam> {
+ protected:
+  void SetUp() override { rnd_.Reset(ACMRandom::DeterministicSeed()); }
+
+  ACMRandom rnd_;
+};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(Fast9ScoreRowTest);
+
+TEST_P(Fast9ScoreRowTest, CheckOutput) {
+  const Fast9ScoreRowParam params = GetParam();
+  const int thresholds[] = { 0, 1, kFastBarrier, 100, 253, 254 };
+  for (int iter = 0; iter < 200; ++iter) {
+    const int width = 7 + rnd_(120);
+    const int stride = width + rnd_(32);
+    const int height = 7;
+    std::vector<uint8_t> img(stride * height);
+    GenerateImage(&rnd_, img.data(), width, height, stride, iter & 3);
+    const int threshold = thresholds[iter % 6];
+    std::vector<uint8_t> ref_scores(width, 0), tst_scores(width, 0);
+    params.ref_func(&img[3 * stride], stride, width, threshold,
+                    ref_scores.data());
+    params.tst_func(&img[3 * stride], stride, width, threshold,
+                    tst_scores.data());
+    ASSERT_EQ(ref_scores, tst_scores)
+        << "width " << width << " threshold " << threshold;
+  }
+}
+
+TEST_P(Fast9ScoreRowTest, DISABLED_Speed) {
+  const Fast9ScoreRowParam params = GetParam();
+  const int width = 960, height = 540;
+  std::vector<uint8_t> img(width * height);
+  GenerateImage(&rnd_, img.data(), width, height, width, 1);
+  std::vector<uint8_t> scores(width, 0);
+  const int num_loops = 20;
+  aom_usec_timer ref_timer, test_timer;
+
+  aom_usec_timer_start(&ref_timer);
+  for (int i = 0; i < num_loops; ++i) {
+    for (int y = 3; y < height - 3; ++y) {
+      params.ref_func(&img[y * width], width, width, kFastBarrier,
+                      scores.data());
+    }
+  }
+  aom_usec_timer_mark(&ref_timer);
+
+  aom_usec_timer_start(&test_timer);
+  for (int i = 0; i < num_loops; ++i) {
+    for (int y = 3; y < height - 3; ++y) {
+      params.tst_func(&img[y * width], width, width, kFastBarrier,
+                      scores.data());
+    }
+  }
+  aom_usec_timer_mark(&test_timer);
+
+  const int ref_time = (int)aom_usec_timer_elapsed(&ref_timer);
+  const int test_time = (int)aom_usec_timer_elapsed(&test_timer);
+  printf("c_time=%d \t simd_time=%d \t gain=%f\n", ref_time, test_time,
+         (double)ref_time / test_time);
+}
+
+#if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, Fast9ScoreRowTest,
+    ::testing::Values(Fast9ScoreRowParam(&aom_fast9_score_row_c,
+                                         &aom_fast9_score_row_avx2)));
+#endif  // HAVE_AVX2
+
+// The detector must find the same corners, with the same scores and in the
+// same order, as the third_party/fastfeat detector that it replaces.
+TEST(Fast9DetectTest, MatchesFastFeat) {
+  ACMRandom rnd(ACMRandom::DeterministicSeed());
+  for (int iter = 0; iter < 40; ++iter) {
+    const int width = 7 + rnd(250);
+    const int height = 7 + rnd(100);
+    const int stride = width + rnd(16);
+    std::vector<uint8_t> img(stride * height);
+    GenerateImage(&rnd, img.data(), width, height, stride, iter & 3);
+
+    int *ref_scores = nullptr;
+    int ref_num_corners;
+    xy *ref_corners =
+        aom_fast9_detect_nonmax(img.data(), width, height, stride,
+                                kFastBarrier, &ref_scores, &ref_num_corners);
+    ASSERT_GE(ref_num_corners, 0);
+
+    int *corners = nullptr;
+    int *scores = nullptr;
+    const int num_corners = av1_fast9_detect_nonmax(
+        img.data(), width, height, stride, kFastBarrier, &corners, &scores);
+    ASSERT_EQ(num_corners, ref_num_corners);
+    for (int i = 0; i < num_corners; ++i) {
+      ASSERT_EQ(corners[2 * i + 0], ref_corners[i].x) << "corner " << i;
+      ASSERT_EQ(corners[2 * i + 1], ref_corners[i].y) << "corner " << i;
+      ASSERT_EQ(scores[i], ref_scores[i]) << "corner " << i;
+    }
+    free(ref_corners);
+    free(ref_scores);
+    aom_free(corners);
+    aom_free(scores);
+  }
+}
+
+}  // namespace
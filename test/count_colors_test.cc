@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <string.h>
+
+#include <climits>
+#include <tuple>
+
+#include "config/aom_config.h"
+#include "config/av1_rtcd.h"
+
+#include "aom_dsp/aom_dsp_common.h"
+#include "aom_ports/aom_timer.h"
+#include "av1/encoder/intra_mode_search.h"
+#include "gtest/gtest.h"
+#include "test/acm_random.h"
+#include "test/util.h"
+
+namespace {
+
+using libaom_test::ACMRandom;
+
+constexpr int kMaxWidth = 128;
+
+// Fills the buffer with random samples, or with runs of equal samples from a
+// small set of colors as found in screen content.
+void FillRow(ACMRandom *rnd, uint16_t *buf, int width, int max_val,
+             int mode) {
+  int val = rnd->Rand16() % (max_val + 1);
+  for (int i = 0; i < width; ++i) {
+    switch (mode) {
+      case 0: val = rnd->Rand16() % (max_val + 1); break;
+      case 1:
+        if (rnd->Rand8() < 24) val = rnd->Rand16() % (max_val + 1);
+        break;
+      default:
+        if (rnd->Rand8() < 80) val = max_val - rnd->Rand8() % 4;
+        break;
+    }
+    buf[i] = val;
+  }
+}
+
+using CountColorsRowFunc = int (*)(const uint8_t *src, int width,
+                                   int *val_count);
+
+class CountColorsRowTest : public ::testing::TestWithParam<CountColorsRowFunc> {
+ protected:
+  void SetUp() override { rnd_.Reset(ACMRandom::DeterministicSeed()); }
+
+  ACMRandom rnd_;
+};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(CountColorsRowTest);
+
+TEST_P(CountColorsRowTest, MatchesC) {
+  const CountColorsRowFunc tst_func = GetParam();
+  uint16_t row16[kMaxWidth];
+  uint8_t row[kMaxWidth];
+  int ref_count[1 << 8], tst_count[1 << 8];
+  for (int iter = 0; iter < 10000; ++iter) {
+    // Histograms carry over between rows, so start from a partial one.
+    if (iter % 8 == 0) {
+      memset(ref_count, 0, sizeof(ref_count));
+      memset(tst_count, 0, sizeof(tst_count));
+    }
+    const int width = 1 + rnd_(kMaxWidth);
+    FillRow(&rnd_, row16, width, 255, iter % 3);
+    for (int i = 0; i < width; ++i) row[i] = static_cast<uint8_t>(row16[i]);
+    const int ref_n = av1_count_colors_row_c(row, width, ref_count);
+    const int tst_n = tst_func(row, width, tst_count);
+    ASSERT_EQ(ref_n, tst_n) << "width " << width;
+    ASSERT_EQ(memcmp(ref_count, tst_count, sizeof(ref_count)), 0)
+        << "width " << width;
+  }
+}
+
+TEST_P(CountColorsRowTest, DISABLED_Speed) {
+  const CountColorsRowFunc tst_func = GetParam();
+  const int kWidth = 64;
+  uint16_t row16[kWidth];
+  uint8_t block[kWidth * kWidth];
+  int count[1 << 8];
+  for (int mode = 0; mode < 3; ++mode) {
+    for (int r = 0; r < kWidth; ++r) {
+      FillRow(&rnd_, row16, kWidth, 255, mode);
+      for (int c = 0; c < kWidth; ++c) {
+        block[r * kWidth + c] = static_cast<uint8_t>(row16[c]);
+      }
+    }
+    const CountColorsRowFunc funcs[2] = { av1_count_colors_row_c, tst_func };
+    double elapsed[2];
+    for (int f = 0; f < 2; ++f) {
+      aom_usec_timer timer;
+      aom_usec_timer_start(&timer);
+      for (int i = 0; i < 50000; ++i) {
+        memset(count, 0, sizeof(count));
+        for (int r = 0; r < kWidth; ++r) {
+          funcs[f](block + r * kWidth, kWidth, count);
+        }
+      }
+      aom_usec_timer_mark(&timer);
+      elapsed[f] = static_cast<double>(aom_usec_timer_elapsed(&timer));
+    }
+    printf("mode %d: c %.0f us, simd %.0f us (%.2fx)\n", mode, elapsed[0],
+           elapsed[1], elapsed[0] / elapsed[1]);
+  }
+}
+
+#if HAVE_SSE2
+INSTANTIATE_TEST_SUITE_P(SSE2, CountColorsRowTest,
+                         ::testing::Values(&av1_count_colors_row_sse2));
+#endif
+
+#if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(AVX2, CountColorsRowTest,
+                         ::testing::Values(&av1_count_colors_row_avx2));
+#endif
+
+using CountColorsRowHighbdFunc = int (*)(const uint16_t *src, int width,
+                                         int bit_depth, int *val_count,
+                                         int *bin_val_count);
+using CountColorsRowHighbdParam = std::tuple<CountColorsRowHighbdFunc, int>;
+
+class CountColorsRowHighbdTest
+    : public ::testing::TestWithParam<CountColorsRowHighbdParam> {
+ protected:
+  void SetUp() override { rnd_.Reset(ACMRandom::DeterministicSeed()); }
+
+  ACMRandom rnd_;
+};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(CountColorsRowHighbdTest);
+
+TEST_P(CountColorsRowHighbdTest, MatchesC) {
+  const CountColorsRowHighbdFunc tst_func = std::get<0>(GetParam());
+  const int bit_depth = std::get<1>(GetParam());
+  uint16_t row[kMaxWidth];
+  int ref_count[1 << 12], tst_count[1 << 12];
+  int ref_bins[1 << 8], tst_bins[1 << 8];
+  for (int iter = 0; iter < 10000; ++iter) {
+    if (iter % 8 == 0) {
+      memset(ref_count, 0, sizeof(ref_count));
+      memset(tst_count, 0, sizeof(tst_count));
+      memset(ref_bins, 0, sizeof(ref_bins));
+      memset(tst_bins, 0, sizeof(tst_bins));
+    }
+    const int width = 1 + rnd_(kMaxWidth);
+    FillRow(&rnd_, row, width, (1 << bit_depth) - 1, iter % 3);
+    // The full histogram is optional.
+    const bool with_count = iter & 1;
+    const int ref_n =
+        av1_count_colors_row_highbd_c(row, width, bit_depth,
+                                      with_count ? ref_count : nullptr,
+                                      ref_bins);
+    const int tst_n = tst_func(row, width, bit_depth,
+                               with_count ? tst_count : nullptr, tst_bins);
+    ASSERT_EQ(ref_n, tst_n) << "width " << width;
+    ASSERT_EQ(memcmp(ref_bins, tst_bins, sizeof(ref_bins)), 0)
+        << "width " << width;
+    ASSERT_EQ(memcmp(ref_count, tst_count, sizeof(ref_count)), 0)
+        << "width " << width;
+  }
+}
+
+#if HAVE_SSE2
+INSTANTIATE_TEST_SUITE_P(
+    SSE2, CountColorsRowHighbdTest,
+    ::testing::Combine(::testing::Values(&av1_count_colors_row_highbd_sse2),
+                       ::testing::Values(10, 12)));
+#endif
+
+#if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, CountColorsRowHighbdTest,
+    ::testing::Combine(::testing::Values(&av1_count_colors_row_highbd_avx2),
+                       ::testing::Values(10, 12)));
+#endif
+
+// Counting with a color limit must give the exact result when the block has
+// no more colors than the limit, and otherwise report more colors than the
+// limit.
+TEST(CountColorsTest, EarlyExit) {
+  ACMRandom rnd(ACMRandom::DeterministicSeed());
+  const int kSize = 64;
+  uint16_t row16[kSize];
+  uint8_t block[kSize * kSize];
+  for (int iter = 0; iter < 200; ++iter) {
+    const int max_val = 1 + rnd(255);
+    for (int r = 0; r < kSize; ++r) {
+      FillRow(&rnd, row16, kSize, max_val, iter % 3);
+      for (int c = 0; c < kSize; ++c) {
+        block[r * kSize + c] = static_cast<uint8_t>(row16[c]);
+      }
+    }
+    int ref_count[1 << 8], count[1 << 8];
+    int ref_colors, colors;
+    av1_count_colors(block, kSize, kSize, kSize, INT_MAX, ref_count,
+                     &ref_colors);
+    const int max_colors = rnd(80);
+    av1_count_colors(block, kSize, kSize, kSize, max_colors, count, &colors);
+    if (ref_colors <= max_colors) {
+      ASSERT_EQ(colors, ref_colors);
+      ASSERT_EQ(memcmp(ref_count, count, sizeof(count)), 0);
+    } else {
+      ASSERT_GT(colors, max_colors);
+      ASSERT_LE(colors, ref_colors);
+    }
+    const bool under_threshold = av1_count_colors_with_threshold(
+        block, kSize, kSize, kSize, max_colors, &colors);
+    ASSERT_EQ(under_threshold, ref_colors <= max_colors);
+  }
+}
+
+}  // namespace
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <string.h>
+
+#include <tuple>
+
+#include "config/av1_rtcd.h"
+
+#include "gtest/gtest.h"
+#include "test/acm_random.h"
+#include "test/util.h"
+
+#include "aom_dsp/aom_dsp_common.h"
+#include "aom_ports/aom_timer.h"
+#include "av1/encoder/dwt.h"
+
+namespace {
+
+using libaom_test::ACMRandom;
+
+using FdwtFunc = void (*)(const uint8_t *input, tran_low_t *output, int stride,
+                          int hbd);
+using HaarAcSadFunc = int (*)(const uint8_t *input, int stride, int hbd);
+
+// <fdwt, haar ac sad, bit depth>
+using DwtParam = std::tuple<FdwtFunc, HaarAcSadFunc, int>;
+
+constexpr int kStride = 24;
+
+class DwtTest : public ::testing::TestWithParam<DwtParam> {
+ protected:
+  void SetUp() override {
+    rnd_.Reset(ACMRandom::DeterministicSeed());
+    fdwt_ = std::get<0>(GetParam());
+    ac_sad_ = std::get<1>(GetParam());
+    bit_depth_ = std::get<2>(GetParam());
+  }
+
+  // Fills the 8x8 block with random, extreme or nearly flat samples.
+  void FillBlock(int mode) {
+    const int max_val = (1 << bit_depth_) - 1;
+    for (int i = 0; i < 8 * kStride; ++i) {
+      int v;
+      switch (mode) {
+        case 0: v = rnd_.Rand16() & max_val; break;
+        case 1: v = (rnd_.Rand8() & 1) ? max_val : 0; break;
+        case 2: v = max_val - rnd_(3); break;
+        default: v = rnd_(4); break;
+      }
+      input16_[i] = v;
+      input8_[i] = v;
+    }
+  }
+
+  const uint8_t *input() const {
+    return bit_depth_ == 8 ? input8_ : CONVERT_TO_BYTEPTR(input16_);
+  }
+  int hbd() const { return bit_depth_ > 8; }
+
+  ACMRandom rnd_;
+  FdwtFunc fdwt_;
+  HaarAcSadFunc ac_sad_;
+  int bit_depth_;
+  uint8_t input8_[8 * kStride];
+  uint16_t input16_[8 * kStride];
+};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(DwtTest);
+
+TEST_P(DwtTest, MatchesC) {
+  for (int iter = 0; iter < 10000; ++iter) {
+    FillBlock(iter & 3);
+    tran_low_t ref[64], tst[64];
+    av1_fdwt8x8_uint8_input_c(input(), ref, kStride, hbd());
+    fdwt_(input(), tst, kStride, hbd());
+    ASSERT_EQ(memcmp(ref, tst, sizeof(ref)), 0) << "iter " << iter;
+    ASSERT_EQ(av1_haar_ac_sad_8x8_uint8_input_c(input(), kStride, hbd()),
+              ac_sad_(input(), kStride, hbd()))
+        << "iter " << iter;
+  }
+}
+
+TEST_P(DwtTest, DISABLED_Speed) {
+  FillBlock(0);
+  const int kRuns = 10000000;
+  const HaarAcSadFunc funcs[2] = { av1_haar_ac_sad_8x8_uint8_input_c,
+                                   ac_sad_ };
+  double elapsed[2];
+  int sink = 0;
+  for (int f = 0; f < 2; ++f) {
+    aom_usec_timer timer;
+    aom_usec_timer_start(&timer);
+    for (int i = 0; i < kRuns; ++i) sink += funcs[f](input(), kStride, hbd());
+    aom_usec_timer_mark(&timer);
+    elapsed[f] = static_cast<double>(aom_usec_timer_elapsed(&timer));
+  }
+  printf("Haar AC SAD %d-bit: c %.0f us, simd %.0f us (%.2fx) %d\n",
+         bit_depth_, elapsed[0], elapsed[1], elapsed[0] / elapsed[1],
+         sink & 1);
+}
+
+#if HAVE_SSE2
+INSTANTIATE_TEST_SUITE_P(
+    SSE2, DwtTest,
+    ::testing::Combine(::testing::Values(&av1_fdwt8x8_uint8_input_sse2),
+                       ::testing::Values(&av1_haar_ac_sad_8x8_uint8_input_sse2),
+                       ::testing::Values(8, 10, 12)));
+#endif
+
+#if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, DwtTest,
+    ::testing::Combine(::testing::Values(&av1_fdwt8x8_uint8_input_avx2),
+                       ::testing::Values(&av1_haar_ac_sad_8x8_uint8_input_avx2),
+                       ::testing::Values(8, 10, 12)));
+#endif
+
+}  // namespace
@@ -9,6 +9,7 @@
  * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
  */
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <climits>
@@ -19,6 +20,7 @@
 #include <initializer_list>
 #include <memory>
 #include <tuple>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -27,6 +29,7 @@
 #include "aom/aomcx.h"
 #include "aom/aom_encoder.h"
 #include "aom/aom_image.h"
+#include "aom/aom_memory.h"
 #include "aom_mem/aom_mem.h"
 
 #include "test/codec_factory.h"
@@ -2445,4 +2448,289 @@ TEST(EncodeAPI, Buganizer503197490) {
   ASSERT_EQ(aom_codec_destroy(&codec), AOM_CODEC_OK);
 }
 
+void RecordReleasedInput(void *priv, const aom_image_t *img) {
+  static_cast<std::vector<const aom_image_t *> *>(priv)->push_back(img);
+}
+
+void FillMovingPattern(aom_image_t *img, int frame) {
+  for (int p = 0; p < 3; ++p) {
+    const int w = p == 0 ? (int)img->d_w : (int)((img->d_w + 1) / 2);
+    const int h = p == 0 ? (int)img->d_h : (int)((img->d_h + 1) / 2);
+    for (int r = 0; r < h; ++r) {
+      uint8_t *row = img->planes[p] + r * img->stride[p];
+      for (int c = 0; c < w; ++c) {
+        row[c] = static_cast<uint8_t>(((r + c + 2 * frame) * 7) ^ (r * c));
+      }
+    }
+  }
+}
+
+// Encodes the images, in zero-copy input mode if |released| is not null, and
+// returns the bitstream.
+std::vector<uint8_t> EncodeImages(const std::vector<aom_image_t *> &images,
+                                  std::vector<const aom_image_t *> *released) {
+  aom_codec_iface_t *iface = aom_codec_av1_cx();
+  aom_codec_enc_cfg_t cfg;
+  EXPECT_EQ(aom_codec_enc_config_default(iface, &cfg, kUsage), AOM_CODEC_OK);
+  cfg.g_w = images[0]->d_w;
+  cfg.g_h = images[0]->d_h;
+  aom_codec_ctx_t enc;
+  EXPECT_EQ(aom_codec_enc_init(&enc, iface, &cfg, 0), AOM_CODEC_OK);
+  EXPECT_EQ(aom_codec_control(&enc, AOME_SET_CPUUSED, 7), AOM_CODEC_OK);
+  if (released != nullptr) {
+    aom_zero_copy_input_t zero_copy_input = { RecordReleasedInput, released };
+    EXPECT_EQ(
+        aom_codec_control(&enc, AV1E_SET_ZERO_COPY_INPUT, &zero_copy_input),
+        AOM_CODEC_OK);
+  }
+  std::vector<uint8_t> bitstream;
+  bool got_data;
+  size_t i = 0;
+  do {
+    aom_image_t *img = i < images.size() ? images[i] : nullptr;
+    EXPECT_EQ(aom_codec_encode(&enc, img, i, 1, 0), AOM_CODEC_OK);
+    // The lookahead keeps the first image in place rather than a copy.
+    if (released != nullptr && i == 0) {
+      EXPECT_TRUE(released->empty());
+    }
+    ++i;
+    got_data = false;
+    aom_codec_iter_t iter = nullptr;
+    const aom_codec_cx_pkt_t *pkt;
+    while ((pkt = aom_codec_get_cx_data(&enc, &iter)) != nullptr) {
+      if (pkt->kind != AOM_CODEC_CX_FRAME_PKT) continue;
+      const uint8_t *data = static_cast<const uint8_t *>(pkt->data.frame.buf);
+      bitstream.insert(bitstream.end(), data, data + pkt->data.frame.sz);
+      got_data = true;
+    }
+  } while (i <= images.size() || got_data);
+  EXPECT_EQ(aom_codec_destroy(&enc), AOM_CODEC_OK);
+  return bitstream;
+}
+
+TEST(EncodeAPI, ZeroCopyInput) {
+  constexpr int kNumFrames = 8;
+  std::vector<aom_image_t *> images;
+  for (int i = 0; i < kNumFrames; ++i) {
+    images.push_back(aom_img_alloc_with_border(nullptr, AOM_IMG_FMT_I420, 130,
+                                               74, 32, 1, 288));
+    ASSERT_NE(images.back(), nullptr);
+    FillMovingPattern(images.back(), i);
+  }
+  const std::vector<uint8_t> copied = EncodeImages(images, nullptr);
+
+  // The encoder extends the frames into the borders of the images and keeps
+  // them until it no longer needs them, which gives the same bitstream.
+  std::vector<const aom_image_t *> released;
+  const std::vector<uint8_t> wrapped = EncodeImages(images, &released);
+  EXPECT_EQ(copied, wrapped);
+  ASSERT_EQ(released.size(), images.size());
+  for (aom_image_t *img : images) {
+    EXPECT_EQ(std::count(released.begin(), released.end(), img), 1);
+    aom_img_free(img);
+  }
+}
+
+TEST(EncodeAPI, ZeroCopyInputCopiesImagesWithoutBorder) {
+  aom_image_t *img = aom_img_alloc(nullptr, AOM_IMG_FMT_I420, 130, 74, 1);
+  ASSERT_NE(img, nullptr);
+  FillMovingPattern(img, 0);
+
+  aom_codec_iface_t *iface = aom_codec_av1_cx();
+  aom_codec_enc_cfg_t cfg;
+  ASSERT_EQ(aom_codec_enc_config_default(iface, &cfg, kUsage), AOM_CODEC_OK);
+  cfg.g_w = img->d_w;
+  cfg.g_h = img->d_h;
+  aom_codec_ctx_t enc;
+  ASSERT_EQ(aom_codec_enc_init(&enc, iface, &cfg, 0), AOM_CODEC_OK);
+  std::vector<const aom_image_t *> released;
+  aom_zero_copy_input_t zero_copy_input = { RecordReleasedInput, &released };
+  ASSERT_EQ(aom_codec_control(&enc, AV1E_SET_ZERO_COPY_INPUT, &zero_copy_input),
+            AOM_CODEC_OK);
+  // There is no room to extend the frame in place, so the image is copied and
+  // released right away.
+  EXPECT_EQ(aom_codec_encode(&enc, img, 0, 1, 0), AOM_CODEC_OK);
+  ASSERT_EQ(released.size(), 1u);
+  EXPECT_EQ(released[0], img);
+  // The mode cannot change once the encoder holds input images.
+  EXPECT_EQ(aom_codec_control(&enc, AV1E_SET_ZERO_COPY_INPUT, &zero_copy_input),
+            AOM_CODEC_ERROR);
+  EXPECT_EQ(aom_codec_destroy(&enc), AOM_CODEC_OK);
+  EXPECT_EQ(released.size(), 1u);
+  aom_img_free(img);
+}
+
+TEST(EncodeAPI, SetCxDataBuf) {
+  constexpr int kNumFrames = 8;
+  constexpr unsigned int kPadBefore = 5;
+  constexpr uint8_t kPadValue = 0xa5;
+  std::vector<aom_image_t *> images;
+  for (int i = 0; i < kNumFrames; ++i) {
+    images.push_back(aom_img_alloc(nullptr, AOM_IMG_FMT_I420, 130, 74, 1));
+    ASSERT_NE(images.back(), nullptr);
+    FillMovingPattern(images.back(), i);
+  }
+  const std::vector<uint8_t> expected = EncodeImages(images, nullptr);
+
+  aom_codec_iface_t *iface = aom_codec_av1_cx();
+  aom_codec_enc_cfg_t cfg;
+  ASSERT_EQ(aom_codec_enc_config_default(iface, &cfg, kUsage), AOM_CODEC_OK);
+  cfg.g_w = images[0]->d_w;
+  cfg.g_h = images[0]->d_h;
+  aom_codec_ctx_t enc;
+  ASSERT_EQ(aom_codec_enc_init(&enc, iface, &cfg, 0), AOM_CODEC_OK);
+  ASSERT_EQ(aom_codec_control(&enc, AOME_SET_CPUUSED, 7), AOM_CODEC_OK);
+  // Room for the internal buffer of the encoder, 8 uncompressed frames with
+  // the dimensions rounded up to multiples of 32, after the padding.
+  std::vector<uint8_t> out(kPadBefore + 160 * 96 * 3 / 2 * 8);
+  std::vector<uint8_t> bitstream;
+  bool got_data;
+  size_t i = 0;
+  do {
+    // Reuse the start of the buffer for every frame, as a ring buffer would.
+    std::fill(out.begin(), out.end(), kPadValue);
+    aom_fixed_buf_t buf = { out.data(), out.size() };
+    ASSERT_EQ(aom_codec_set_cx_data_buf(&enc, &buf, kPadBefore, 0),
+              AOM_CODEC_OK);
+    aom_image_t *img = i < images.size() ? images[i] : nullptr;
+    ASSERT_EQ(aom_codec_encode(&enc, img, i, 1, 0), AOM_CODEC_OK);
+    ++i;
+    got_data = false;
+    aom_codec_iter_t iter = nullptr;
+    const aom_codec_cx_pkt_t *pkt;
+    while ((pkt = aom_codec_get_cx_data(&enc, &iter)) != nullptr) {
+      if (pkt->kind != AOM_CODEC_CX_FRAME_PKT) continue;
+      // The packet is in the buffer, after the untouched padding.
+      ASSERT_EQ(pkt->data.frame.buf, out.data());
+      const size_t data_sz = pkt->data.frame.sz - kPadBefore;
+      for (unsigned int j = 0; j < kPadBefore; ++j) {
+        EXPECT_EQ(out[j], kPadValue);
+      }
+      bitstream.insert(bitstream.end(), out.begin() + kPadBefore,
+                       out.begin() + kPadBefore + data_sz);
+      got_data = true;
+    }
+  } while (i <= images.size() || got_data);
+  EXPECT_EQ(aom_codec_destroy(&enc), AOM_CODEC_OK);
+  EXPECT_EQ(bitstream, expected);
+  for (aom_image_t *img : images) aom_img_free(img);
+}
+
+TEST(EncodeAPI, MemoryUsageByTag) {
+  const std::vector<aom_mem_tag_t> tags = {
+#if !CONFIG_REALTIME_ONLY
+    AOM_MEM_TAG_LOOKAHEAD, AOM_MEM_TAG_TPL,
+#endif
+    AOM_MEM_TAG_FRAME_BUFFERS, AOM_MEM_TAG_THREAD_DATA, AOM_MEM_TAG_BITSTREAM
+  };
+  std::vector<aom_mem_usage_t> before(tags.size());
+  for (size_t i = 0; i < tags.size(); ++i) {
+    ASSERT_EQ(aom_mem_get_usage(tags[i], &before[i]), 0);
+  }
+
+  aom_image_t *img = aom_img_alloc(nullptr, AOM_IMG_FMT_I420, 130, 74, 1);
+  ASSERT_NE(img, nullptr);
+  FillMovingPattern(img, 0);
+  aom_codec_iface_t *iface = aom_codec_av1_cx();
+  aom_codec_enc_cfg_t cfg;
+  ASSERT_EQ(aom_codec_enc_config_default(iface, &cfg, kUsage), AOM_CODEC_OK);
+  cfg.g_w = img->d_w;
+  cfg.g_h = img->d_h;
+  aom_codec_ctx_t enc;
+  ASSERT_EQ(aom_codec_enc_init(&enc, iface, &cfg, 0), AOM_CODEC_OK);
+  ASSERT_EQ(aom_codec_control(&enc, AOME_SET_CPUUSED, 7), AOM_CODEC_OK);
+  ASSERT_EQ(aom_codec_encode(&enc, img, 0, 1, 0), AOM_CODEC_OK);
+  ASSERT_EQ(aom_codec_encode(&enc, nullptr, 0, 0, 0), AOM_CODEC_OK);
+
+  // Each subsystem holds memory while the encoder exists and frees all of it
+  // when the encoder is destroyed.
+  for (size_t i = 0; i < tags.size(); ++i) {
+    aom_mem_usage_t usage;
+    ASSERT_EQ(aom_mem_get_usage(tags[i], &usage), 0);
+    EXPECT_GT(usage.live_bytes, before[i].live_bytes) << "tag " << tags[i];
+    EXPECT_GE(usage.peak_bytes, usage.live_bytes) << "tag " << tags[i];
+  }
+  EXPECT_EQ(aom_codec_destroy(&enc), AOM_CODEC_OK);
+  for (size_t i = 0; i < tags.size(); ++i) {
+    aom_mem_usage_t usage;
+    ASSERT_EQ(aom_mem_get_usage(tags[i], &usage), 0);
+    EXPECT_EQ(usage.live_bytes, before[i].live_bytes) << "tag " << tags[i];
+  }
+  aom_img_free(img);
+}
+
+#if !CONFIG_REALTIME_ONLY
+// Encodes a few frames with the given memory budget in MiB and returns the
+// budget report.
+aom_memory_budget_info_t EncodeWithMemoryBudget(
+    unsigned int max_memory_mb, aom_enc_pass pass = AOM_RC_ONE_PASS) {
+  aom_memory_budget_info_t info = {};
+  aom_image_t *img = aom_img_alloc(nullptr, AOM_IMG_FMT_I420, 352, 288, 1);
+  EXPECT_NE(img, nullptr);
+  if (img == nullptr) return info;
+  aom_codec_iface_t *iface = aom_codec_av1_cx();
+  aom_codec_enc_cfg_t cfg;
+  EXPECT_EQ(aom_codec_enc_config_default(iface, &cfg, AOM_USAGE_GOOD_QUALITY),
+            AOM_CODEC_OK);
+  cfg.g_w = img->d_w;
+  cfg.g_h = img->d_h;
+  cfg.g_lag_in_frames = 10;
+  cfg.g_pass = pass;
+  aom_codec_ctx_t enc;
+  EXPECT_EQ(aom_codec_enc_init(&enc, iface, &cfg, 0), AOM_CODEC_OK);
+  EXPECT_EQ(aom_codec_control(&enc, AOME_SET_CPUUSED, 6), AOM_CODEC_OK);
+  EXPECT_EQ(aom_codec_control(&enc, AV1E_SET_MAX_MEMORY_MB, max_memory_mb),
+            AOM_CODEC_OK);
+  EXPECT_EQ(aom_codec_control(&enc, AV1E_GET_MEMORY_BUDGET_INFO, &info),
+            AOM_CODEC_OK);
+  for (int i = 0; i < 12; ++i) {
+    FillMovingPattern(img, i);
+    EXPECT_EQ(aom_codec_encode(&enc, img, i, 1, 0), AOM_CODEC_OK);
+  }
+  EXPECT_EQ(aom_codec_encode(&enc, nullptr, 0, 0, 0), AOM_CODEC_OK);
+  // The budget cannot change once the lookahead is allocated.
+  EXPECT_EQ(aom_codec_control(&enc, AV1E_SET_MAX_MEMORY_MB, 0u),
+            AOM_CODEC_ERROR);
+  EXPECT_EQ(aom_codec_destroy(&enc), AOM_CODEC_OK);
+  aom_img_free(img);
+  return info;
+}
+
+TEST(EncodeAPI, MaxMemory) {
+  const aom_memory_budget_info_t unlimited = EncodeWithMemoryBudget(0);
+  EXPECT_EQ(unlimited.degradations, 0u);
+  EXPECT_EQ(unlimited.lag_in_frames, 10u);
+  EXPECT_GT(unlimited.estimated_bytes, 0u);
+
+  // A budget just below the estimate only needs coarser TPL statistics.
+  const unsigned int estimated_mb =
+      static_cast<unsigned int>(unlimited.estimated_bytes >> 20);
+  const aom_memory_budget_info_t tight = EncodeWithMemoryBudget(estimated_mb);
+  EXPECT_NE(tight.degradations & AOM_MEM_BUDGET_COARSE_TPL, 0u);
+  EXPECT_LT(tight.estimated_bytes, unlimited.estimated_bytes);
+  if (!(tight.degradations & AOM_MEM_BUDGET_EXCEEDED)) {
+    EXPECT_LE(tight.estimated_bytes, static_cast<uint64_t>(estimated_mb)
+                                         << 20);
+  }
+
+  // Nothing fits in 1 MiB; every degradation is applied and the encoder
+  // still works. One pass encodes use lookahead processing, whose lag cannot
+  // be shortened.
+  const aom_memory_budget_info_t tiny = EncodeWithMemoryBudget(1);
+  EXPECT_EQ(tiny.degradations,
+            static_cast<unsigned int>(AOM_MEM_BUDGET_COARSE_TPL |
+                                      AOM_MEM_BUDGET_NO_GLOBAL_MOTION |
+                                      AOM_MEM_BUDGET_EXCEEDED));
+  EXPECT_EQ(tiny.lag_in_frames, 10u);
+
+  const aom_memory_budget_info_t first_pass =
+      EncodeWithMemoryBudget(1, AOM_RC_FIRST_PASS);
+  EXPECT_EQ(first_pass.degradations,
+            static_cast<unsigned int>(
+                AOM_MEM_BUDGET_COARSE_TPL | AOM_MEM_BUDGET_NO_GLOBAL_MOTION |
+                AOM_MEM_BUDGET_SHORT_LAG | AOM_MEM_BUDGET_EXCEEDED));
+  EXPECT_EQ(first_pass.lag_in_frames, 0u);
+}
+#endif  // !CONFIG_REALTIME_ONLY
+
 }  // namespace
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <vector>
+
+#include "config/aom_dsp_rtcd.h"
+
+#include "gtest/gtest.h"
+#include "test/acm_random.h"
+#include "test/function_equivalence_test.h"
+#include "test/util.h"
+
+#include "aom_dsp/flow_estimation/flow_estimation.h"
+#include "aom_dsp/flow_estimation/ransac.h"
+#include "aom_ports/aom_timer.h"
+
+namespace {
+
+using libaom_test::ACMRandom;
+
+// Returns a uniformly distributed double in [lo, hi).
+double RandRange(ACMRandom *rnd, double lo, double hi) {
+  return lo + (hi - lo) * rnd->Rand31() / (1u << 31);
+}
+
+// Builds a correspondence set like the ones that global motion gets from
+// corner matching or from disflow: points spread over a frame, a fraction of
+// which follow the affine model `mat` up to a small error, and the rest of
+// which are outliers.
+void GenerateCorrespondences(ACMRandom *rnd, const double *mat, int num_points,
+                             double inlier_fraction,
+                             std::vector<Correspondence> *points) {
+  points->resize(num_points);
+  for (Correspondence &p : *points) {
+    p.x = RandRange(rnd, 0, 1920);
+    p.y = RandRange(rnd, 0, 1080);
+    if (RandRange(rnd, 0, 1) < inlier_fraction) {
+      p.rx = mat[2] * p.x + mat[3] * p.y + mat[0] + RandRange(rnd, -1, 1);
+      p.ry = mat[4] * p.x + mat[5] * p.y + mat[1] + RandRange(rnd, -1, 1);
+    } else {
+      p.rx = p.x + RandRange(rnd, -64, 64);
+      p.ry = p.y + RandRange(rnd, -64, 64);
+    }
+  }
+}
+
+void RandomModel(ACMRandom *rnd, double *mat) {
+  mat[0] = RandRange(rnd, -16, 16);
+  mat[1] = RandRange(rnd, -16, 16);
+  mat[2] = 1.0 + RandRange(rnd, -0.02, 0.02);
+  mat[3] = RandRange(rnd, -0.02, 0.02);
+  mat[4] = RandRange(rnd, -0.02, 0.02);
+  mat[5] = 1.0 + RandRange(rnd, -0.02, 0.02);
+}
+
+using RansacScoreFunc = int (*)(const double *mat,
+                                const struct correspondence *points,
+                                int num_points, int min_inliers,
+                                int *inlier_indices, double *sse);
+using RansacScoreParam = libaom_test::FuncParam<RansacScoreFunc>;
+
+class RansacScoreTest : public ::testing::TestWithParam<RansacScoreParam> {
+ protected:
+  void SetUp() override { rnd_.Reset(ACMRandom::DeterministicSeed()); }
+
+  ACMRandom rnd_;
+};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(RansacScoreTest);
+
+TEST_P(RansacScoreTest, CheckOutput) {
+  const RansacScoreParam params = GetParam();
+  std::vector<Correspondence> points;
+  for (int iter = 0; iter < 500; ++iter) {
+    double mat[MAX_PARAMDIM];
+    RandomModel(&rnd_, mat);
+    const int num_points = 1 + rnd_(600);
+    GenerateCorrespondences(&rnd_, mat, num_points, RandRange(&rnd_, 0, 1),
+                            &points);
+    // Score a slightly perturbed model, as RANSAC would.
+    mat[0] += RandRange(&rnd_, -0.5, 0.5);
+    mat[1] += RandRange(&rnd_, -0.5, 0.5);
+    const int min_inliers = (iter & 1) ? rnd_(num_points + 1) : 0;
+
+    std::vector<int> ref_indices(num_points), tst_indices(num_points);
+    double ref_sse, tst_sse;
+    const int ref_inliers =
+        params.ref_func(mat, points.data(), num_points, min_inliers,
+                        ref_indices.data(), &ref_sse);
+    const int tst_inliers =
+        params.tst_func(mat, points.data(), num_points, min_inliers,
+                        tst_indices.data(), &tst_sse);
+    if (ref_inliers < min_inliers) {
+      // Both stopped early, possibly at different points.
+      ASSERT_LT(tst_inliers, min_inliers);
+      continue;
+    }
+    ASSERT_EQ(ref_inliers, tst_inliers);
+    ASSERT_EQ(ref_sse, tst_sse);
+    for (int i = 0; i < ref_inliers; ++i) {
+      ASSERT_EQ(ref_indices[i], tst_indices[i]) << "inlier " << i;
+    }
+  }
+}
+
+#if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, RansacScoreTest,
+    ::testing::Values(RansacScoreParam(&aom_ransac_score_affine_c,
+                                       &aom_ransac_score_affine_avx2)));
+#endif  // HAVE_AVX2
+
+// Times ransac() on correspondence sets of the sizes global motion produces:
+// a few hundred from corner matching on a downscaled frame, up to a few
+// thousand from disflow or from corner matching at full resolution. Run with
+// AOM_SIMD_CAPS_MASK=0 to time the C path.
+TEST(RansacTest, DISABLED_Speed) {
+  ACMRandom rnd(ACMRandom::DeterministicSeed());
+  const int kNumMotions = 2;
+  const int sizes[] = { 300, 1000, 4096 };
+  const double inlier_fractions[] = { 0.3, 0.7 };
+  for (const int num_points : sizes) {
+    for (const double inlier_fraction : inlier_fractions) {
+      double mat[MAX_PARAMDIM];
+      RandomModel(&rnd, mat);
+      std::vector<Correspondence> points;
+      GenerateCorrespondences(&rnd, mat, num_points, inlier_fraction, &points);
+      std::vector<int> inliers(2 * kNumMotions * num_points);
+      MotionModel models[kNumMotions];
+      for (int i = 0; i < kNumMotions; ++i) {
+        models[i].inliers = &inliers[2 * i * num_points];
+      }
+      const TransformationType types[] = { ROTZOOM, AFFINE };
+      for (const TransformationType type : types) {
+        const int num_loops = 200;
+        bool mem_alloc_failed = false;
+        aom_usec_timer timer;
+        aom_usec_timer_start(&timer);
+        for (int i = 0; i < num_loops; ++i) {
+          ransac(points.data(), num_points, type, models, kNumMotions,
+                 &mem_alloc_failed);
+        }
+        aom_usec_timer_mark(&timer);
+        ASSERT_FALSE(mem_alloc_failed);
+        printf("points %4d inliers %.1f type %d: %7.2f us\n", num_points,
+               inlier_fraction, type,
+               static_cast<double>(aom_usec_timer_elapsed(&timer)) /
+                   num_loops);
+      }
+    }
+  }
+}
+
+}  // namespace
@@ -2922,15 +2922,67 @@ const SadMxNParam avx512_tests[] = {
   make_tuple(128, 128, &aom_sad128x128_avx512, -1),
   make_tuple(64, 64, &aom_sad64x64_avx512, -1),
   make_tuple(64, 32, &aom_sad64x32_avx512, -1),
+#if CONFIG_AV1_HIGHBITDEPTH
+  make_tuple(128, 128, &aom_highbd_sad128x128_avx512, 8),
+  make_tuple(128, 128, &aom_highbd_sad128x128_avx512, 10),
+  make_tuple(128, 128, &aom_highbd_sad128x128_avx512, 12),
+  make_tuple(128, 64, &aom_highbd_sad128x64_avx512, 8),
+  make_tuple(128, 64, &aom_highbd_sad128x64_avx512, 10),
+  make_tuple(128, 64, &aom_highbd_sad128x64_avx512, 12),
+  make_tuple(64, 128, &aom_highbd_sad64x128_avx512, 8),
+  make_tuple(64, 128, &aom_highbd_sad64x128_avx512, 10),
+  make_tuple(64, 128, &aom_highbd_sad64x128_avx512, 12),
+  make_tuple(64, 64, &aom_highbd_sad64x64_avx512, 8),
+  make_tuple(64, 64, &aom_highbd_sad64x64_avx512, 10),
+  make_tuple(64, 64, &aom_highbd_sad64x64_avx512, 12),
+  make_tuple(64, 32, &aom_highbd_sad64x32_avx512, 8),
+  make_tuple(64, 32, &aom_highbd_sad64x32_avx512, 10),
+  make_tuple(64, 32, &aom_highbd_sad64x32_avx512, 12),
+  make_tuple(32, 64, &aom_highbd_sad32x64_avx512, 8),
+  make_tuple(32, 64, &aom_highbd_sad32x64_avx512, 10),
+  make_tuple(32, 64, &aom_highbd_sad32x64_avx512, 12),
+  make_tuple(32, 32, &aom_highbd_sad32x32_avx512, 8),
+  make_tuple(32, 32, &aom_highbd_sad32x32_avx512, 10),
+  make_tuple(32, 32, &aom_highbd_sad32x32_avx512, 12),
+  make_tuple(32, 16, &aom_highbd_sad32x16_avx512, 8),
+  make_tuple(32, 16, &aom_highbd_sad32x16_avx512, 10),
+  make_tuple(32, 16, &aom_highbd_sad32x16_avx512, 12),
+#endif  // CONFIG_AV1_HIGHBITDEPTH
 };
 INSTANTIATE_TEST_SUITE_P(AVX512, SADTest, ::testing::ValuesIn(avx512_tests));
 
 const SadSkipMxNParam skip_avx512_tests[] = {
-  make_tuple(128, 128, &aom_sad_skip_128x128_avx2, -1),
-  make_tuple(128, 64, &aom_sad_skip_128x64_avx2, -1),
-  make_tuple(64, 128, &aom_sad_skip_64x128_avx2, -1),
-  make_tuple(64, 64, &aom_sad_skip_64x64_avx2, -1),
-  make_tuple(64, 32, &aom_sad_skip_64x32_avx2, -1),
+  make_tuple(128, 128, &aom_sad_skip_128x128_avx512, -1),
+  make_tuple(128, 64, &aom_sad_skip_128x64_avx512, -1),
+  make_tuple(64, 128, &aom_sad_skip_64x128_avx512, -1),
+  make_tuple(64, 64, &aom_sad_skip_64x64_avx512, -1),
+  make_tuple(64, 32, &aom_sad_skip_64x32_avx512, -1),
+#if CONFIG_AV1_HIGHBITDEPTH
+  make_tuple(128, 128, &aom_highbd_sad_skip_128x128_avx512, 8),
+  make_tuple(128, 128, &aom_highbd_sad_skip_128x128_avx512, 10),
+  make_tuple(128, 128, &aom_highbd_sad_skip_128x128_avx512, 12),
+  make_tuple(128, 64, &aom_highbd_sad_skip_128x64_avx512, 8),
+  make_tuple(128, 64, &aom_highbd_sad_skip_128x64_avx512, 10),
+  make_tuple(128, 64, &aom_highbd_sad_skip_128x64_avx512, 12),
+  make_tuple(64, 128, &aom_highbd_sad_skip_64x128_avx512, 8),
+  make_tuple(64, 128, &aom_highbd_sad_skip_64x128_avx512, 10),
+  make_tuple(64, 128, &aom_highbd_sad_skip_64x128_avx512, 12),
+  make_tuple(64, 64, &aom_highbd_sad_skip_64x64_avx512, 8),
+  make_tuple(64, 64, &aom_highbd_sad_skip_64x64_avx512, 10),
+  make_tuple(64, 64, &aom_highbd_sad_skip_64x64_avx512, 12),
+  make_tuple(64, 32, &aom_highbd_sad_skip_64x32_avx512, 8),
+  make_tuple(64, 32, &aom_highbd_sad_skip_64x32_avx512, 10),
+  make_tuple(64, 32, &aom_highbd_sad_skip_64x32_avx512, 12),
+  make_tuple(32, 64, &aom_highbd_sad_skip_32x64_avx512, 8),
+  make_tuple(32, 64, &aom_highbd_sad_skip_32x64_avx512, 10),
+  make_tuple(32, 64, &aom_highbd_sad_skip_32x64_avx512, 12),
+  make_tuple(32, 32, &aom_highbd_sad_skip_32x32_avx512, 8),
+  make_tuple(32, 32, &aom_highbd_sad_skip_32x32_avx512, 10),
+  make_tuple(32, 32, &aom_highbd_sad_skip_32x32_avx512, 12),
+  make_tuple(32, 16, &aom_highbd_sad_skip_32x16_avx512, 8),
+  make_tuple(32, 16, &aom_highbd_sad_skip_32x16_avx512, 10),
+  make_tuple(32, 16, &aom_highbd_sad_skip_32x16_avx512, 12),
+#endif  // CONFIG_AV1_HIGHBITDEPTH
 };
 INSTANTIATE_TEST_SUITE_P(AVX512, SADSkipTest,
                          ::testing::ValuesIn(skip_avx512_tests));
@@ -2941,6 +2993,32 @@ const SadMxNAvgParam avg_avx512_tests[] = {
   make_tuple(128, 128, &aom_sad128x128_avg_avx512, -1),
   make_tuple(64, 64, &aom_sad64x64_avg_avx512, -1),
   make_tuple(64, 32, &aom_sad64x32_avg_avx512, -1),
+#if CONFIG_AV1_HIGHBITDEPTH
+  make_tuple(128, 128, &aom_highbd_sad128x128_avg_avx512, 8),
+  make_tuple(128, 128, &aom_highbd_sad128x128_avg_avx512, 10),
+  make_tuple(128, 128, &aom_highbd_sad128x128_avg_avx512, 12),
+  make_tuple(128, 64, &aom_highbd_sad128x64_avg_avx512, 8),
+  make_tuple(128, 64, &aom_highbd_sad128x64_avg_avx512, 10),
+  make_tuple(128, 64, &aom_highbd_sad128x64_avg_avx512, 12),
+  make_tuple(64, 128, &aom_highbd_sad64x128_avg_avx512, 8),
+  make_tuple(64, 128, &aom_highbd_sad64x128_avg_avx512, 10),
+  make_tuple(64, 128, &aom_highbd_sad64x128_avg_avx512, 12),
+  make_tuple(64, 64, &aom_highbd_sad64x64_avg_avx512, 8),
+  make_tuple(64, 64, &aom_highbd_sad64x64_avg_avx512, 10),
+  make_tuple(64, 64, &aom_highbd_sad64x64_avg_avx512, 12),
+  make_tuple(64, 32, &aom_highbd_sad64x32_avg_avx512, 8),
+  make_tuple(64, 32, &aom_highbd_sad64x32_avg_avx512, 10),
+  make_tuple(64, 32, &aom_highbd_sad64x32_avg_avx512, 12),
+  make_tuple(32, 64, &aom_highbd_sad32x64_avg_avx512, 8),
+  make_tuple(32, 64, &aom_highbd_sad32x64_avg_avx512, 10),
+  make_tuple(32, 64, &aom_highbd_sad32x64_avg_avx512, 12),
+  make_tuple(32, 32, &aom_highbd_sad32x32_avg_avx512, 8),
+  make_tuple(32, 32, &aom_highbd_sad32x32_avg_avx512, 10),
+  make_tuple(32, 32, &aom_highbd_sad32x32_avg_avx512, 12),
+  make_tuple(32, 16, &aom_highbd_sad32x16_avg_avx512, 8),
+  make_tuple(32, 16, &aom_highbd_sad32x16_avg_avx512, 10),
+  make_tuple(32, 16, &aom_highbd_sad32x16_avg_avx512, 12),
+#endif  // CONFIG_AV1_HIGHBITDEPTH
 };
 INSTANTIATE_TEST_SUITE_P(AVX512, SADavgTest,
                          ::testing::ValuesIn(avg_avx512_tests));
@@ -2951,6 +3029,32 @@ const SadMxNx4Param x4d_avx512_tests[] = {
   make_tuple(64, 128, &aom_sad64x128x4d_avx512, -1),
   make_tuple(64, 64, &aom_sad64x64x4d_avx512, -1),
   make_tuple(64, 32, &aom_sad64x32x4d_avx512, -1),
+#if CONFIG_AV1_HIGHBITDEPTH
+  make_tuple(128, 128, &aom_highbd_sad128x128x4d_avx512, 8),
+  make_tuple(128, 128, &aom_highbd_sad128x128x4d_avx512, 10),
+  make_tuple(128, 128, &aom_highbd_sad128x128x4d_avx512, 12),
+  make_tuple(128, 64, &aom_highbd_sad128x64x4d_avx512, 8),
+  make_tuple(128, 64, &aom_highbd_sad128x64x4d_avx512, 10),
+  make_tuple(128, 64, &aom_highbd_sad128x64x4d_avx512, 12),
+  make_tuple(64, 128, &aom_highbd_sad64x128x4d_avx512, 8),
+  make_tuple(64, 128, &aom_highbd_sad64x128x4d_avx512, 10),
+  make_tuple(64, 128, &aom_highbd_sad64x128x4d_avx512, 12),
+  make_tuple(64, 64, &aom_highbd_sad64x64x4d_avx512, 8),
+  make_tuple(64, 64, &aom_highbd_sad64x64x4d_avx512, 10),
+  make_tuple(64, 64, &aom_highbd_sad64x64x4d_avx512, 12),
+  make_tuple(64, 32, &aom_highbd_sad64x32x4d_avx512, 8),
+  make_tuple(64, 32, &aom_highbd_sad64x32x4d_avx512, 10),
+  make_tuple(64, 32, &aom_highbd_sad64x32x4d_avx512, 12),
+  make_tuple(32, 64, &aom_highbd_sad32x64x4d_avx512, 8),
+  make_tuple(32, 64, &aom_highbd_sad32x64x4d_avx512, 10),
+  make_tuple(32, 64, &aom_highbd_sad32x64x4d_avx512, 12),
+  make_tuple(32, 32, &aom_highbd_sad32x32x4d_avx512, 8),
+  make_tuple(32, 32, &aom_highbd_sad32x32x4d_avx512, 10),
+  make_tuple(32, 32, &aom_highbd_sad32x32x4d_avx512, 12),
+  make_tuple(32, 16, &aom_highbd_sad32x16x4d_avx512, 8),
+  make_tuple(32, 16, &aom_highbd_sad32x16x4d_avx512, 10),
+  make_tuple(32, 16, &aom_highbd_sad32x16x4d_avx512, 12),
+#endif  // CONFIG_AV1_HIGHBITDEPTH
 };
 INSTANTIATE_TEST_SUITE_P(AVX512, SADx4Test,
                          ::testing::ValuesIn(x4d_avx512_tests));
@@ -2961,6 +3065,32 @@ const SadMxNx4Param x3d_avx512_tests[] = {
   make_tuple(64, 128, &aom_sad64x128x3d_avx512, -1),
   make_tuple(64, 64, &aom_sad64x64x3d_avx512, -1),
   make_tuple(64, 32, &aom_sad64x32x3d_avx512, -1),
+#if CONFIG_AV1_HIGHBITDEPTH
+  make_tuple(128, 128, &aom_highbd_sad128x128x3d_avx512, 8),
+  make_tuple(128, 128, &aom_highbd_sad128x128x3d_avx512, 10),
+  make_tuple(128, 128, &aom_highbd_sad128x128x3d_avx512, 12),
+  make_tuple(128, 64, &aom_highbd_sad128x64x3d_avx512, 8),
+  make_tuple(128, 64, &aom_highbd_sad128x64x3d_avx512, 10),
+  make_tuple(128, 64, &aom_highbd_sad128x64x3d_avx512, 12),
+  make_tuple(64, 128, &aom_highbd_sad64x128x3d_avx512, 8),
+  make_tuple(64, 128, &aom_highbd_sad64x128x3d_avx512, 10),
+  make_tuple(64, 128, &aom_highbd_sad64x128x3d_avx512, 12),
+  make_tuple(64, 64, &aom_highbd_sad64x64x3d_avx512, 8),
+  make_tuple(64, 64, &aom_highbd_sad64x64x3d_avx512, 10),
+  make_tuple(64, 64, &aom_highbd_sad64x64x3d_avx512, 12),
+  make_tuple(64, 32, &aom_highbd_sad64x32x3d_avx512, 8),
+  make_tuple(64, 32, &aom_highbd_sad64x32x3d_avx512, 10),
+  make_tuple(64, 32, &aom_highbd_sad64x32x3d_avx512, 12),
+  make_tuple(32, 64, &aom_highbd_sad32x64x3d_avx512, 8),
+  make_tuple(32, 64, &aom_highbd_sad32x64x3d_avx512, 10),
+  make_tuple(32, 64, &aom_highbd_sad32x64x3d_avx512, 12),
+  make_tuple(32, 32, &aom_highbd_sad32x32x3d_avx512, 8),
+  make_tuple(32, 32, &aom_highbd_sad32x32x3d_avx512, 10),
+  make_tuple(32, 32, &aom_highbd_sad32x32x3d_avx512, 12),
+  make_tuple(32, 16, &aom_highbd_sad32x16x3d_avx512, 8),
+  make_tuple(32, 16, &aom_highbd_sad32x16x3d_avx512, 10),
+  make_tuple(32, 16, &aom_highbd_sad32x16x3d_avx512, 12),
+#endif  // CONFIG_AV1_HIGHBITDEPTH
 };
 INSTANTIATE_TEST_SUITE_P(AVX512, SADx3Test,
                          ::testing::ValuesIn(x3d_avx512_tests));
@@ -2971,6 +3101,32 @@ const SadSkipMxNx4Param skip_x4d_avx512_tests[] = {
   make_tuple(64, 128, &aom_sad_skip_64x128x4d_avx512, -1),
   make_tuple(64, 64, &aom_sad_skip_64x64x4d_avx512, -1),
   make_tuple(64, 32, &aom_sad_skip_64x32x4d_avx512, -1),
+#if CONFIG_AV1_HIGHBITDEPTH
+  make_tuple(128, 128, &aom_highbd_sad_skip_128x128x4d_avx512, 8),
+  make_tuple(128, 128, &aom_highbd_sad_skip_128x128x4d_avx512, 10),
+  make_tuple(128, 128, &aom_highbd_sad_skip_128x128x4d_avx512, 12),
+  make_tuple(128, 64, &aom_highbd_sad_skip_128x64x4d_avx512, 8),
+  make_tuple(128, 64, &aom_highbd_sad_skip_128x64x4d_avx512, 10),
+  make_tuple(128, 64, &aom_highbd_sad_skip_128x64x4d_avx512, 12),
+  make_tuple(64, 128, &aom_highbd_sad_skip_64x128x4d_avx512, 8),
+  make_tuple(64, 128, &aom_highbd_sad_skip_64x128x4d_avx512, 10),
+  make_tuple(64, 128, &aom_highbd_sad_skip_64x128x4d_avx512, 12),
+  make_tuple(64, 64, &aom_highbd_sad_skip_64x64x4d_avx512, 8),
+  make_tuple(64, 64, &aom_highbd_sad_skip_64x64x4d_avx512, 10),
+  make_tuple(64, 64, &aom_highbd_sad_skip_64x64x4d_avx512, 12),
+  make_tuple(64, 32, &aom_highbd_sad_skip_64x32x4d_avx512, 8),
+  make_tuple(64, 32, &aom_highbd_sad_skip_64x32x4d_avx512, 10),
+  make_tuple(64, 32, &aom_highbd_sad_skip_64x32x4d_avx512, 12),
+  make_tuple(32, 64, &aom_highbd_sad_skip_32x64x4d_avx512, 8),
+  make_tuple(32, 64, &aom_highbd_sad_skip_32x64x4d_avx512, 10),
+  make_tuple(32, 64, &aom_highbd_sad_skip_32x64x4d_avx512, 12),
+  make_tuple(32, 32, &aom_highbd_sad_skip_32x32x4d_avx512, 8),
+  make_tuple(32, 32, &aom_highbd_sad_skip_32x32x4d_avx512, 10),
+  make_tuple(32, 32, &aom_highbd_sad_skip_32x32x4d_avx512, 12),
+  make_tuple(32, 16, &aom_highbd_sad_skip_32x16x4d_avx512, 8),
+  make_tuple(32, 16, &aom_highbd_sad_skip_32x16x4d_avx512, 10),
+  make_tuple(32, 16, &aom_highbd_sad_skip_32x16x4d_avx512, 12),
+#endif  // CONFIG_AV1_HIGHBITDEPTH
 };
 INSTANTIATE_TEST_SUITE_P(AVX512, SADSkipx4Test,
                          ::testing::ValuesIn(skip_x4d_avx512_tests));
@@ -458,6 +458,12 @@ INSTANTIATE_TEST_SUITE_P(AVX2, SSETest,
                          Combine(ValuesIn(sse_avx2), Range(4, 129, 4)));
 #endif  // HAVE_AVX2
 
+#if HAVE_AVXVNNI
+TestSSEFuncs sse_avxvnni[] = { TestSSEFuncs(&aom_sse_c, &aom_sse_avxvnni) };
+INSTANTIATE_TEST_SUITE_P(AVXVNNI, SSETest,
+                         Combine(ValuesIn(sse_avxvnni), Range(4, 129, 4)));
+#endif  // HAVE_AVXVNNI
+
 #if HAVE_SVE
 #if CONFIG_AV1_HIGHBITDEPTH
 TestSSEFuncs sse_sve[] = { TestSSEFuncs(&aom_highbd_sse_c,
@@ -215,7 +215,9 @@ if(NOT BUILD_SHARED_LIBS)
               "${AOM_ROOT}/test/blend_a64_mask_1d_test.cc"
               "${AOM_ROOT}/test/blend_a64_mask_test.cc"
               "${AOM_ROOT}/test/comp_mask_pred_test.cc"
+              "${AOM_ROOT}/test/count_colors_test.cc"
               "${AOM_ROOT}/test/disflow_test.cc"
+              "${AOM_ROOT}/test/dwt_test.cc"
               "${AOM_ROOT}/test/encodemb_test.cc"
               "${AOM_ROOT}/test/encodetxb_test.cc"
               "${AOM_ROOT}/test/end_to_end_qmpsnr_test.cc"
@@ -252,6 +254,9 @@ if(NOT BUILD_SHARED_LIBS)
               "${AOM_ROOT}/test/wiener_test.cc")
 
   if(NOT CONFIG_REALTIME_ONLY)
+    list(APPEND AOM_UNIT_TEST_ENCODER_SOURCES
+                "${AOM_ROOT}/test/corner_detect_test.cc"
+                "${AOM_ROOT}/test/ransac_test.cc")
     list(APPEND AOM_UNIT_TEST_ENCODER_INTRIN_SSE4_1
                 "${AOM_ROOT}/test/corner_match_test.cc")
   endif()